@@ -54,6 +54,8 @@ STATUS: unreviewed, tested.
 #include <sys/types.h> /* For struct stat. */
 #include <sys/stat.h>  /* For stat(). */
 
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
+
 /*================================== MACROS =================================*/
 
 /* Macro to append 'L' or 'LL' to form appropriate 64-bit integer constant: */
@@ -416,6 +418,7 @@ typedef struct {
   Integer      firstTimestamp;  /* YYYYDDDHH00 of subset. */
   size_t       timesteps;       /* Number of hours in subset. */
   double       domain[ 2 ][ 2 ];/*domain[LONGITUDE,LATITUDE][MINIMUM,MAXIMUM]*/
+  int          float32;         /* Output XDR data as 32-bit reals? */
 } Arguments;
 
 /* Data read/computed: */
@@ -495,6 +498,8 @@ static void writeHeader( const Arguments* arguments, const Data* data );
 
 static void writeXDR( const Arguments* arguments, Data* data );
 
+static int writeFloats( const double values[], size_t count );
+
 static void writeASCII( const Arguments* arguments, const Data* data );
 
 /* Queries: */
@@ -563,7 +568,7 @@ static size_t buffered_fwrite( const void* array, size_t item_size,
 #endif /* _AIX */
 
 #if IS_LITTLE_ENDIAN
-/* static void swapBytes4( void* array, size_t count ); */
+static void swapBytes4( void* array, size_t count );
 static void swapBytes8( void* array, size_t count );
 #endif
 
@@ -609,6 +614,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   int ok = 0;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     fprintf( stderr, "\a\n\nInvalid command-line arguments.\n" );
@@ -618,11 +625,13 @@ int main( int argc, char* argv[] ) {
     if ( parseArguments( argc, argv, &arguments ) ) {
       Data data;
       ZERO_OBJECT( &data );
+      timingStage( "read" );
       data.fileData =
         readFiles( arguments.fileNames, arguments.days, &data.fileDataLength );
 
       if ( data.fileData ) {
         data.ok = 1;
+        timingStage( "subset" );
         computeTimeRange( &arguments, &data );
         subsetFileData( &arguments, &data );
 
@@ -639,6 +648,8 @@ int main( int argc, char* argv[] ) {
             extractDataValues( &data );
 
             if ( data.ok ) {
+              timingPoints( data.lineCount );
+              timingStage( "write" );
 
               switch ( arguments.outputFormat ) {
               case OUTPUT_HEADER:
@@ -663,6 +674,7 @@ int main( int argc, char* argv[] ) {
     }
   }
 
+  timingReport();
   POST( IS_BOOL( ok ) );
 
   return ! ok;
@@ -693,7 +705,11 @@ static void printUsage( const char* programName ) {
   fprintf( stderr, "-timestamp <yyyymmddhh> -hours <count> \\\n" );
   fprintf( stderr, "[ -domain <minimum_longitude> <minimum_latitude>" );
   fprintf( stderr, " <maximum_longitude> <maximum_latitude> ] \\\n" );
+  fprintf( stderr, "[ -float32 ]\n" );
   fprintf( stderr, "Note: timestamp is in UTC (GMT)\n" );
+  fprintf( stderr, "-float32 writes XDR data[timesteps][stations] as " );
+  fprintf( stderr, "IEEE-754 32-bit reals\n(half the size, rounding " );
+  fprintf( stderr, "values to float precision).\n" );
   fprintf( stderr, "\n\n\n--------------------------------------------\n\n" );
   fprintf( stderr, "Example #1:\n\n" );
   fprintf( stderr, "%s \\\n", programName );
@@ -879,6 +895,12 @@ static int parseArguments( int argc, char* argv[], Arguments* arguments ) {
                   } else {
                     ++arg;
                     result = parseDomain( argc, argv, &arg, arguments );
+
+                    if ( AND3( result, arg < argc,
+                               strcmp( argv[ arg ], "-float32" ) == 0 ) ) {
+                      arguments->float32 = 1;
+                      ++arg;
+                    }
                   }
                 }
               }
@@ -1663,7 +1685,8 @@ static void writeHeader( const Arguments* arguments, const Data* data ) {
   printf( "# MSB 64-bit integers ids[stations] and\n" );
   printf( "# IEEE-754 64-bit reals sites[stations][2=<longitude,latitude>]" );
   printf( " and\n");
-  printf( "# IEEE-754 64-bit reals data[timesteps][stations]:\n");
+  printf( "# IEEE-754 %d-bit reals data[timesteps][stations]:\n",
+          arguments->float32 ? 32 : 64 );
 
   POST( data->ok );
 }
@@ -1728,16 +1751,21 @@ static void writeXDR( const Arguments* arguments, Data* data ) {
             count += count;
           }
 
+          if ( arguments->float32 ) {
+            data->ok = writeFloats( data->data, count );
+          } else {
+
 #if IS_LITTLE_ENDIAN
-          swapBytes8( data->data, count );
+            swapBytes8( data->data, count );
 #endif
 
-          data->ok =
-            fwrite( data->data,  sizeof *data->data, count, stdout ) == count;
+            data->ok =
+              fwrite( data->data, sizeof *data->data, count, stdout ) == count;
 
 #if IS_LITTLE_ENDIAN
-          swapBytes8( data->data, count );
+            swapBytes8( data->data, count );
 #endif
+          }
         }
       }
 
@@ -1752,6 +1780,46 @@ static void writeXDR( const Arguments* arguments, Data* data ) {
 
 
 
+/******************************************************************************
+PURPOSE: writeFloats - Write values to stdout as MSB IEEE-754 32-bit reals.
+INPUTS:  const double values[ count ]  Values to write.
+         size_t count                  Number of values to write.
+RETURNS: int 1 if successful, else 0.
+NOTES:   Values are converted a buffer at a time so no copy of the data is
+         allocated.
+******************************************************************************/
+
+static int writeFloats( const double values[], size_t count ) {
+
+  PRE2( values, count > 0 );
+
+  int result = 0;
+  float buffer[ 4096 ];
+
+  do {
+    const size_t bufferCount = MIN( count, sizeof buffer / sizeof *buffer );
+    size_t index = 0;
+
+    for ( index = 0; index < bufferCount; ++index ) {
+      buffer[ index ] = values[ index ];
+    }
+
+#if IS_LITTLE_ENDIAN
+    swapBytes4( buffer, bufferCount );
+#endif
+
+    result =
+      fwrite( buffer, sizeof *buffer, bufferCount, stdout ) == bufferCount;
+    values += bufferCount;
+    count  -= bufferCount;
+  } while ( AND2( result, count ) );
+
+  POST( IS_BOOL( result ) );
+  return result;
+}
+
+
+
 /******************************************************************************
 PURPOSE: writeASCII - Write ASCII spreadsheet (tab-separated text values)
          format output of subset to stdout.
@@ -1848,10 +1916,11 @@ static int isValidArguments( const Arguments* arguments ) {
           arguments->description[ 0 ],
           IS_VALID_OUTPUT_FORMAT( arguments->outputFormat ) );
 
-  result = AND4( result,
+  result = AND5( result,
                  isValidTimestamp( arguments->firstTimestamp ),
                  arguments->timesteps > 0,
-                 isValidDomain( arguments->domain ) );
+                 isValidDomain( arguments->domain ),
+                 IS_BOOL( arguments->float32 ) );
 
   POST( IS_BOOL( result ) );
   return result;
@@ -2182,7 +2251,6 @@ static char* readFile( const char* name, size_t* length ) {
 #if IS_LITTLE_ENDIAN
 
 
-#if 0
 
 /******************************************************************************
 PURPOSE: swapBytes4 - Swap byte order of each 4-byte word in the array.
@@ -2211,7 +2279,6 @@ static void swapBytes4( void* array, size_t count ) {
   }
 }
 
-#endif
 
 
 /******************************************************************************
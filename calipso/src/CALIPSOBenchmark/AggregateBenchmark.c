@@ -0,0 +1,279 @@
+/******************************************************************************
+PURPOSE: AggregateBenchmark.c - Measure aggregateCALIPSOData() on synthetic
+         level-2 profiles using one thread then all threads and verify that
+         the results are bit-identical.
+
+NOTES:   To compile: ./makeit
+         Usage: AggregateBenchmark [profiles] [window] [target_levels]
+         Example: AggregateBenchmark 60000 15 100
+         Prints the elapsed seconds of each run and exits with status 1 if the
+         multi-threaded result differs from the single-threaded result.
+
+HISTORY: 2025-04 plessel.todd@epa.gov
+STATUS: inchoate
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <assert.h>   /* For assert(). */
+#include <stdio.h>    /* For stderr, fprintf(), printf(). */
+#include <stdlib.h>   /* For atoi(), malloc(), free(), drand48(). */
+#include <string.h>   /* For memcpy(), memcmp(). */
+#include <sys/time.h> /* For gettimeofday(). */
+
+#ifdef _OPENMP
+#include <omp.h>      /* For omp_get_max_threads(), omp_set_num_threads(). */
+#else
+#define omp_get_max_threads() 1
+#define omp_set_num_threads( unused )
+#endif
+
+#include "Utilities.h" /* For MISSING_VALUE, IN_RANGE(). */
+#include "ReadData.h"  /* For aggregateCALIPSOData(). */
+
+/*================================== TYPES ==================================*/
+
+enum { LEVELS = 583 }; /* Number of levels in CALIPSO L2 profile files. */
+
+/* Variables of each profile: */
+
+enum { TIMESTAMPS, LONGITUDES, LATITUDES, ELEVATIONS, DATA, VARIABLES };
+
+typedef struct {
+  size_t  points;             /* Number of synthetic ground points. */
+  size_t  levels;             /* Number of levels per point. */
+  size_t  window;             /* Number of points to aggregate. */
+  size_t  targetLevels;       /* Number of levels after aggregation. */
+  double* input[ VARIABLES ]; /* Synthetic input arrays. */
+  double* work[  VARIABLES ]; /* Arrays aggregated in-place. */
+  double* expected[ VARIABLES ]; /* Single-threaded results. */
+} Benchmark;
+
+/*=========================== FORWARD DECLARATIONS ==========================*/
+
+static double now( void );
+
+static int allocateBenchmark( Benchmark* const benchmark );
+
+static void deallocateBenchmark( Benchmark* const benchmark );
+
+static void initializeInput( Benchmark* const benchmark );
+
+static double runAggregate( Benchmark* const benchmark, const int threads,
+                            size_t* const subsetPoints,
+                            size_t* const subsetLevels );
+
+/*============================= PUBLIC FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: main - Run the benchmark.
+INPUTS:  int argc      Number of command-line arguments.
+         char* argv[]  [profiles] [window] [target_levels].
+RETURNS: int 0 if all results matched, else 1.
+******************************************************************************/
+
+int main( int argc, char* argv[] ) {
+  int ok = 0;
+  const int profiles     = argc > 1 ? atoi( argv[ 1 ] ) : 60000;
+  const int window       = argc > 2 ? atoi( argv[ 2 ] ) : 15;
+  const int targetLevels = argc > 3 ? atoi( argv[ 3 ] ) : 100;
+
+  if ( ! AND3( IN_RANGE( profiles, 1, 1000000 ),
+               IN_RANGE( window, 2, profiles ),
+               IN_RANGE( targetLevels, 1, LEVELS ) ) ) {
+    fprintf( stderr, "\nusage: %s [profiles] [window] [target_levels]\n",
+             argv[ 0 ] );
+  } else {
+    Benchmark benchmark;
+    memset( &benchmark, 0, sizeof benchmark );
+    benchmark.points = profiles;
+    benchmark.levels = LEVELS;
+    benchmark.window = window;
+    benchmark.targetLevels = targetLevels;
+
+    if ( allocateBenchmark( &benchmark ) ) {
+      const int threads = omp_get_max_threads();
+      size_t points1 = 0;
+      size_t levels1 = 0;
+      size_t points2 = 0;
+      size_t levels2 = 0;
+      double seconds1 = 0.0;
+      double seconds2 = 0.0;
+      int variable = 0;
+      initializeInput( &benchmark );
+      seconds1 = runAggregate( &benchmark, 1, &points1, &levels1 );
+
+      for ( variable = 0; variable < VARIABLES; ++variable ) {
+        const size_t count =
+          variable < ELEVATIONS ? points1 : points1 * levels1;
+        memcpy( benchmark.expected[ variable ], benchmark.work[ variable ],
+                count * sizeof (double) );
+      }
+
+      seconds2 = runAggregate( &benchmark, threads, &points2, &levels2 );
+      ok = AND2( points1 == points2, levels1 == levels2 );
+
+      for ( variable = 0; AND2( ok, variable < VARIABLES ); ++variable ) {
+        const size_t count =
+          variable < ELEVATIONS ? points1 : points1 * levels1;
+        ok = ! memcmp( benchmark.expected[ variable ],
+                       benchmark.work[ variable ], count * sizeof (double) );
+      }
+
+      printf( "aggregateCALIPSOData( %lu x %lu -> %lu x %lu ):\n",
+              benchmark.points, benchmark.levels, points1, levels1 );
+      printf( "  %3d thread(s) %10.3f seconds\n", 1, seconds1 );
+      printf( "  %3d thread(s) %10.3f seconds\n", threads, seconds2 );
+      printf( "%s\n", ok ? "All results identical."
+                         : "MISMATCHED results!" );
+    }
+
+    deallocateBenchmark( &benchmark );
+  }
+
+  return ! ok;
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: now - Wall-clock time in seconds.
+RETURNS: double seconds.
+******************************************************************************/
+
+static double now( void ) {
+  struct timeval tv;
+  gettimeofday( &tv, 0 );
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+
+/******************************************************************************
+PURPOSE: allocateBenchmark - Allocate the arrays of a benchmark.
+INPUTS:  Benchmark* const benchmark  benchmark->points, levels.
+OUTPUTS: Benchmark* const benchmark  benchmark->input, work, expected.
+RETURNS: int 1 if successful, else 0 and a failure message is printed.
+******************************************************************************/
+
+static int allocateBenchmark( Benchmark* const benchmark ) {
+  const size_t points = benchmark->points;
+  const size_t count = points * ( 3 + 2 * benchmark->levels );
+  const size_t bytes = count * 3 * sizeof (double);
+  double* const arrays = malloc( bytes );
+  int result = arrays != 0;
+
+  if ( ! arrays ) {
+    fprintf( stderr, "\a\n\nFailed to allocate %lu bytes "
+             "to complete requested operation.\n", bytes );
+  } else {
+    double* array = arrays;
+    int variable = 0;
+
+    for ( variable = 0; variable < VARIABLES; ++variable ) {
+      const size_t length =
+        variable < ELEVATIONS ? points : points * benchmark->levels;
+      benchmark->input[    variable ] = array, array += length;
+      benchmark->work[     variable ] = array, array += length;
+      benchmark->expected[ variable ] = array, array += length;
+    }
+
+    assert( array == arrays + count * 3 );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: deallocateBenchmark - Deallocate the arrays of a benchmark.
+INPUTS:  Benchmark* const benchmark  Benchmark to deallocate.
+OUTPUTS: Benchmark* const benchmark  benchmark->input, work, expected zeroed.
+******************************************************************************/
+
+static void deallocateBenchmark( Benchmark* const benchmark ) {
+  free( benchmark->input[ 0 ] );
+  memset( benchmark->input,    0, sizeof benchmark->input );
+  memset( benchmark->work,     0, sizeof benchmark->work );
+  memset( benchmark->expected, 0, sizeof benchmark->expected );
+}
+
+
+
+/******************************************************************************
+PURPOSE: initializeInput - Initialize input with synthetic profiles.
+INPUTS:  Benchmark* const benchmark  benchmark->points, levels.
+OUTPUTS: Benchmark* const benchmark  benchmark->input.
+NOTES:   Elevations increase surface-to-sky from a varying surface and about
+         a third of the data is MISSING_VALUE, as after filtering.
+******************************************************************************/
+
+static void initializeInput( Benchmark* const benchmark ) {
+  const size_t points = benchmark->points;
+  const size_t levels = benchmark->levels;
+  size_t point = 0;
+
+  for ( point = 0; point < points; ++point ) {
+    const double surface = 3000.0 * drand48();
+    size_t level = 0;
+    benchmark->input[ TIMESTAMPS ][ point ] = 20060806.0 + point * 1e-6;
+    benchmark->input[ LONGITUDES ][ point ] = -180.0 + point * 1e-3;
+    benchmark->input[ LATITUDES  ][ point ] = -80.0 + point * 1e-3;
+
+    for ( level = 0; level < levels; ++level ) {
+      const size_t index = point * levels + level;
+      benchmark->input[ ELEVATIONS ][ index ] = surface + level * 60.0;
+      benchmark->input[ DATA ][ index ] =
+        drand48() < 1.0 / 3.0 ? MISSING_VALUE : drand48();
+    }
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: runAggregate - Copy input to work and time aggregateCALIPSOData().
+INPUTS:  Benchmark* const benchmark  benchmark->input.
+         const int threads           Number of threads to use.
+OUTPUTS: Benchmark* const benchmark  benchmark->work aggregated.
+         size_t* const subsetPoints  Number of aggregated points.
+         size_t* const subsetLevels  Number of aggregated levels.
+RETURNS: double elapsed seconds of aggregateCALIPSOData().
+******************************************************************************/
+
+static double runAggregate( Benchmark* const benchmark, const int threads,
+                            size_t* const subsetPoints,
+                            size_t* const subsetLevels ) {
+  double result = 0.0;
+  int variable = 0;
+
+  for ( variable = 0; variable < VARIABLES; ++variable ) {
+    const size_t count =
+      variable < ELEVATIONS ? benchmark->points
+      : benchmark->points * benchmark->levels;
+    memcpy( benchmark->work[ variable ], benchmark->input[ variable ],
+            count * sizeof (double) );
+  }
+
+  omp_set_num_threads( threads );
+  result = now();
+  aggregateCALIPSOData( benchmark->points, benchmark->levels,
+                        benchmark->window, benchmark->targetLevels,
+                        benchmark->work[ TIMESTAMPS ],
+                        benchmark->work[ LONGITUDES ],
+                        benchmark->work[ LATITUDES ],
+                        benchmark->work[ ELEVATIONS ],
+                        benchmark->work[ DATA ],
+                        subsetPoints, subsetLevels );
+  result = now() - result;
+  return result;
+}
+
+
@@ -110,8 +110,8 @@ STATUS: inchoate
 #include <unistd.h>   /* For unlink(), getpid() */
 
 #include "Utilities.h"/* For MISSING_VALUE, IN_RANGE(), LONGITUDE, Bounds. */
-#include "ReadFile.h" /* For openFile(), readFileBounds(). */
-#include "ReadData.h" /* For readCALIPSOData(). */
+#include "ReadFile.h" /* For openFile(), readFileBounds(), setFileRows(). */
+#include "ReadData.h" /* For readCALIPSOProfileRange(),readCALIPSOData().*/
 
 /*================================= MACROS =================================*/
 
@@ -492,6 +492,7 @@ static void readData( Data* const data ) {
     int file = 0;
     long long yyyydddhhmm = 0;
     int changedDimensions = 0;
+    size_t rangePoints = 0; /* Number of ground points read. */
 
     readFileInfo( data, fileName, &file, &yyyydddhhmm, &points, &levels,
                   &size, &changedDimensions );
@@ -527,15 +528,30 @@ static void readData( Data* const data ) {
         }
       }
 
+      /*
+       * Find the range of ground points whose track crosses the domain
+       * then read only that slab of the file variables:
+       */
+
       if ( data->ok ) {
+        size_t firstPoint = 0;
         data->ok =
-          readCALIPSOData( file, data->fileType, arguments->variable,
-                           points, levels,
-                           arguments->minimumCAD,
-                           arguments->maximumUncertainty,
-                           data->units,
-                           timestamps, longitudes, latitudes,
-                           elevations, thicknesses, values );
+          readCALIPSOProfileRange( file, data->fileType, points,
+                                   (const double (*)[2]) arguments->domain,
+                                   longitudes, latitudes,
+                                   &firstPoint, &rangePoints );
+
+        if ( data->ok ) {
+          setFileRows( file, points, firstPoint, rangePoints );
+          data->ok =
+            readCALIPSOData( file, data->fileType, arguments->variable,
+                             rangePoints, levels,
+                             arguments->minimumCAD,
+                             arguments->maximumUncertainty,
+                             data->units,
+                             timestamps, longitudes, latitudes,
+                             elevations, thicknesses, values );
+        }
       }
 
       closeFile( file ), file = -1;
@@ -547,7 +563,7 @@ static void readData( Data* const data ) {
           compactPointsInSubset( (const double (*)[2]) arguments->domain,
                                  arguments->elevationRange[ MINIMUM ],
                                  arguments->elevationRange[ MAXIMUM ],
-                                 points, levels,
+                                 rangePoints, levels,
                                  timestamps, longitudes, latitudes,
                                  elevations, values, thicknesses,
                                  &subsetPoints, &subsetLevels );
@@ -11,7 +11,8 @@ STATUS: inchoate
 
 #include <assert.h> /* For assert(). */
 #include <stdio.h>  /* For stderr, fprintf(). */
-#include <string.h> /* For strcmp(), strstr(), strncpy(). */
+#include <stdlib.h> /* For malloc(), free(). */
+#include <string.h> /* For strcmp(), strstr(), strncpy(), memcpy(). */
 
 #include "Utilities.h" /* For MISSING_VALUE, LONGITUDE, IN_RANGE(), Bounds. */
 #include "ReadFile.h"  /* For readFileData(), readFileVData(). */
@@ -204,6 +205,76 @@ int readCALIPSOVariableDimensions( const int file,
 
 
 
+/******************************************************************************
+PURPOSE: readCALIPSOProfileRange - Read CALIPSO ground track and find the
+         contiguous range of ground points (profiles) within domain.
+INPUTS:  const int file             ID of file to read.
+         const int fileType         CALIPSO_L1 ... CALIPSO_L2_VFM.
+         const size_t points        Number of ground points in file.
+         const Bounds domain        Lon-lat domain of subset.
+OUTPUTS: double longitudes[ points ]  Longitudes of all ground points.
+         double latitudes[  points ]  Latitudes  of all ground points.
+         size_t* const firstPoint     Index of first ground point in domain.
+         size_t* const rangePoints    Number of ground points from firstPoint
+                                      to the last ground point in domain.
+RETURNS: int 1 if any ground points are within domain, else 0.
+NOTES:   Used with setFileRows() so readCALIPSOData() reads only the slab of
+         the ground track that crosses domain.
+         Points within the range may still be outside the domain.
+******************************************************************************/
+
+int readCALIPSOProfileRange( const int file, const int fileType,
+                             const size_t points, const Bounds domain,
+                             double longitudes[], double latitudes[],
+                             size_t* const firstPoint,
+                             size_t* const rangePoints ) {
+
+  int result = 0;
+
+  assert( file >= 0 ); assert( IS_CALIPSO( fileType ) ); assert( points );
+  assert( isValidBounds( domain ) ); assert( longitudes ); assert( latitudes );
+  assert( firstPoint ); assert( rangePoints );
+
+  *firstPoint = *rangePoints = 0;
+
+  if ( readCALIPSOCoordinates( file, fileType, points,
+                               longitudes, latitudes ) ) {
+    const double longitudeMinimum = domain[ LONGITUDE ][ MINIMUM ];
+    const double longitudeMaximum = domain[ LONGITUDE ][ MAXIMUM ];
+    const double latitudeMinimum  = domain[ LATITUDE  ][ MINIMUM ];
+    const double latitudeMaximum  = domain[ LATITUDE  ][ MAXIMUM ];
+    size_t point = 0;
+
+    for ( point = 0; point < points; ++point ) {
+      const double longitude = longitudes[ point ];
+      const double latitude  = latitudes[  point ];
+
+      if ( AND2( IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
+                 IN_RANGE( latitude,  latitudeMinimum,  latitudeMaximum ) ) ) {
+
+        if ( ! result ) {
+          *firstPoint = point;
+          result = 1;
+        }
+
+        *rangePoints = point - *firstPoint + 1;
+      }
+    }
+  }
+
+  DEBUG( fprintf( stderr, "readCALIPSOProfileRange: "
+                  "firstPoint = %lu, rangePoints = %lu of %lu\n",
+                  *firstPoint, *rangePoints, points ); )
+
+  assert( IMPLIES_ELSE( result,
+                        AND2( *rangePoints,
+                              *firstPoint + *rangePoints <= points ),
+                        IS_ZERO2( *firstPoint, *rangePoints ) ) );
+  return result;
+}
+
+
+
 /******************************************************************************
 PURPOSE: readCALIPSOData - Read, filter and process CALIPSO data for variable.
 INPUTS:  const int file             ID of file to read.
@@ -336,17 +407,31 @@ void aggregateCALIPSOData( const size_t points,
                     "aggregatePoints = %lu\n",
                     points, window, aggregatePoints ); )
 
-    size_t point = 0;
-    size_t level = 0;
+    const size_t aggregateCount = aggregatePoints * aggregateLevels;
+    const size_t bytes = aggregateCount * 2 * sizeof (double);
+    double* const means = malloc( bytes );
+    double* const meanData       = means ? means : data;
+    double* const meanElevations = means ? means + aggregateCount : elevations;
     size_t index = 0;
-    size_t index2 = 0;
 
-    for ( point = 0, index = 0; point < points; point += window, ++index ) {
+    /*
+     * Aggregate each window of profiles independently (in parallel) into
+     * means then copy back into data and elevations. If means could not be
+     * allocated then aggregate serially in-place which is safe since each
+     * aggregate is written no further than the profiles it was read from.
+     */
+
+    DEBUG( if ( ! means ) fprintf( stderr, "Failed to allocate %lu bytes "
+                                   "so aggregating serially in-place.\n",
+                                   bytes ); )
+
+#pragma omp parallel for if ( means )
+
+    for ( index = 0; index < aggregatePoints; ++index ) {
+      const size_t point = index * window;
       const size_t width = point + window < points ? window : points - point;
-      const size_t middlePoint = point + width / 2;
-      timestamps[ index ] = timestamps[ middlePoint ];
-      longitudes[ index ] = longitudes[ middlePoint ];
-      latitudes[  index ] = latitudes[  middlePoint ];
+      size_t index2 = index * aggregateLevels;
+      size_t level = 0;
 
       for ( level = 0; level < levels; level += levelStride, ++index2 ) {
         const size_t height =
@@ -356,19 +441,37 @@ void aggregateCALIPSOData( const size_t points,
         aggregateDataAndElevations( points, levels, point, level,
                                     width, height, data, elevations,
                                     &meanDatum, &meanElevation );
-        assert( level < levels ); assert( index2 <= points * levels );
-        data[       index2 ] = meanDatum;
-        elevations[ index2 ] = meanElevation;
+        assert( level < levels ); assert( index2 < aggregateCount );
+        meanData[       index2 ] = meanDatum;
+        meanElevations[ index2 ] = meanElevation;
       }
+
+      assert( index2 == ( index + 1 ) * aggregateLevels );
+    }
+
+    if ( means ) {
+      memcpy( data, meanData, aggregateCount * sizeof (double) );
+      memcpy( elevations, meanElevations, aggregateCount * sizeof (double) );
+      free( means );
+    }
+
+    /* Use the timestamp and coordinates of the middle profile of window: */
+
+    for ( index = 0; index < aggregatePoints; ++index ) {
+      const size_t point = index * window;
+      const size_t width = point + window < points ? window : points - point;
+      const size_t middlePoint = point + width / 2;
+      timestamps[ index ] = timestamps[ middlePoint ];
+      longitudes[ index ] = longitudes[ middlePoint ];
+      latitudes[  index ] = latitudes[  middlePoint ];
     }
 
     DEBUG( fprintf( stderr, "aggregatePoints = %lu, aggregateLevels = %lu, "
-                    "levelStride = %lu, index = %lu, index2 = %lu\n",
+                    "levelStride = %lu, index = %lu\n",
                     aggregatePoints, aggregateLevels,
-                    levelStride, index, index2 ); )
+                    levelStride, index ); )
 
     assert( index == aggregatePoints );
-    assert( index2 == aggregatePoints * aggregateLevels );
     *subsetPoints = aggregatePoints;
     *subsetLevels = aggregateLevels;
   }
@@ -642,6 +745,8 @@ static int readCALIPSOCoordinates( const int file, const int fileType,
             copyVectorComponent( points, 3, 1, buffer, latitudes );
           }
         }
+
+        free( buffer ), buffer = 0;
       }
     }
   }
@@ -1300,6 +1405,8 @@ static void copyWorstCADScore( const size_t count, const double input[],
 
   /* Copy the worst component forward: */
 
+#pragma omp parallel for
+
   for ( point = 0; point < points; ++point ) {
     const size_t index = point + point;
     const double score1 = input[ index ];
@@ -1417,6 +1524,10 @@ static void filterDataNearSurface( const size_t points, const size_t levels,
                  "(points = %lu, levels = %lu, elevations = %p, data = %p)\n",
                  points, levels, elevations, data ); )
 
+  /* Each profile is independent so filter them in parallel: */
+
+#pragma omp parallel for
+
   for ( point = 0; point < points; ++point ) {
     const size_t pointOffset = point * levels;
     const double surfaceElevation = elevations[ pointOffset ];
@@ -1566,6 +1677,8 @@ static void propagateBadUncertaintyDownward( const size_t points,
                   "( points = %lu, levels = %lu, uncertainty = %p )\n",
                   points, levels, uncertainty ); )
 
+#pragma omp parallel for
+
   for ( point = 0; point < points; ++point ) {
     const size_t pointOffset = point * levels;
     size_t level = 0;
@@ -1610,6 +1723,8 @@ static void propagateWorstCADScoreDownward( const size_t points,
                   "( points = %lu, levels = %lu, score = %p )\n",
                   points, levels, score ); )
 
+#pragma omp parallel for
+
   for ( point = 0; point < points; ++point ) {
     const size_t pointOffset = point * levels;
     int initialized = 0;
@@ -1674,6 +1789,8 @@ static void propagateWorstQCFlagDownward( const unsigned int mask,
                   "( mask = %x, points = %lu, levels = %lu, qc = %p )\n",
                   mask, points, levels, qc ); )
 
+#pragma omp parallel for
+
   for ( point = 0; point < points; ++point ) {
     const size_t pointOffset = point * levels;
     int initialized = 0;
@@ -1750,6 +1867,8 @@ static size_t filterData( const double dataMinimum, const double dataMaximum,
                   points, levels, qcLevels, qcFlags, qcMinimum, qcMaximum,
                   mask, data ); )
 
+#pragma omp parallel for reduction( + : result )
+
   for ( point = 0; point < points; ++point ) {
     const size_t pointOffset = point * levels;
     size_t level = 0;
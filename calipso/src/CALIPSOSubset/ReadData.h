@@ -52,6 +52,12 @@ extern int readCALIPSOVariableDimensions( const int file,
                                           size_t* const points,
                                           size_t* const levels );
 
+extern int readCALIPSOProfileRange( const int file, const int fileType,
+                                    const size_t points, const Bounds domain,
+                                    double longitudes[], double latitudes[],
+                                    size_t* const firstPoint,
+                                    size_t* const rangePoints );
+
 extern int readCALIPSOData( const int file, const int fileType,
                             const char* const variable,
                             const size_t points, const size_t levels,
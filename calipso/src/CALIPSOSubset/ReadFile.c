@@ -58,10 +58,24 @@ enum {
 #define IS_VALID_TYPE( type ) \
   IN10( type, CHAR, INT8, UINT8, INT16, UINT16, INT32, UINT32, REAL32, REAL64 )
 
+/*
+ * Optional contiguous range of rows (ground points) to read from the file
+ * set by setFileRows(). Applies to variables with rows first dimension:
+ */
+
+static struct {
+  int file;      /* HDF file ID or -1 if reading all rows. */
+  int rows;      /* Number of rows (first dimension) of file variables. */
+  int firstRow;  /* Index of first row to read. */
+  int rowCount;  /* Number of rows to read. */
+} fileRows = { -1, 0, 0, 0 };
+
 /*=========================== FORWARD DECLARATIONS ==========================*/
 
 static size_t dimensionsProduct( const int rank, const int dimensions[] );
 
+static int subsetFileRows( const int file, int dimensions[] );
+
 static int dimsMatch( const int rank,
                      const int dimensions1[], const int dimensions2[] );
 
@@ -114,6 +128,37 @@ int openFile( const char* const fileName ) {
 void closeFile( const int file ) {
   assert( file > -1 );
   SWclose( file );
+
+  if ( file == fileRows.file ) {
+    setFileRows( -1, 0, 0, 0 );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: setFileRows - Set the contiguous range of rows (ground points) to
+         read from subsequent calls to readVariableDimensions() and
+         readFileData() on file until closeFile() or setFileRows( -1, ... ).
+INPUTS:  const int file      HDF file ID or -1 to read all rows of all files.
+         const int rows      Number of rows in the file's variables.
+         const int firstRow  Index of first row to read.
+         const int rowCount  Number of rows to read.
+NOTES:   Variables whose first dimension is rows then appear to have first
+         dimension rowCount and are read starting at firstRow.
+         Other variables are unaffected.
+******************************************************************************/
+
+void setFileRows( const int file, const int rows,
+                  const int firstRow, const int rowCount ) {
+  assert( IMPLIES( file > -1,
+                   AND3( rows > 0,
+                         IN_RANGE( firstRow, 0, rows - 1 ),
+                         IN_RANGE( rowCount, 1, rows - firstRow ) ) ) );
+  fileRows.file     = file;
+  fileRows.rows     = file > -1 ? rows : 0;
+  fileRows.firstRow = file > -1 ? firstRow : 0;
+  fileRows.rowCount = file > -1 ? rowCount : 0;
 }
 
 
@@ -290,6 +335,7 @@ int readVariableDimensions( const int file, const char* const variable,
           int unused3 = 0;
           status =
             SDgetinfo( variableId, 0, rank, dimensions, &type, &unused3 );
+          subsetFileRows( file, dimensions );
 
           if ( OR5( status == -1, ! IN3( *rank, 2, 3), ! IS_VALID_TYPE( type ),
                     dimensions[ 0 ] < 1, dimensions[ *rank - 1 ] < 1 ) ) {
@@ -365,15 +411,17 @@ int readFileData( const int file, const char* const variable,
         int rank0 = 0;
         int dims[ 32 ]; /* UGLY Big enough? */
         int unused3 = 0;
+        int firstRow = 0;
         memset( dims, 0, sizeof dims );
         status = SDgetinfo( variableId, 0, &rank0, dims, &type, &unused3 );
+        firstRow = subsetFileRows( file, dims );
 
         if ( OR4( status == -1, rank0 != rank, ! IS_VALID_TYPE( type ),
                   ! dimsMatch( rank, dims, dimensions ) ) ) {
           fprintf( stderr, "\a\n\nFailed to get valid/matching info on %s.\n",
                    variable );
         } else {
-          const int starts[ 3 ] = { 0, 0, 0 };
+          const int starts[ 3 ] = { firstRow, 0, 0 };
 
           if ( SDreaddata( variableId, starts, 0, dims, data ) == -1 ) {
             fprintf( stderr, "\a\n\nFailed to read '%s'.\n", variable );
@@ -501,6 +549,28 @@ int readFileVData( const int file, const char* const variable,
 
 
 
+/******************************************************************************
+PURPOSE: subsetFileRows - Apply row range set by setFileRows() to dimensions.
+INPUTS:  const int file        HDF file ID of variable.
+         int dimensions[ 1 ]   dimensions[ 0 ] = rows of variable in file.
+OUTPUTS: int dimensions[ 1 ]   dimensions[ 0 ] = rows to read.
+RETURNS: int index of first row to read.
+******************************************************************************/
+
+static int subsetFileRows( const int file, int dimensions[] ) {
+  int result = 0;
+  assert( dimensions );
+
+  if ( AND2( file == fileRows.file, dimensions[ 0 ] == fileRows.rows ) ) {
+    dimensions[ 0 ] = fileRows.rowCount;
+    result = fileRows.firstRow;
+  }
+
+  return result;
+}
+
+
+
 /******************************************************************************
  PURPOSE: dimensionsProduct - Product of dimensions.
  INPUTS:  const int rank                Number of dimensions.
@@ -26,6 +26,9 @@ extern int openFile( const char* const fileName );
 
 extern void closeFile( const int file );
 
+extern void setFileRows( const int file, const int rows,
+                         const int firstRow, const int rowCount );
+
 extern int readFileBounds( const int file, Bounds bounds );
 
 extern int fileVariableExists( const int file, const char* const variable );
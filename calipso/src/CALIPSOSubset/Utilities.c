@@ -225,6 +225,104 @@ void computeBounds( const size_t count,
 
 
 
+/******************************************************************************
+PURPOSE: subsetLevelRange - Compute the range of level indices whose
+         elevations are in the subset elevation range for any ground point in
+         the domain.
+INPUTS:  const Bounds domain                  Domain to subset data to.
+         const double minimumElevation        Minimum elevation in subset.
+         const double maximumElevation        Maximum elevation in subset.
+         const size_t points                  Ground points of data.
+         const size_t levels                  Vertical levels of data.
+         const double longitudes[  points ]           Longitudes.
+         const double latitudes[   points ]           Latitudes.
+         const double elevations[  points * levels ]  Increasing elevations.
+OUTPUTS: size_t* firstLevel  Index of first level in range.
+         size_t* lastLevel   Index of last level in range.
+RETURNS: int 1 if any ground point in the domain has a level in range, else 0.
+NOTES:   Per ground point, the range is from the first level at or above
+         minimumElevation through the last consecutive level at or below
+         maximumElevation (always at least one level). The result is the union
+         of these ranges so it does not depend on which ground points are read.
+******************************************************************************/
+
+static int subsetLevelRange( const Bounds domain,
+                             const double minimumElevation,
+                             const double maximumElevation,
+                             const size_t points,
+                             const size_t levels,
+                             const double longitudes[],
+                             const double latitudes[],
+                             const double elevations[],
+                             size_t* firstLevel,
+                             size_t* lastLevel ) {
+
+  const double longitudeMinimum = domain[ LONGITUDE ][ MINIMUM ];
+  const double longitudeMaximum = domain[ LONGITUDE ][ MAXIMUM ];
+  const double latitudeMinimum  = domain[ LATITUDE  ][ MINIMUM ];
+  const double latitudeMaximum  = domain[ LATITUDE  ][ MAXIMUM ];
+  size_t point = 0;
+  int result = 0;
+
+  assert( isValidBounds( domain ) );
+  assert( minimumElevation <= maximumElevation );
+  assert( points ); assert( levels );
+  assert( longitudes ); assert( latitudes ); assert( elevations );
+  assert( firstLevel ); assert( lastLevel );
+
+  *firstLevel = levels;
+  *lastLevel = 0;
+
+  for ( point = 0; point < points; ++point ) {
+    const double longitude = longitudes[ point ];
+    const double latitude  = latitudes[  point ];
+    const int inDomain =
+      AND2( IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
+            IN_RANGE( latitude,  latitudeMinimum,  latitudeMaximum ) );
+
+    if ( inDomain ) {
+      const double* const pointElevations = elevations + point * levels;
+      size_t level = 0;
+
+      while ( AND2( level < levels,
+                    pointElevations[ level ] < minimumElevation ) ) {
+        ++level;
+      }
+
+      if ( level < levels ) {
+
+        if ( level < *firstLevel ) {
+          *firstLevel = level;
+        }
+
+        do {
+
+          if ( level > *lastLevel ) {
+            *lastLevel = level;
+          }
+
+          ++level;
+        } while ( AND2( level < levels,
+                        pointElevations[ level ] <= maximumElevation ) );
+
+        result = 1;
+      }
+    }
+  }
+
+  if ( ! result ) {
+    *firstLevel = *lastLevel = 0;
+  }
+
+  assert( IS_BOOL( result ) );
+  assert( IMPLIES_ELSE( result,
+                        AND2( *firstLevel <= *lastLevel, *lastLevel < levels ),
+                        AND2( *firstLevel == 0, *lastLevel == 0 ) ) );
+  return result;
+}
+
+
+
 /******************************************************************************
 PURPOSE: compactPointsInSubset - Compact data inside domain and output
          reduced dimensions.
@@ -266,6 +364,8 @@ int compactPointsInSubset( const Bounds domain,
 
   int result = 0;
   size_t level = 0;
+  size_t firstElevationIndex = 0;
+  size_t lastElevationIndex  = 0;
 
   assert( isValidBounds( domain ) );
   assert( isValidElevation( minimumElevation ) );
@@ -279,15 +379,14 @@ int compactPointsInSubset( const Bounds domain,
   *subsetPoints = *subsetLevels = 0;
 
   /*
-   * Every ground point has the same set of elevation values.
-   * Compute elevations levels in subset elevation range:
+   * Elevations vary by ground point (e.g., clamped to the surface elevation)
+   * so compute the elevation levels in the subset elevation range of any
+   * ground point in the domain:
    */
 
-  while ( AND2( level < levels, elevations[ level ] < minimumElevation ) ) {
-    ++level;
-  }
-
-  if ( level < levels ) {
+  if ( subsetLevelRange( domain, minimumElevation, maximumElevation,
+                         points, levels, longitudes, latitudes, elevations,
+                         &firstElevationIndex, &lastElevationIndex ) ) {
     const double longitudeMinimum = domain[ LONGITUDE ][ MINIMUM ];
     const double longitudeMaximum = domain[ LONGITUDE ][ MAXIMUM ];
     const double latitudeMinimum  = domain[ LATITUDE  ][ MINIMUM ];
@@ -296,14 +395,7 @@ int compactPointsInSubset( const Bounds domain,
     size_t index = 0;
     size_t output = 0;
     size_t output2 = 0;
-    size_t firstElevationIndex = level;
-    size_t lastElevationIndex  = level;
-
-    do {
-      lastElevationIndex = level;
-      *subsetLevels += 1;
-      ++level;
-    } while ( AND2( level < levels, elevations[ level ] <= maximumElevation ) );
+    *subsetLevels = lastElevationIndex - firstElevationIndex + 1;
 
     assert( *subsetLevels );
     assert( lastElevationIndex < levels );
@@ -348,8 +440,8 @@ int compactPointsInSubset( const Bounds domain,
           ++output2;
         }
 
-        index += levels - index - 1; /* Skip out-of-bounds levels. */
-        assert( ( index + 1 ) % levels == 0 );
+        index += levels - level; /* Skip out-of-bounds levels. */
+        assert( index % levels == 0 );
       }
     }
   }
@@ -297,6 +297,19 @@ extern unsigned long long ftello64(FILE*);
   : xdr_vector( &(data_)->xdr, (char*) (items_), (count_), sizeof (type_), \
                 (xdrproc_t) xdr_##type_ ) )
 
+/*
+ * On little-endian IEEE platforms, XDR reals are just byte-rotated native
+ * reals so arrays of them are read/written with fread()/fwrite() and (SIMD)
+ * rotate*ByteArrayIfLittleEndian() rather than per-value XDR calls:
+ */
+
+#if IS_LITTLE_ENDIAN && \
+    ( defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) )
+#define USES_ROTATED_XDR(type_) (sizeof (type_) == SIZEOF_XDR_##type_)
+#else
+#define USES_ROTATED_XDR(type_) 0
+#endif
+
 #ifdef MIN
 #undef MIN
 #endif
@@ -1687,7 +1700,12 @@ static void read32BitReals( Stream* self, Real* a, Integer n ) {
 
   ensureReadMode( self );
 
-  if ( IMPLIES_ELSE( USES_NATIVE_XDR(float), isSizet(n), isUnsignedInt(n) ) ) {
+  if ( USES_ROTATED_XDR( float ) ) {
+    Integer bytesRead = 0;
+    readUpToNBytes( self, a, n * 4, &bytesRead );
+    data->ok = bytesRead == n * 4;
+  } else if ( IMPLIES_ELSE( USES_NATIVE_XDR(float),
+                            isSizet(n), isUnsignedInt(n) ) ) {
     data->ok = READ_ITEMS( data, float, n, a );
   } else {
     streamArrayBuffered( self, n, sizeof (float),
@@ -1697,6 +1715,8 @@ static void read32BitReals( Stream* self, Real* a, Integer n ) {
 
   if ( ! data->ok ) {
     *a = 0.0; /* Zero all 8 bytes. */
+  } else if ( USES_ROTATED_XDR( float ) ) {
+    rotateAndExpand32BitValues( a, n ); /* In one (SIMD) pass. */
   } else if ( sizeof (float) != sizeof (Real) || BROKEN_CRAY_XDR ) {
 
     /* Expand floats to Reals (unless they are equivalent, e.g., on Cray): */
@@ -1753,8 +1773,16 @@ static void read64BitReals( Stream* self, Real* a, Integer n ) {
 
   ensureReadMode( self );
 
+  if ( USES_ROTATED_XDR( double ) ) {
+    Integer bytesRead = 0;
+    readUpToNBytes( self, a, n * 8, &bytesRead );
+    data->ok = bytesRead == n * 8;
 
-  if ( IMPLIES_ELSE( USES_NATIVE_XDR(double), isSizet(n), isUnsignedInt(n) )) {
+    if ( data->ok ) {
+      rotate8ByteArrayIfLittleEndian( a, n );
+    }
+  } else if ( IMPLIES_ELSE( USES_NATIVE_XDR(double),
+                            isSizet(n), isUnsignedInt(n) ) ) {
     data->ok = READ_ITEMS( data, double, n, a );
   } else {
     streamArrayBuffered( self, n, sizeof (double),
@@ -2323,6 +2351,11 @@ static void write32BitReals( Stream* self, const Real* a, Integer n ) {
           CHECK2( sizeof (float) == 4, isSizet( itemsToWriteNow ) );
           data->ok = fwrite( copy, sizeof (float), itemsToWriteNow, data->file)
                      == itemsToWriteNow;
+        } else if ( USES_ROTATED_XDR( float ) ) { /* Rotate then fwrite(): */
+          CHECK2( sizeof (float) == 4, isSizet( itemsToWriteNow ) );
+          rotate4ByteArrayIfLittleEndian( copy, itemsToWriteNow );
+          data->ok = fwrite( copy, sizeof (float), itemsToWriteNow, data->file)
+                     == itemsToWriteNow;
         } else {
           /* Must use XDR: */
           CHECK ( isUnsignedInt( itemsToWriteNow ) );
@@ -2388,6 +2421,14 @@ static void write64BitReals( Stream* self, const Real* a, Integer n ) {
       streamArrayBuffered( self, n, sizeof (Real), 0, (void*) a );
     }
 
+  } else if ( USES_ROTATED_XDR( double ) ) {
+
+    /* Write a byte-rotated copy, a buffer at a time: */
+
+    CHECK2( sizeof (Real) == 8, sizeof (Integer) == 8 );
+    writeClampedCopy( self, (const Integer*) a, n, 8, clampTo64BitInteger,
+                      "64-bit reals" );
+
   } else { /* Must use XDR: */
 
     /* If small enough, write data in one call otherwise buffer it: */
@@ -2402,7 +2443,9 @@ static void write64BitReals( Stream* self, const Real* a, Integer n ) {
     }
   }
 
-  checkAndReport( self, "write", n, "64-bit reals" );
+  if ( ! USES_ROTATED_XDR( double ) ) { /* Else writeClampedCopy() did it. */
+    checkAndReport( self, "write", n, "64-bit reals" );
+  }
 
   POST2( isWriteMode( self ),
          IMPLIES( isSeekable( self ),
@@ -3858,9 +3901,24 @@ static void swap8Bytes( Integer* dst, const Integer* src, Integer count ) {
 
   PRE03( dst, src, count > 0 );
 
+#if IS_LITTLE_ENDIAN
+
+  /* Copy then use the (SIMD) in-place rotation: */
+
+  if ( dst != src ) {
+    memcpy( dst, src, count * sizeof *dst );
+  }
+
+  rotate8ByteArrayIfLittleEndian( dst, count );
+
+#else
+
   for ( ; count--; ++src, ++dst ) {
     *dst = swapped8Bytes( *src );
   }
+
+#endif
+
 }
 
 
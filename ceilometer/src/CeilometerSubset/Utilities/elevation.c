@@ -385,7 +385,7 @@ static int readElevationFileHeader( FILE* file, int* rows, int* columns,
 
   *rows = *columns = 0;
   *longitudeMinimum = *longitudeMaximum = 0.0;
-  *latitudeMaximum = *latitudeMaximum = 0.0;
+  *latitudeMinimum = *latitudeMaximum = 0.0;
 
   result = fscanf( file,
                    "%*[^\n]\n"
@@ -405,7 +405,7 @@ static int readElevationFileHeader( FILE* file, int* rows, int* columns,
                    IN_RANGE( *longitudeMinimum, -180.0, 180.0 ),
                    IN_RANGE( *latitudeMinimum, -90.0, 90.0 ),
                    IN_RANGE( *longitudeMaximum, *longitudeMinimum, 180.0 ),
-                   IN_RANGE( *latitudeMaximum, *longitudeMinimum, 90.0 ),
+                   IN_RANGE( *latitudeMaximum, *latitudeMinimum, 90.0 ),
                    OR2( ! strcmp( typeString, "signed" ),
                         ! strcmp( typeString, "IEEE-754" ) ) );
 
@@ -420,7 +420,7 @@ static int readElevationFileHeader( FILE* file, int* rows, int* columns,
                typeString );
       *rows = *columns = 0;
       *longitudeMinimum = *longitudeMaximum = 0.0;
-      *latitudeMaximum = *latitudeMaximum = 0.0;
+      *latitudeMinimum = *latitudeMaximum = 0.0;
     }
   }
 
@@ -24,6 +24,7 @@ STATUS: unreviewed tested
 #include <Mercator.h>        /* For Mercator, newMercator()*/
 #include <Stereographic.h>   /* For Stereographic, newStereographic(). */
 #include <NetCDFUtilities.h> /* For createNetCDFFile(), etc. */
+#include <Cache.h>           /* For readCache(), writeCache(). */
 
 /*================================== TYPES ==================================*/
 
@@ -83,6 +84,39 @@ enum {
 #define ELLIPSOID_MAXIMUM 7e6
 #define DEFAULT_EARTH_RADIUS 6370000.0
 
+/*
+ * Unprojected grid cell coordinates are cached (see XDRConvert Cache.h) so
+ * later runs on the same grid need not unproject each cell corner.
+ * The key is a GridCellCacheKey which holds the kind of points
+ * ("corners" here, "centers" in XDRConvert Grid.c), projection and grid
+ * parameters. The layout matches Grid.c so both programs share the format.
+ * The payload is native longitudes[ rows * columns ] then
+ * latitudes[ rows * columns ].
+ */
+
+#define GRID_CELL_CACHE_KIND "grid_cell_coordinates"
+#define GRID_CELL_CACHE_TAG "grid cell coordinates cache 1.0"
+
+typedef struct {
+  char      tag[ 40 ];         /* GRID_CELL_CACHE_TAG. */
+  char      kind[ 16 ];        /* "centers" or "corners". */
+  char      projection[ 16 ];  /* Projector name. E.g., "Lambert". */
+  double    majorSemiaxis;     /* Of ellipsoid, in meters. */
+  double    minorSemiaxis;     /* Of ellipsoid, in meters. */
+  double    lowerLatitude;     /* Lambert/Albers lower or Stereographic sec.*/
+  double    upperLatitude;     /* Lambert/Albers upper secant latitude. */
+  double    centralLongitude;  /* Projection center longitude. */
+  double    centralLatitude;   /* Projection center latitude. */
+  double    falseEasting;      /* Projected x offset, in meters. */
+  double    falseNorthing;     /* Projected y offset, in meters. */
+  double    xOrigin;           /* Projected west  edge of grid, in meters. */
+  double    yOrigin;           /* Projected south edge of grid, in meters. */
+  double    xCell;             /* Width  of each grid cell,     in meters. */
+  double    yCell;             /* Height of each grid cell,     in meters. */
+  long long columns;           /* Number of points per row. */
+  long long rows;              /* Number of points per column. */
+} GridCellCacheKey;
+
 /* Command-line arguments: */
 
 typedef struct {
@@ -396,6 +430,25 @@ static int checkHTFile( const Data* const data );
 static int checkZFFiles( Data* const data );
 static int checkWWINDFiles( Data* const data );
 static int computeGridCellCoordinates( Data* const data );
+
+static void gridCellCacheKey( const Projector* const projector,
+                              const int columns, const int rows,
+                              const double xorig, const double yorig,
+                              const double xcell, const double ycell,
+                              GridCellCacheKey* const key );
+
+static int readGridCellCache( const Projector* const projector,
+                              const int columns, const int rows,
+                              const double xorig, const double yorig,
+                              const double xcell, const double ycell,
+                              double longitudes[], double latitudes[] );
+
+static void writeGridCellCache( const Projector* const projector,
+                                const int columns, const int rows,
+                                const double xorig, const double yorig,
+                                const double xcell, const double ycell,
+                                const double longitudes[],
+                                const double latitudes[] );
 static int computeGridCellCenterElevations( Data* const data );
 
 static void checkAndFixVerticalGridParameters( const int layers,
@@ -2177,7 +2230,9 @@ static int computeGridCellCoordinates( Data* const data ) {
 
         if ( IS_ZERO2( result, projector ) ) {
           fputs( "\nRead invalid projection parameters.\n", stderr );
-        } else {
+        } else if ( ! readGridCellCache( projector, ncols + 1, nrows + 1,
+                                         xorig, yorig, xcell, ycell,
+                                         data->longitudes, data->latitudes)){
 
           /*
            * Unproject (x, y) grid cell corner points to (longitude, latitude)
@@ -2221,6 +2276,12 @@ static int computeGridCellCoordinates( Data* const data ) {
                                                              ( ncols + 1 ) -1],
                                             data->latitudes[( nrows + 1 ) *
                                                             ( ncols + 1 ) -1]));
+
+          if ( projector ) {
+            writeGridCellCache( projector, ncols + 1, nrows + 1,
+                                xorig, yorig, xcell, ycell,
+                                data->longitudes, data->latitudes );
+          }
         }
 
         data->isProjected = projector != 0;
@@ -2240,6 +2301,148 @@ static int computeGridCellCoordinates( Data* const data ) {
 }
 
 
+/******************************************************************************
+PURPOSE: gridCellCacheKey - Cache key for grid cell corners.
+INPUTS:  const Projector* const projector  Projector of grid.
+         const int columns                 Number of points per row.
+         const int rows                    Number of points per column.
+         const double xorig                Projected west  edge of grid.
+         const double yorig                Projected south edge of grid.
+         const double xcell                Width  of each grid cell.
+         const double ycell                Height of each grid cell.
+OUTPUTS: GridCellCacheKey* const key       Key of cached grid cell corners.
+******************************************************************************/
+
+static void gridCellCacheKey( const Projector* const projector,
+                              const int columns, const int rows,
+                              const double xorig, const double yorig,
+                              const double xcell, const double ycell,
+                              GridCellCacheKey* const key ) {
+
+  PRE06( projector, columns > 0, rows > 0, xcell > 0.0, ycell > 0.0, key );
+
+  const char* const name = projector->name( projector );
+  memset( key, 0, sizeof *key );
+
+  strncpy( key->tag, GRID_CELL_CACHE_TAG, sizeof key->tag - 1 );
+  strncpy( key->kind, "corners", sizeof key->kind - 1 );
+  strncpy( key->projection, name, sizeof key->projection - 1 );
+  projector->ellipsoid( projector, &key->majorSemiaxis, &key->minorSemiaxis );
+
+  if ( ! strcmp( name, "Lambert" ) ) {
+    const Lambert* const lambert = (const Lambert*) projector;
+    key->lowerLatitude = lambert->lowerLatitude( lambert );
+    key->upperLatitude = lambert->upperLatitude( lambert );
+  } else if ( ! strcmp( name, "Albers" ) ) {
+    const Albers* const albers = (const Albers*) projector;
+    key->lowerLatitude = albers->lowerLatitude( albers );
+    key->upperLatitude = albers->upperLatitude( albers );
+  } else if ( ! strcmp( name, "Stereographic" ) ) {
+    const Stereographic* const stereographic =
+      (const Stereographic*) projector;
+    key->lowerLatitude = stereographic->secantLatitude( stereographic );
+  }
+
+  key->centralLongitude = projector->centralLongitude( projector );
+  key->centralLatitude  = projector->centralLatitude( projector );
+  key->falseEasting     = projector->falseEasting( projector );
+  key->falseNorthing    = projector->falseNorthing( projector );
+  key->xOrigin          = xorig;
+  key->yOrigin          = yorig;
+  key->xCell            = xcell;
+  key->yCell            = ycell;
+  key->columns          = columns;
+  key->rows             = rows;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readGridCellCache - Read cached grid cell corner lon-lats if present.
+INPUTS:  const Projector* const projector  Projector of grid or 0 if lon-lat.
+         const int columns                 Number of points per row.
+         const int rows                    Number of points per column.
+         const double xorig                Projected west  edge of grid.
+         const double yorig                Projected south edge of grid.
+         const double xcell                Width  of each grid cell.
+         const double ycell                Height of each grid cell.
+OUTPUTS: double longitudes[ rows * columns ]  Cached longitudes.
+         double latitudes[  rows * columns ]  Cached latitudes.
+RETURNS: int 1 if read, else 0 if there is no valid cache.
+NOTES:   Unprojected (lon-lat) grids are cheap to compute so are not cached.
+******************************************************************************/
+
+static int readGridCellCache( const Projector* const projector,
+                              const int columns, const int rows,
+                              const double xorig, const double yorig,
+                              const double xcell, const double ycell,
+                              double longitudes[], double latitudes[] ) {
+
+  PRE06( columns > 0, rows > 0, xcell > 0.0, ycell > 0.0,
+         longitudes, latitudes );
+
+  int result = 0;
+
+  if ( projector ) {
+    const size_t count = (size_t) columns * rows;
+    GridCellCacheKey key;
+    size_t size = 0;
+    double* coordinates = 0;
+    gridCellCacheKey( projector, columns, rows, xorig, yorig, xcell, ycell,
+                      &key );
+    coordinates = readCache( GRID_CELL_CACHE_KIND, &key, sizeof key, &size );
+    result = AND2( coordinates, size == 2 * count * sizeof (double) );
+
+    if ( result ) {
+      memcpy( longitudes, coordinates, count * sizeof (double) );
+      memcpy( latitudes, coordinates + count, count * sizeof (double) );
+      result = validLongitudesAndLatitudes( count, longitudes, latitudes );
+    }
+
+    free( coordinates ), coordinates = 0;
+  }
+
+  DEBUG( fprintf( stderr, "readGridCellCache() = %d\n", result ); )
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeGridCellCache - Write grid cell corner lon-lats to the cache.
+INPUTS:  const Projector* const projector  Projector of grid.
+         const int columns                 Number of points per row.
+         const int rows                    Number of points per column.
+         const double xorig                Projected west  edge of grid.
+         const double yorig                Projected south edge of grid.
+         const double xcell                Width  of each grid cell.
+         const double ycell                Height of each grid cell.
+         const double longitudes[ rows * columns ]  Longitudes to cache.
+         const double latitudes[  rows * columns ]  Latitudes to cache.
+******************************************************************************/
+
+static void writeGridCellCache( const Projector* const projector,
+                                const int columns, const int rows,
+                                const double xorig, const double yorig,
+                                const double xcell, const double ycell,
+                                const double longitudes[],
+                                const double latitudes[] ) {
+
+  PRE07( projector, columns > 0, rows > 0, xcell > 0.0, ycell > 0.0,
+         longitudes, latitudes );
+
+  const size_t bytes = (size_t) columns * rows * sizeof (double);
+  const void* const payloads[ 2 ] = { longitudes, latitudes };
+  const size_t sizes[ 2 ] = { bytes, bytes };
+  GridCellCacheKey key;
+  gridCellCacheKey( projector, columns, rows, xorig, yorig, xcell, ycell,
+                    &key );
+  writeCache( GRID_CELL_CACHE_KIND, &key, sizeof key, 2, payloads, sizes );
+}
+
+
+
 /******************************************************************************
 PURPOSE: computeGridCellCenterElevations - Compute grid cell center elevations.
 INPUTS:  Data* const data  Data to initialize.
@@ -3,7 +3,7 @@
 PURPOSE: GridSubset.c - Subset and aggregate binary grid surface (*.bin) files.
 NOTES:   Row order is north-to-south (like ESRI ASCII Grid files).
          Compile:
-           cc -DNDEBUG -o GridSubset GridSubset.c
+           cc -DNDEBUG -fopenmp -o GridSubset GridSubset.c
          Run:
            GridSubset input.bin \
                       [-time first_timestep/stamp last_timestep/stamp ] \
@@ -26,6 +26,13 @@ HISTORY: 2011-02-14 plessel.todd@epa.gov Created.
 #include <string.h> /* For memset(). */
 #include <limits.h> /* For ULONG_MAX. */
 
+#ifdef _OPENMP
+#include <omp.h>    /* For omp_get_max_threads(), omp_get_thread_num(). */
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num() 0
+#endif
+
 /*================================== MACROS =================================*/
 
 /* Compile-time assertion: */
@@ -132,6 +139,7 @@ enum { LONGITUDE, LATITUDE };
 enum { COLUMN, ROW };
 enum { FIRST, LAST };            /* 0-based indices. */
 enum { MAXIMUM_TIMESTAMPS = 24 * 366 }; /* Hours in a leap year. */
+enum { MAXIMUM_BAND_BYTES = 256 * 1024 * 1024 }; /* Input rows read at once.*/
 typedef char LongName[ 63 + 1 ];
 typedef char Units[ 15 + 1 ];
 typedef double Bounds[ 2 ][ 2 ]; /* [ LONGITUDE LATITUDE ][MINIMUM MAXIMUM].*/
@@ -176,9 +184,17 @@ static void computeStride( int rows, int columns, int dimension,
                            int* subsetRows, int* subsetColumns, int* size,
                            Range range, Bounds subset );
 
-static void aggregate( int size, int columns, int firstColumn,
+static int bandsPerRead( int bands, size_t bandBytes );
+
+static void aggregate( int bands, int size, int columns, int firstColumn,
                        int outputColumns, int method, int type,
-                       const void* input, void* output );
+                       const void* input, int counts[], void* output );
+
+static int aggregateMode( int size, int columns, const void* input,
+                          int type, int counts[] );
+
+static double aggregateMean( int size, int columns, const void* input,
+                             int type, int* count, int* missingCount );
 
 static int indexOfMaximum( const int array[], int count );
 
@@ -280,23 +296,33 @@ int main( int argc, char* argv[] ) {
           } else {
             const size_t inputDataSize = (size_t) size * columns;
             const size_t outputDataSize = (size_t) subsetColumns;
-            const size_t dataSize = inputDataSize + outputDataSize;
+            const int bands =
+              bandsPerRead( subsetRows, inputDataSize * wordSize );
+            const size_t dataSize =
+              bands * ( inputDataSize + outputDataSize );
             signed char* data = allocate( wordSize, dataSize );
+            const size_t bins = type == UINT16_TYPE ? 65536 : 256;
+            int* counts = /* Per-thread histograms for MODE: */
+              AND2( data, method == MODE ) ?
+                allocate( sizeof (int), omp_get_max_threads() * bins )
+              : 0;
 
             DEBUG( fprintf( stderr,
-                            "inputDataSize = %lu, outputDataSize = %lu\n",
-                            inputDataSize, outputDataSize ); )
+                            "inputDataSize = %lu, outputDataSize = %lu, "
+                            "bands = %d\n",
+                            inputDataSize, outputDataSize, bands ); )
 
-            if ( data ) {
+            if ( AND2( data, IMPLIES( method == MODE, counts ) ) ) {
               const long remainingRows = rows - ( range[ ROW ][ LAST ] + size);
               const long remainingRowBytes =
                 (const long) remainingRows * columns * wordSize;
               const long seekRowBytes =
                 (const long) remainingRowBytes + skipRowBytes;
               signed char* const outputData =
-                data + inputDataSize * wordSize / sizeof (char);
+                data + bands * inputDataSize * wordSize / sizeof (char);
               const int firstColumn = range[ COLUMN ][ FIRST ];
               int row = 0;
+              int bandsRead = 0;
               int timestep = 0;
               const char* const timestepsDimension =
                 timesteps > 1 ? "[timesteps]" : "";
@@ -358,25 +384,31 @@ int main( int argc, char* argv[] ) {
 
               for ( timestep = 0; AND2(ok, timestep < timesteps); ++timestep) {
 
+                /* Read and aggregate up to bands rows of output at once:*/
+
                 for ( row = range[ ROW ][ FIRST ];
                       AND2( ok, row <= range[ ROW ][ LAST ] );
-                      row += size ) {
+                      row += bandsRead * size ) {
+                  const size_t readDataSize =
+                    ( bandsRead =
+                        MIN( bands, 1 + ( range[ ROW ][ LAST ] - row ) / size )
+                    ) * inputDataSize;
                   DEBUG( fprintf( stderr,
                                  "Processing timestep %d, rows [%6d %6d]...\n",
-                                  timestep, row, row + size - 1 ); )
-                  ok = fread( data, inputDataSize * wordSize, 1, inputFile )
+                                  timestep, row, row + bandsRead * size - 1);)
+                  ok = fread( data, readDataSize * wordSize, 1, inputFile )
                        == 1;
 
                   if ( ! ok ) {
                     fprintf( stderr, "Failed to read %lu bytes of row data "
-                             "from file %s ", inputDataSize, inputFileName );
+                             "from file %s ", readDataSize, inputFileName );
                     perror( "because" );
                   } else {
 
                     if ( type == FLOAT_TYPE ) {
-                      rotate4ByteArrayIfLittleEndian( data, inputDataSize );
+                      rotate4ByteArrayIfLittleEndian( data, readDataSize );
                     } else if ( type == UINT16_TYPE ) {
-                      rotate2ByteArrayIfLittleEndian( data, inputDataSize );
+                      rotate2ByteArrayIfLittleEndian( data, readDataSize );
                     }
 
 #ifdef DEBUGGING
@@ -404,18 +436,20 @@ int main( int argc, char* argv[] ) {
                     }
 #endif
 
-                    aggregate( size, columns, firstColumn, subsetColumns,
-                               method, type, data, outputData );
+                    aggregate( bandsRead, size, columns, firstColumn,
+                               subsetColumns, method, type, data, counts,
+                               outputData );
 
                     if ( type == FLOAT_TYPE ) {
                       rotate4ByteArrayIfLittleEndian( outputData,
-                                                      outputDataSize );
+                                                bandsRead * outputDataSize );
                     } else if ( type == UINT16_TYPE ) {
                       rotate2ByteArrayIfLittleEndian( outputData,
-                                                      outputDataSize );
+                                                bandsRead * outputDataSize );
                     }
 
-                    ok = fwrite( outputData, outputDataSize * wordSize, 1,
+                    ok = fwrite( outputData,
+                                 bandsRead * outputDataSize * wordSize, 1,
                                  stdout ) == 1;
                   }
 
@@ -435,9 +469,10 @@ int main( int argc, char* argv[] ) {
                   }
                 }
               } /* Next timestep. */
-
-              FREE( data );
             }
+
+            FREE( counts );
+            FREE( data );
           }
         }
       }
@@ -1292,144 +1327,237 @@ static void computeStride( int rows, int columns, int dimension,
 
 
 /******************************************************************************
-PURPOSE: aggregate - Aggregates a set of row data.
-INPUTS:  int size           Number of input rows / columns to aggregate.
+PURPOSE: bandsPerRead - Number of bands of input rows to read and aggregate
+         at once.
+INPUTS:  int bands         Number of bands (aggregated output rows) in subset.
+         size_t bandBytes  Bytes per band of input rows.
+RETURNS: int number of bands per read, at least 1.
+NOTES:   One band per thread, limited to MAXIMUM_BAND_BYTES of input.
+******************************************************************************/
+
+static int bandsPerRead( int bands, size_t bandBytes ) {
+  const int threads = omp_get_max_threads();
+  const size_t limit = MAXIMUM_BAND_BYTES / ( bandBytes ? bandBytes : 1 );
+  const int result =
+    MAX( 1, MIN( MIN( threads, bands ), (int) MIN( limit, INT_MAX ) ) );
+  assert( bands > 0 );
+  assert( result >= 1 );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: aggregate - Aggregates bands of row data.
+INPUTS:  int bands          Number of bands (output rows) to aggregate.
+         int size           Number of input rows / columns to aggregate.
          int columns        Number of input columns.
          int firstColumn    0-based index of first column to aggregate.
          int outputColumns  Number of aggregated output columns.
          int method         MEAN or MODE.
          int type           BYTE_TYPE, FLOAT_TYPE, etc.
-         const void* input  Row data input[ size * columns ] to aggregate.
-OUTPUTS: void* output       Aggregated output[ size ] data row.
-NOTES:   Not thread-safe due to use of static variables.
+         const void* input  Row data input[ bands ][ size * columns ].
+         int counts[]       If MODE, zeroed histograms [ threads ][ bins ].
+OUTPUTS: void* output       Aggregated output[ bands ][ outputColumns ] rows.
+         int counts[]       Zeroed histograms.
+NOTES:   Output cells are aggregated in parallel.
 ******************************************************************************/
 
-static void aggregate( int size, int columns, int firstColumn,
+static void aggregate( int bands, int size, int columns, int firstColumn,
                        int outputColumns, int method, int type,
-                       const void* input, void* output ) {
+                       const void* input, int counts[], void* output ) {
 
-  const signed char* const cinput = input;
-  signed char* const coutput = output;
-  const unsigned short* const sinput = input;
-  unsigned short* const soutput = output;
-  const float* finput = input;
-  float* const foutput = output;
-  int startColumn = firstColumn;
-  int outputColumn = 0;
-  int counts[ 256 ];
-  static int scounts[ 65536 ]; /* static because too large for the stack. */
-  memset( counts, 0, sizeof counts );
-
-  assert( size > 0 ); assert( columns > 0 );
+  const int cells = bands * outputColumns;
+  const size_t wordSize = WORD_SIZE( type );
+  const size_t bandSize = (size_t) size * columns;
+  const int bins = type == UINT16_TYPE ? 65536 : 256;
+  int cell = 0;
+
+  assert( bands > 0 ); assert( size > 0 ); assert( columns > 0 );
   assert( IN_RANGE( firstColumn, 0, columns - 1 ) );
   assert( IN_RANGE( outputColumns, 1, columns ) );
   assert( IN3( method, MEAN, MODE ) );
   assert( IS_VALID_TYPE( type ) );
   assert( IMPLIES( method == MODE, type != FLOAT_TYPE ) );
-  assert( input ); assert( output );
+  assert( input ); assert( IMPLIES( method == MODE, counts ) );
+  assert( output );
 
-  DEBUG( fprintf( stderr, "aggregate: size = %d, columns = %d, "
+  DEBUG( fprintf( stderr, "aggregate: bands = %d, size = %d, columns = %d, "
                   "firstColumn = %d, outputColumns = %d, method = %d, "
                   "type = %d\n",
-                  size, columns, firstColumn, outputColumns, method, type);)
-
-  for ( outputColumn = 0; outputColumn < outputColumns;
-        ++outputColumn, startColumn += size ) {
-    int row = 0;
-    int missingCount = 0;
-    int count = 0;
-    double mean = 0.0;
-
-    if ( method == MODE ) {
-
-      if ( type == UINT16_TYPE ) {
-        memset( scounts, 0, sizeof scounts );
-      } else {
-        memset( counts, 0, sizeof counts );
-      }
-    }
-
-    for ( row = 0; row < size; ++row ) {
-      const int endColumn = startColumn + size;
-      const int rowOffset = row * columns;
-      int column = 0;
-
-      for ( column = startColumn; column < endColumn; ++column ) {
-        const int index = rowOffset + column;
-        const signed char cvalue = type == BYTE_TYPE ? cinput[ index ] : 0;
-        const unsigned short svalue = type == UINT16_TYPE ? sinput[ index] : 0;
-        const float fvalue = type == FLOAT_TYPE ? finput[ index ] : 0.0;
-
-        DEBUG2( fprintf( stderr, "input[%d] = (%d, %d, %f)\n",
-                         index, cvalue, svalue, fvalue ); )
-
-        if ( method == MODE ) {
+                  bands, size, columns, firstColumn, outputColumns,
+                  method, type ); )
 
-          if ( type == UINT16_TYPE ) {
-            const int valueIndex = svalue;
-            assert( IN_RANGE( valueIndex, 0, 65535 ) );
-            scounts[ valueIndex ] += 1;
-          } else {
-            const unsigned char valueIndex = (unsigned char) cvalue;
-            assert( type == BYTE_TYPE );
-            counts[ valueIndex ] += 1;
-          }
-        } else {
-          assert( method == MEAN );
+#pragma omp parallel for schedule( dynamic, 64 )
 
-          if ( cvalue == MISSING || fvalue == F_MISSING ||
-               ( type == UINT16_TYPE && svalue == 0 ) ) { /* 0 = missing. */
-            ++missingCount;
-          } else {
-            const float value =
-              type == BYTE_TYPE ? cvalue
-              : type == UINT16_TYPE ? svalue
-              : fvalue;
-            const int count1 = count + 1;
-            mean = ( count * mean + value ) / count1;
-            count = count1;
-          }
-        }
-      } /* for column. */
-    } /* for row. */
+  for ( cell = 0; cell < cells; ++cell ) {
+    const int band = cell / outputColumns;
+    const int outputColumn = cell % outputColumns;
+    const size_t startColumn = firstColumn + (size_t) outputColumn * size;
+    const void* const cellInput =
+      (const char*) input + ( band * bandSize + startColumn ) * wordSize;
 
     if ( method == MODE ) {
+      int* const threadCounts =
+        counts + (size_t) omp_get_thread_num() * bins;
+      const int mode =
+        aggregateMode( size, columns, cellInput, type, threadCounts );
 
       if ( type == UINT16_TYPE ) {
-        const int mode =
-          indexOfMaximum( scounts, sizeof scounts / sizeof *scounts );
         assert( IN_RANGE( mode, 0, 65535 ) );
-        soutput[ outputColumn ] = mode;
+        ( (unsigned short*) output )[ cell ] = mode;
       } else {
-        const int mode =
-          indexOfMaximum( counts, sizeof counts / sizeof *counts );
         assert( type == BYTE_TYPE );
-        coutput[ outputColumn ] = mode;
+        ( (signed char*) output )[ cell ] = mode;
       }
     } else {
+      int count = 0;
+      int missingCount = 0;
+      const double mean =
+        aggregateMean( size, columns, cellInput, type, &count, &missingCount);
       DEBUG2( fprintf( stderr, "mean = %lf, count = %d, missingCount = %d\n",
                        mean, count, missingCount ); )
       assert( method == MEAN );
 
       if ( type == FLOAT_TYPE ) {
-        foutput[ outputColumn ] = missingCount > count ? F_MISSING : mean;
+        ( (float*) output )[ cell ] = missingCount > count ? F_MISSING : mean;
       } else if ( type == UINT16_TYPE ) {
         const int m = missingCount > count ? 0 : (int) ( mean + 0.5 );
         assert( IN_RANGE( m, 0, 65535 ) );
-        soutput[ outputColumn ] = m;
+        ( (unsigned short*) output )[ cell ] = m;
       } else {
         const int m = missingCount > count ? MISSING : (int) ( mean + 0.5 );
         assert( type == BYTE_TYPE );
-        coutput[ outputColumn ] = m;
+        ( (signed char*) output )[ cell ] = m;
+      }
+    }
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: aggregateMode - Most frequent value of a size x size cell.
+INPUTS:  int size           Number of input rows / columns of cell.
+         int columns        Number of input columns (row stride).
+         const void* input  First value of cell in BYTE_TYPE or UINT16_TYPE.
+         int type           BYTE_TYPE or UINT16_TYPE.
+         int counts[]       Zeroed histogram[ 256 or 65536 ].
+OUTPUTS: int counts[]       Zeroed histogram.
+RETURNS: int smallest (unsigned) value with the largest count.
+NOTES:   Small cells only visit and re-zero the bins of their own values
+         rather than clearing and scanning the whole histogram.
+******************************************************************************/
+
+static int aggregateMode( int size, int columns, const void* input,
+                          int type, int counts[] ) {
+
+  const signed char* const cinput = input;
+  const unsigned short* const sinput = input;
+  const int bins = type == UINT16_TYPE ? 65536 : 256;
+  const int scan = (long long) size * size >= bins;
+  int result = 0;
+  int maximum = 0;
+  int pass = 0;
+
+  assert( size > 0 ); assert( columns >= size ); assert( input );
+  assert( IN3( type, BYTE_TYPE, UINT16_TYPE ) ); assert( counts );
+
+  /* Pass 0 counts values, pass 1 finds the mode and re-zeroes the bins: */
+
+  for ( pass = 0; pass < 2 - scan; ++pass ) {
+    int row = 0;
+
+    for ( row = 0; row < size; ++row ) {
+      const size_t rowOffset = (size_t) row * columns;
+      int column = 0;
+
+      for ( column = 0; column < size; ++column ) {
+        const int value =
+          type == UINT16_TYPE ? sinput[ rowOffset + column ]
+          : (unsigned char) cinput[ rowOffset + column ];
+        assert( IN_RANGE( value, 0, bins - 1 ) );
+
+        if ( pass == 0 ) {
+          counts[ value ] += 1;
+        } else {
+          const int count = counts[ value ];
+          counts[ value ] = 0;
+
+          if ( count > maximum || AND2( count == maximum, value < result ) ) {
+            maximum = count;
+            result = value;
+          }
+        }
       }
     }
+  }
 
-    DEBUG2( fprintf( stderr, "output[%d] = (%d, %d, %f)\n",
-                     outputColumn,
-                     coutput[ outputColumn ],
-                     soutput[ outputColumn ],
-                     foutput[ outputColumn ] ); )
+  if ( scan ) { /* Large cell so scan then clear the whole histogram: */
+    result = indexOfMaximum( counts, bins );
+    memset( counts, 0, bins * sizeof *counts );
   }
+
+  assert( IN_RANGE( result, 0, bins - 1 ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: aggregateMean - Mean of non-missing values of a size x size cell.
+INPUTS:  int size           Number of input rows / columns of cell.
+         int columns        Number of input columns (row stride).
+         const void* input  First value of cell.
+         int type           BYTE_TYPE, UINT16_TYPE or FLOAT_TYPE.
+OUTPUTS: int* count         Number of non-missing values.
+         int* missingCount  Number of missing values.
+RETURNS: double mean of non-missing values.
+******************************************************************************/
+
+static double aggregateMean( int size, int columns, const void* input,
+                             int type, int* count, int* missingCount ) {
+
+  const signed char* const cinput = input;
+  const unsigned short* const sinput = input;
+  const float* const finput = input;
+  double result = 0.0;
+  int row = 0;
+
+  assert( size > 0 ); assert( columns >= size ); assert( input );
+  assert( IS_VALID_TYPE( type ) ); assert( count ); assert( missingCount );
+
+  *count = *missingCount = 0;
+
+  for ( row = 0; row < size; ++row ) {
+    const size_t rowOffset = (size_t) row * columns;
+    int column = 0;
+
+    for ( column = 0; column < size; ++column ) {
+      const size_t index = rowOffset + column;
+      const signed char cvalue = type == BYTE_TYPE ? cinput[ index ] : 0;
+      const unsigned short svalue = type == UINT16_TYPE ? sinput[ index ] : 0;
+      const float fvalue = type == FLOAT_TYPE ? finput[ index ] : 0.0;
+
+      DEBUG2( fprintf( stderr, "input[%lu] = (%d, %d, %f)\n",
+                       index, cvalue, svalue, fvalue ); )
+
+      if ( cvalue == MISSING || fvalue == F_MISSING ||
+           ( type == UINT16_TYPE && svalue == 0 ) ) { /* 0 = missing. */
+        ++*missingCount;
+      } else {
+        const float value =
+          type == BYTE_TYPE ? cvalue
+          : type == UINT16_TYPE ? svalue
+          : fvalue;
+        const int count1 = *count + 1;
+        result = ( *count * result + value ) / count1;
+        *count = count1;
+      }
+    }
+  }
+
+  return result;
 }
 
 
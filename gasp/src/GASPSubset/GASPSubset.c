@@ -39,10 +39,18 @@ STATUS: unreviewed, tested.
 /*================================ INCLUDES =================================*/
 
 #include <stdio.h>     /* For printf(). */
-#include <string.h>    /* For strlen(). */
+#include <string.h>    /* For strlen(), strncpy(). */
+#include <errno.h>     /* For errno. */
 #include <ctype.h>     /* For isdigit(). */
 
+#ifdef _OPENMP
+#include <omp.h>       /* For omp_get_max_threads(). */
+#else
+#define omp_get_max_threads() 1
+#endif
+
 #include <Utilities.h> /* For PRE0*(), NEW_ZERO(), Stream, VoidList, etc. */
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
 
 /* Z Library routines used (simply prototyped): */
 
@@ -69,6 +77,10 @@ static const Integer timestampWithSCA = 20101230000;
 
 static Real longitudesLatitudes[ 2 ][ ROWS ][ COLUMNS ]; /* Read from file. */
 
+/* 1 if longitudesLatitudes is within bounds. Computed once, used per scan: */
+
+static unsigned char inBounds[ ROWS ][ COLUMNS ];
+
 /* For -daily option: */
 
 static Integer counts[ ROWS ][ COLUMNS ];
@@ -215,6 +227,28 @@ static Integer isValidSubsettedScan( const SubsettedScan* subsettedScan ) {
 
 
 
+/*
+ * GASPFile: A listed GASP file and its uncompressed bytes.
+ * Batches of these are decompressed in parallel then decoded in file order.
+ * At most MAXIMUM_PARALLEL_READS since each byte array is large.
+ */
+
+enum { MAXIMUM_PARALLEL_READS = 4 };
+
+typedef unsigned char ByteData[ VARIABLES ][ ROWS ][ COLUMNS ];
+
+typedef struct {
+  FileName  fileName;     /* Name of GASP file. */
+  Integer   timestamp;    /* YYYYDDDHHMM of file name or 0 if invalid. */
+  Integer   ok;           /* Were all bytes read? */
+  Integer   bytesToRead;  /* Uncompressed bytes expected or 0 if not opened.*/
+  int       errnoCopy;    /* errno when the file failed to open or read. */
+  char      reason[ 80 ]; /* gzerror() message if bytes were not read. */
+  ByteData* byteData;     /* Uncompressed bytes of file. */
+} GASPFile;
+
+
+
 /* Data type: */
 
 typedef struct {
@@ -312,8 +346,15 @@ static void readData( Data* data );
 
 static void appendDailyMeans( const Integer yyyyddd0000, Data* data );
 
-static Integer readGASPFile( const char* fileName, const Integer indices[2][2],
-                             Scan* scan );
+static void readGASPFile( GASPFile* gaspFile );
+
+static void reportGASPFileError( const GASPFile* gaspFile );
+
+static void decodeGASPData( const Integer timestamp,
+                            const Integer indices[ 2 ][ 2 ],
+                            const unsigned char
+                              byteData[ VARIABLES ][ ROWS ][ COLUMNS ],
+                            Scan* scan );
 
 static Integer timestampOfFileName( const char* fileName );
 
@@ -335,6 +376,9 @@ static Integer subsetIndicesByBounds( const Bounds bounds,
                                       Integer* firstColumn,
                                       Integer* lastColumn );
 
+static void computeInBounds( const Bounds bounds,
+                             const Integer indices[ 2 ][ 2 ] );
+
 static void subsetIndicesByMask( const Real msk[ ROWS ][ COLUMNS ],
                                  Integer* firstRow, Integer* lastRow,
                                  Integer* firstColumn, Integer* lastColumn );
@@ -418,6 +462,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   Integer ok = 0;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     failureMessage( "Invalid command-line arguments." );
@@ -436,8 +482,11 @@ int main( int argc, char* argv[] ) {
                                &data.indices[ COLUMN ][ MAXIMUM ] );
 
       if ( data.ok ) {
+        computeInBounds( (const Real (*)[2]) data.arguments.bounds,
+                         (const Integer (*)[2]) data.indices );
 
         if ( data.arguments.corners ) {
+          timingStage( "corners" );
           DEBUG( fprintf( stderr, "calling computeCorners()...\n" ); )
           computeCorners( ROWS, COLUMNS,
                           &longitudesLatitudes[ LONGITUDE ][ 0 ][ 0 ],
@@ -446,9 +495,11 @@ int main( int argc, char* argv[] ) {
           DEBUG( fprintf( stderr, "finished computeCorners().\n" ); )
         }
 
+        timingStage( "read" );
         readData( &data ); /* From list file named in arguments. */
 
         if ( data.ok ) {
+          timingStage( "write" );
           writeData( &data ); /* To stdout. */
         }
       }
@@ -458,6 +509,7 @@ int main( int argc, char* argv[] ) {
     deallocateData( &data );
   }
 
+  timingReport();
   ok = AND2( ok, failureCount() == 0 );
   POST0( IS_BOOL( ok ) );
   return ! ok;
@@ -973,34 +1025,87 @@ static void readData( Data* data ) {
          data->scan.timestamp == 0, data->subsettedScans == 0 );
 
   Stream* listFile = newFileStream( data->arguments.listFile, "r" );
+  const Integer batchSize =
+    CLAMPED_TO_RANGE( omp_get_max_threads(), 1, MAXIMUM_PARALLEL_READS );
+  GASPFile* gaspFiles = NEW_ZERO( GASPFile, batchSize );
+  ByteData* byteData = /* Additional byte arrays for parallel reads. */
+    AND2( gaspFiles, batchSize > 1 ) ? NEW( ByteData, batchSize - 1 ) : 0;
   Integer yyyyddd = 0;
   data->ok = 0;
 
-  if ( listFile ) {
+  if ( AND3( listFile, gaspFiles, IMPLIES( batchSize > 1, byteData ) ) ) {
     const Integer firstTimestamp = data->arguments.firstTimestamp;
     const Integer lastTimestamp =
       offsetTimestamp( firstTimestamp, data->arguments.hours );
     Integer previousTimestamp = 0;
+    Integer index = 0;
 
-    /* For each GASP file, read it into scan, subset scan and append to list:*/
+    for ( index = 0; index < batchSize; ++index ) {
+      gaspFiles[ index ].byteData =
+        index == 0 ? &data->scan.byteData : byteData + index - 1;
+    }
+
+    /*
+     * For each batch of listed GASP files,
+     *   decompress the files in parallel, then in file order:
+     *   decode into scan, subset scan and append to list:
+     */
 
     do {
-      FileName fileName = "";
-      listFile->readWord( listFile, fileName,
-                          sizeof fileName / sizeof *fileName );
+      Integer count = 0;
+
+      do { /* List the next batch of files: */
+        GASPFile* const gaspFile = gaspFiles + count;
+        char newline[ 2 ] = "";
+        memset( gaspFile->fileName, 0, sizeof gaspFile->fileName );
+        listFile->readWord( listFile, gaspFile->fileName,
+                            sizeof gaspFile->fileName /
+                            sizeof *gaspFile->fileName );
+
+        if ( listFile->ok( listFile ) ) {
+          DEBUG( fprintf( stderr, "listing GASP file %s\n",
+                          gaspFile->fileName ); )
+          gaspFile->timestamp = timestampOfFileName( gaspFile->fileName );
+          gaspFile->ok = 0;
+          ++count;
+        }
+
+        listFile->readString( listFile, newline, 2 ); /* Read '\n'. */
+      } while ( AND2( count < batchSize, ! listFile->isAtEnd( listFile ) ) );
+
+      /* Decompress the batch of files in parallel: */
 
-      if ( listFile->ok( listFile ) ) {
-        const Integer currentTimestamp = timestampOfFileName( fileName );
-        DEBUG( fprintf( stderr, "listing GASP file %s\n", fileName ); )
+#pragma omp parallel for schedule( dynamic )
+
+      for ( index = 0; index < count; ++index ) {
+        GASPFile* const gaspFile = gaspFiles + index;
+
+        if ( IN_RANGE( gaspFile->timestamp, firstTimestamp, lastTimestamp ) ) {
+          readGASPFile( gaspFile );
+        }
+      }
+
+      /* Decode and process the scans in file order: */
+
+      for ( index = 0; index < count; ++index ) {
+        const GASPFile* const gaspFile = gaspFiles + index;
+        const Integer currentTimestamp = gaspFile->timestamp;
 
         if ( ! AND2( currentTimestamp > 0,
                      IMPLIES( previousTimestamp,
                               currentTimestamp > previousTimestamp ) ) ) {
-          failureMessage( "Invalid/unordered GASP file %s.", fileName );
+          failureMessage( "Invalid/unordered GASP file %s.",
+                          gaspFile->fileName );
         } else if (IN_RANGE(currentTimestamp, firstTimestamp, lastTimestamp)) {
 
-          if ( readGASPFile( fileName, (const Integer (*)[2]) data->indices,
-                             &data->scan ) ) {
+          if ( ! gaspFile->ok ) {
+            reportGASPFileError( gaspFile );
+          } else {
+            decodeGASPData( currentTimestamp,
+                            (const Integer (*)[2]) data->indices,
+                            (const unsigned char (*)[ ROWS ][ COLUMNS ])
+                              *gaspFile->byteData,
+                            &data->scan );
 
             if ( data->arguments.daily ) {
               const int scanDay = data->scan.timestamp / 10000;
@@ -1055,12 +1160,13 @@ static void readData( Data* data ) {
         }
       }
 
-      listFile->readString( listFile, fileName, 2 ); /* Read '\n'. */
     } while ( ! listFile->isAtEnd( listFile ) );
-
-    FREE_OBJECT( listFile );
   }
 
+  FREE( gaspFiles );
+  FREE( byteData );
+  FREE_OBJECT( listFile );
+
   if ( data->ok ) {
 
     if ( data->arguments.daily ) {
@@ -1179,20 +1285,98 @@ static void appendDailyMeans( const Integer yyyyddd0000, Data* data ) {
 
 
 /******************************************************************************
-PURPOSE: readGASPFile - Read and decode a subset of scan data from GASP file.
-INPUTS:  const char* fileName  Name of compressed GASP file to read.
+PURPOSE: readGASPFile - Read uncompressed bytes of GASP file.
+INPUTS:  GASPFile* gaspFile  gaspFile->fileName   Name of compressed GASP file.
+                             gaspFile->timestamp  YYYYDDDHHMM of file.
+OUTPTUS: GASPFile* gaspFile  gaspFile->byteData   Uncompressed byte data.
+                             gaspFile->ok  1 if all bytes were read, else 0
+                             and bytesToRead, errnoCopy, reason say why.
+NOTES:   Called in parallel so each call must have its own byteData and
+         failureMessage() is not called. See reportGASPFileError().
+******************************************************************************/
+
+static void readGASPFile( GASPFile* gaspFile ) {
+
+  PRE03( gaspFile, isValidTimestamp( gaspFile->timestamp ),
+         gaspFile->byteData );
+
+  void* inputFile = gzopen( gaspFile->fileName, "rb" );
+
+  DEBUG( fprintf( stderr, "Reading GASP file %s\n", gaspFile->fileName ); )
+
+  gaspFile->ok = 0;
+  gaspFile->bytesToRead = 0;
+  gaspFile->errnoCopy = errno;
+  memset( gaspFile->reason, 0, sizeof gaspFile->reason );
+
+  if ( inputFile ) {
+    const Integer sizeOfVariable = sizeof (ByteData) / VARIABLES;
+    const Integer bytesToRead =
+      sizeof (ByteData) -
+      sizeOfVariable * ( gaspFile->timestamp < timestampWithSCA );
+    const Integer bytesRead = /* The most time-consuming routine: gzread().*/
+      gzread( inputFile, &(*gaspFile->byteData)[0][0][0], bytesToRead );
+    gaspFile->bytesToRead = bytesToRead;
+    gaspFile->ok = bytesRead == bytesToRead;
+
+    if ( ! gaspFile->ok ) {
+      int unused = 0;
+      gaspFile->errnoCopy = 0; /* reason says why. */
+      strncpy( gaspFile->reason, gzerror( inputFile, &unused ),
+               sizeof gaspFile->reason / sizeof *gaspFile->reason - 1 );
+    }
+
+    gzclose( inputFile ), inputFile = 0;
+  }
+
+  DEBUG( fprintf( stderr, "%lld\n", gaspFile->ok ); )
+  POST0( IS_BOOL( gaspFile->ok ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: reportGASPFileError - Report why a GASP file was not read.
+INPUTS:  const GASPFile* gaspFile  File not read by readGASPFile().
+NOTES:   Calls failureMessage().
+******************************************************************************/
+
+static void reportGASPFileError( const GASPFile* gaspFile ) {
+
+  PRE02( gaspFile, ! gaspFile->ok );
+
+  errno = gaspFile->errnoCopy;
+
+  if ( gaspFile->bytesToRead == 0 ) {
+    failureMessage( "Failed to open GASP file %s for reading.",
+                    gaspFile->fileName );
+  } else {
+    failureMessage( "Failed to read %lld bytes from GASP file %s "
+                    "because %s.",
+                    gaspFile->bytesToRead, gaspFile->fileName,
+                    gaspFile->reason );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: decodeGASPData - Decode a subset of scan data from GASP file bytes.
+INPUTS:  const Integer timestamp  YYYYDDDHHMM of GASP file.
          const indices[ 2 ][ 2 ]  Subset indices[ROW COLUMN][MINIMUM MAXIMUM].
+         const unsigned char byteData[ VARIABLES ][ ROWS ][ COLUMNS ]
+                                  Uncompressed byte data.
 OUTPTUS: Scan* scan  scan->timestamp  YYYYDDDHHMM of file
-                     scan->byteData[ VARIABLES ][ ROWS ][ COLUMNS ]
-                       uncompressed byte data
                      scan->data[ VARIABLES ][ ROWS ][ COLUMNS ] decoded data.
-RETURNS: Integer 1 if successful, else 0 and failureMessage() is called.
 ******************************************************************************/
 
-static Integer readGASPFile( const char* fileName, const Integer indices[2][2],
-                             Scan* scan ) {
+static void decodeGASPData( const Integer timestamp,
+                            const Integer indices[ 2 ][ 2 ],
+                            const unsigned char
+                              byteData[ VARIABLES ][ ROWS ][ COLUMNS ],
+                            Scan* scan ) {
 
-  PRE07( fileName,
+  PRE08( timestamp > 0,
          indices,
          IN_RANGE( indices[ ROW    ][ MINIMUM ], 0, ROWS - 1 ),
          IN_RANGE( indices[ ROW    ][ MAXIMUM ],
@@ -1200,121 +1384,80 @@ static Integer readGASPFile( const char* fileName, const Integer indices[2][2],
          IN_RANGE( indices[ COLUMN ][ MINIMUM ], 0, COLUMNS - 1 ),
          IN_RANGE( indices[ COLUMN ][ MAXIMUM ],
                    indices[ COLUMN ][ MINIMUM ], COLUMNS - 1 ),
-         scan );
-
-  Integer result = 0;
-  void* inputFile = gzopen( fileName, "rb" );
-  int unused = 0;
-
-  DEBUG( fprintf( stderr, "Reading GASP file %s [%lld %lld] [%lld %lld]\n",
-                  fileName,
-                  indices[ ROW ][ MINIMUM ], indices[ ROW ][ MAXIMUM ],
-                  indices[ COLUMN ][ MINIMUM ], indices[ COLUMN ][ MAXIMUM ]);)
-
-  if ( ! inputFile ) {
-    failureMessage( "Failed to open GASP file %s for reading because %s.",
-                    fileName, gzerror( inputFile, &unused ) );
-  } else {
-    const Integer yyyydddhhmmss = timestampOfFileName( fileName );
-    Integer ok = 0;
-
-    if ( isValidTimestamp( yyyydddhhmmss ) ) {
-      const Integer sizeOfVariable = sizeof scan->byteData / VARIABLES;
-      const Integer bytesToRead =
-        sizeof scan->byteData -
-        sizeOfVariable * ( yyyydddhhmmss < timestampWithSCA );
-      const Integer bytesRead = /* The most time-consuming routine: gzread().*/
-        gzread( inputFile, &scan->byteData[0][0][0], bytesToRead );
-      ok = bytesRead == bytesToRead;
-
-      if ( ! ok ) {
-        failureMessage( "Failed to read %lld bytes from GASP file %s"
-                        "because %s.",
-                        bytesToRead, fileName,
-                        gzerror( inputFile, &unused ) );
-      }
-    }
+         byteData, scan );
 
-    if ( ok ) { /* Decode data: */
-      const Real one600th = 1.0 / 600.0;
-      const Integer firstRow    = indices[ ROW    ][ MINIMUM ];
-      const Integer lastRow     = indices[ ROW    ][ MAXIMUM ];
-      const Integer firstColumn = indices[ COLUMN ][ MINIMUM ];
-      const Integer lastColumn  = indices[ COLUMN ][ MAXIMUM ];
-      Integer row = 0;
+  const Real one600th = 1.0 / 600.0;
+  const Integer firstRow    = indices[ ROW    ][ MINIMUM ];
+  const Integer lastRow     = indices[ ROW    ][ MAXIMUM ];
+  const Integer firstColumn = indices[ COLUMN ][ MINIMUM ];
+  const Integer lastColumn  = indices[ COLUMN ][ MAXIMUM ];
+  Integer row = 0;
 
-      /* Decode subset of data in parallel: */
+  /* Decode subset of data in parallel: */
 
 #pragma omp parallel for
 
-      for ( row = firstRow; row <= lastRow; ++row ) {
-        Integer column = 0;
-
-        for ( column = firstColumn; column <= lastColumn; ++column ) {
-          scan->data[ AOD ][ row ][ column ] =
-            scan->byteData[ AOD ][ row ][ column ] * 0.01 - 0.5;
-          scan->data[ MSK ][ row ][ column ] =
-            scan->byteData[ MSK ][ row ][ column ];
-          scan->data[ CLS ][ row ][ column ] =
-            scan->byteData[ CLS ][ row ][ column ];
-          scan->data[ STD ][ row ][ column ] =
-            scan->byteData[ STD ][ row ][ column ] * 0.01;
-          scan->data[ SFC ][ row ][ column ] =
-            scan->byteData[ SFC ][ row ][ column ] * 0.002 - 0.1;
-          scan->data[ CH1 ][ row ][ column ] =
-            scan->byteData[ CH1 ][ row ][ column ] * one600th;
-          scan->data[ MOS ][ row ][ column ] =
-            scan->byteData[ MOS ][ row ][ column ] * one600th;
-          scan->data[ CLD ][ row ][ column ] =
-            scan->byteData[ CLD ][ row ][ column ];
-          scan->data[ SIG ][ row ][ column ] =
-            scan->byteData[ SIG ][ row ][ column ] * 0.004 - 0.5;
-          scan->data[ SCA ][ row ][ column ] =
-            scan->byteData[ SCA ][ row ][ column ];
-
-          DEBUG( if ( row - firstRow < 3 && column - firstColumn < 3 )
-                   fprintf( stderr,
-                            "Raw subset data:\n"
-                            " AOD: %u MSK: %u CLS: %u STD: %u"
-                            " SFC: %u CH1: %u MOS: %u CLD: %u"
-                            " SIG: %u SCA: %u\n"
-                            "Decoded subset data:\n"
-                            " AOD: %lf MSK: %lf CLS: %lf STD: %lf"
-                            " SFC: %lf CH1: %lf MOS: %lf CLD: %lf"
-                            " SIG: %lf SCA: %lf\n",
-                            scan->byteData[ AOD ][ row ][ column ],
-                            scan->byteData[ MSK ][ row ][ column ],
-                            scan->byteData[ CLS ][ row ][ column ],
-                            scan->byteData[ STD ][ row ][ column ],
-                            scan->byteData[ SFC ][ row ][ column ],
-                            scan->byteData[ CH1 ][ row ][ column ],
-                            scan->byteData[ MOS ][ row ][ column ],
-                            scan->byteData[ CLD ][ row ][ column ],
-                            scan->byteData[ SIG ][ row ][ column ],
-                            scan->byteData[ SCA ][ row ][ column ],
-                            scan->data[ AOD ][ row ][ column ],
-                            scan->data[ MSK ][ row ][ column ],
-                            scan->data[ CLS ][ row ][ column ],
-                            scan->data[ STD ][ row ][ column ],
-                            scan->data[ SFC ][ row ][ column ],
-                            scan->data[ CH1 ][ row ][ column ],
-                            scan->data[ MOS ][ row ][ column ],
-                            scan->data[ CLD ][ row ][ column ],
-                            scan->data[ SIG ][ row ][ column ],
-                            scan->data[ SCA ][ row ][ column ] ); )
-        }
-      }
+  for ( row = firstRow; row <= lastRow; ++row ) {
+    Integer column = 0;
 
-      scan->timestamp = timestampOfFileName( fileName );
-      result = scan->timestamp > 0;
+    for ( column = firstColumn; column <= lastColumn; ++column ) {
+      scan->data[ AOD ][ row ][ column ] =
+        byteData[ AOD ][ row ][ column ] * 0.01 - 0.5;
+      scan->data[ MSK ][ row ][ column ] =
+        byteData[ MSK ][ row ][ column ];
+      scan->data[ CLS ][ row ][ column ] =
+        byteData[ CLS ][ row ][ column ];
+      scan->data[ STD ][ row ][ column ] =
+        byteData[ STD ][ row ][ column ] * 0.01;
+      scan->data[ SFC ][ row ][ column ] =
+        byteData[ SFC ][ row ][ column ] * 0.002 - 0.1;
+      scan->data[ CH1 ][ row ][ column ] =
+        byteData[ CH1 ][ row ][ column ] * one600th;
+      scan->data[ MOS ][ row ][ column ] =
+        byteData[ MOS ][ row ][ column ] * one600th;
+      scan->data[ CLD ][ row ][ column ] =
+        byteData[ CLD ][ row ][ column ];
+      scan->data[ SIG ][ row ][ column ] =
+        byteData[ SIG ][ row ][ column ] * 0.004 - 0.5;
+      scan->data[ SCA ][ row ][ column ] =
+        byteData[ SCA ][ row ][ column ];
+
+      DEBUG( if ( row - firstRow < 3 && column - firstColumn < 3 )
+               fprintf( stderr,
+                        "Raw subset data:\n"
+                        " AOD: %u MSK: %u CLS: %u STD: %u"
+                        " SFC: %u CH1: %u MOS: %u CLD: %u"
+                        " SIG: %u SCA: %u\n"
+                        "Decoded subset data:\n"
+                        " AOD: %lf MSK: %lf CLS: %lf STD: %lf"
+                        " SFC: %lf CH1: %lf MOS: %lf CLD: %lf"
+                        " SIG: %lf SCA: %lf\n",
+                        byteData[ AOD ][ row ][ column ],
+                        byteData[ MSK ][ row ][ column ],
+                        byteData[ CLS ][ row ][ column ],
+                        byteData[ STD ][ row ][ column ],
+                        byteData[ SFC ][ row ][ column ],
+                        byteData[ CH1 ][ row ][ column ],
+                        byteData[ MOS ][ row ][ column ],
+                        byteData[ CLD ][ row ][ column ],
+                        byteData[ SIG ][ row ][ column ],
+                        byteData[ SCA ][ row ][ column ],
+                        scan->data[ AOD ][ row ][ column ],
+                        scan->data[ MSK ][ row ][ column ],
+                        scan->data[ CLS ][ row ][ column ],
+                        scan->data[ STD ][ row ][ column ],
+                        scan->data[ SFC ][ row ][ column ],
+                        scan->data[ CH1 ][ row ][ column ],
+                        scan->data[ MOS ][ row ][ column ],
+                        scan->data[ CLD ][ row ][ column ],
+                        scan->data[ SIG ][ row ][ column ],
+                        scan->data[ SCA ][ row ][ column ] ); )
     }
-
-    gzclose( inputFile ), inputFile = 0;
   }
 
-  DEBUG( fprintf( stderr, "%lld\n", result ); )
-  POST02( IS_BOOL( result ), IMPLIES( result, isValidScan( scan ) ) );
-  return result;
+  scan->timestamp = timestamp;
+
+  POST02( scan->timestamp == timestamp, isValidScan( scan ) );
 }
 
 
@@ -1520,10 +1663,6 @@ static Integer subsetScanCount( const Bounds bounds,
   const Integer lastRow     = indices[ ROW    ][ MAXIMUM ];
   const Integer firstColumn = indices[ COLUMN ][ MINIMUM ];
   const Integer lastColumn  = indices[ COLUMN ][ MAXIMUM ];
-  const Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
-  const Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
-  const Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
-  const Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
   const Real aodMinimum = ranges[ AOD ][ MINIMUM ];
   const Real aodMaximum = ranges[ AOD ][ MAXIMUM ];
   const Real clsMinimum = ranges[ CLS ][ MINIMUM ];
@@ -1553,8 +1692,6 @@ static Integer subsetScanCount( const Bounds bounds,
     Integer column = 0;
 
     for ( column = firstColumn; column <= lastColumn; ++column ) {
-      const Real longitude = longitudesLatitudes[ LONGITUDE ][ row ][ column ];
-      const Real latitude  = longitudesLatitudes[ LATITUDE  ][ row ][ column ];
       const Real aod = data[ AOD ][ row ][ column ];
       const Real msk = data[ MSK ][ row ][ column ];
       const Real cls = data[ CLS ][ row ][ column ];
@@ -1566,9 +1703,8 @@ static Integer subsetScanCount( const Bounds bounds,
       const Real sig = data[ SIG ][ row ][ column ];
       const Real sca = data[ SCA ][ row ][ column ];
       const Integer output =
-        AND12( msk == 1.0,
-               IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
-               IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ),
+        AND11( msk == 1.0,
+               inBounds[ row ][ column ],
                IN_RANGE( aod, aodMinimum, aodMaximum ),
                IN_RANGE( cls, clsMinimum, clsMaximum ),
                IN_RANGE( std, stdMinimum, stdMaximum ),
@@ -1750,6 +1886,55 @@ static Integer subsetIndicesByBounds( const Bounds bounds,
 
 
 
+/******************************************************************************
+PURPOSE: computeInBounds - Flag grid points within bounds.
+INPUTS:  const Bounds bounds              longitude-latitude bounds of subset.
+         const Integer indices[ 2 ][ 2 ]  indices[ROW COLUMN][MIN/MAXIMUM]
+                                          from subsetIndicesByBounds().
+NOTES:   Sets global array inBounds using global array longitudesLatitudes.
+         The GOES grid is fixed so this is computed once then used by
+         subsetScanCount() and computeMean() for each scan.
+******************************************************************************/
+
+static void computeInBounds( const Bounds bounds,
+                             const Integer indices[ 2 ][ 2 ] ) {
+
+  PRE07( bounds, isValidBounds( bounds ),
+         indices,
+         IN_RANGE( indices[ ROW ][ MINIMUM ], 0, ROWS - 1 ),
+         IN_RANGE( indices[ ROW ][ MAXIMUM ],
+                   indices[ ROW ][ MINIMUM ], ROWS - 1 ),
+         IN_RANGE( indices[ COLUMN ][ MINIMUM ], 0, COLUMNS - 1 ),
+         IN_RANGE( indices[ COLUMN ][ MAXIMUM ],
+                   indices[ COLUMN ][ MINIMUM ], COLUMNS - 1 ) );
+
+  const Integer firstRow    = indices[ ROW    ][ MINIMUM ];
+  const Integer lastRow     = indices[ ROW    ][ MAXIMUM ];
+  const Integer firstColumn = indices[ COLUMN ][ MINIMUM ];
+  const Integer lastColumn  = indices[ COLUMN ][ MAXIMUM ];
+  const Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
+  const Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
+  const Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
+  const Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
+  Integer row = 0;
+
+  memset( inBounds, 0, sizeof inBounds );
+
+  for ( row = firstRow; row <= lastRow; ++row ) {
+    Integer column = 0;
+
+    for ( column = firstColumn; column <= lastColumn; ++column ) {
+      const Real longitude = longitudesLatitudes[ LONGITUDE ][ row ][ column ];
+      const Real latitude  = longitudesLatitudes[ LATITUDE  ][ row ][ column ];
+      inBounds[ row ][ column ] =
+        AND2( IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
+              IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ) );
+    }
+  }
+}
+
+
+
 /******************************************************************************
 PURPOSE: subsetIndicesByMask - Subset row and column indices by mask flag.
 INPUTS:  const Real msk[ ROWS ][ COLUMNS ]  Subset-modified mask flag.
@@ -2094,10 +2279,6 @@ static void computeMean( const Bounds bounds,
   const Integer lastRow     = indices[ ROW    ][ MAXIMUM ];
   const Integer firstColumn = indices[ COLUMN ][ MINIMUM ];
   const Integer lastColumn  = indices[ COLUMN ][ MAXIMUM ];
-  const Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
-  const Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
-  const Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
-  const Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
   const Real aodMinimum = ranges[ AOD ][ MINIMUM ];
   const Real aodMaximum = ranges[ AOD ][ MAXIMUM ];
   const Real clsMinimum = ranges[ CLS ][ MINIMUM ];
@@ -2126,8 +2307,6 @@ static void computeMean( const Bounds bounds,
     Integer column = 0;
 
     for ( column = firstColumn; column <= lastColumn; ++column ) {
-      const Real longitude = longitudesLatitudes[ LONGITUDE ][ row ][ column ];
-      const Real latitude  = longitudesLatitudes[ LATITUDE  ][ row ][ column ];
       const Real aod = data[ AOD ][ row ][ column ];
       const Real msk = data[ MSK ][ row ][ column ];
       const Real cls = data[ CLS ][ row ][ column ];
@@ -2139,9 +2318,8 @@ static void computeMean( const Bounds bounds,
       const Real sig = data[ SIG ][ row ][ column ];
       const Real sca = data[ SCA ][ row ][ column ];
       const Integer output =
-        AND12( msk == 1.0,
-               IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
-               IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ),
+        AND11( msk == 1.0,
+               inBounds[ row ][ column ],
                IN_RANGE( aod, aodMinimum, aodMaximum ),
                IN_RANGE( cls, clsMinimum, clsMaximum ),
                IN_RANGE( std, stdMinimum, stdMaximum ),
@@ -2572,6 +2750,7 @@ static void writeScanData( const VoidList* scans, Stream* output ) {
     output->write64BitReals( output, scan->data,
                              ( scan->variables + scan->hasCorners * 8 )
                              * scan->points );
+    timingPoints( scan->points );
     ++scanIndex;
   } while ( AND2( output->ok( output ), scanIndex < scanCount ) );
 
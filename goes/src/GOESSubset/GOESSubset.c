@@ -15,17 +15,32 @@ NOTES:   Uses libz.a (see ../../libs/MODIS/zlib) and
              GOESSubset.c -L/usr/local/lib/x86_64 \
              -L../../../lib/$platform -lUtilities -lz -lm
 
+         Decoded coordinates files and the grid points within the bounds
+         are cached (see ../../../rsig/src/XDRConvert/Utilities/Cache.h)
+         and reused until the coordinates file changes.
+
 HISTORY: 2015-05-08 plessel.todd@epa.gov
 STATUS: unreviewed untested
 ******************************************************************************/
 
 /*================================ INCLUDES =================================*/
 
-#include <stdio.h>  /* For stderr, FILE, fprintf(). */
-#include <string.h> /* For strlen(), memset(). */
+#include <stdio.h>  /* For stderr, FILE, fprintf(), fopen(). */
+#include <stdlib.h> /* For malloc(), realloc(), free(). */
+#include <string.h> /* For strlen(), memset(), memcpy(), strncpy(). */
 #include <ctype.h>  /* For isdigit(), isprint(). */
+#include <errno.h>  /* For errno. */
+#include <sys/stat.h> /* For struct stat, stat(). */
+
+#ifdef _OPENMP
+#include <omp.h> /* For omp_get_max_threads(). */
+#else
+#define omp_get_max_threads() 1
+#endif
 
 #include <Utilities.h> /* For PRE0*(), NEW_ZERO(), Stream, VoidList, etc. */
+#include <Cache.h>     /* For readCache(), writeCache(). */
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
 
 /* Z Library routines used (simply prototyped) to read compressed files: */
 
@@ -34,30 +49,83 @@ extern int gzread( void* file, void* data, unsigned int bytes );
 extern int gzclose( void* file );
 extern const char* gzerror( void* file, int* unused );
 
+/*
+ * FileError: Why a file could not be read or its header parsed.
+ * Files are read in parallel and failureMessage() is not thread-safe so
+ * errors are recorded then later reported serially by reportFileError().
+ */
+
+enum { OPEN_ERROR = 1, READ_ERROR, MEMORY_ERROR, COUNT_ERROR, WORD_ERROR };
+
+typedef struct {
+  int         code;         /* 0 or OPEN_ERROR ... WORD_ERROR. */
+  int         errnoCopy;    /* errno when the error occurred. */
+  const char* name;         /* Header value name if COUNT/WORD_ERROR. */
+  char        reason[ 80 ]; /* gzerror() message if READ_ERROR. */
+} FileError;
+
+/* Buffers grow as needed to hold uncompressed files of up to 100MB: */
+
+enum {
+  MINIMUM_BUFFER_SIZE = 1024 * 1024,
+  MAXIMUM_BUFFER_SIZE = 100 * 1024 * 1024
+};
+
 static int readCompressedFile( const char* fileName,
-                               const int bufferSize, void* buffer ) {
+                               Integer* bufferSize, char** buffer,
+                               FileError* error ) {
   void* inputFile = gzopen( fileName, "rb" );
   int result = 0;
-  memset( buffer, 0, bufferSize );
 
   DEBUG( fprintf( stderr, "Reading file %s\n", fileName ); )
 
   if ( ! inputFile ) {
-    int unused = 0;
-    failureMessage( "Failed to open file %s for reading because %s.",
-                    fileName, gzerror( inputFile, &unused ) );
+    error->code = OPEN_ERROR;
+    error->errnoCopy = errno;
   } else {
-    const int bytesRead = gzread( inputFile, buffer, bufferSize - 1);
-    CHECK( bytesRead <= bufferSize - 1 );
-    result = bytesRead > 0;
+    Integer length = 0;
+    int bytesRead = 0;
 
-    if ( ! result ) {
+    do {
+      char* grown = *buffer;
+
+      if ( length + 1 >= *bufferSize ) { /* Grow buffer, keeping contents: */
+        const Integer size =
+          *bufferSize < MINIMUM_BUFFER_SIZE ? MINIMUM_BUFFER_SIZE
+          : *bufferSize < MAXIMUM_BUFFER_SIZE / 2 ? *bufferSize + *bufferSize
+          : MAXIMUM_BUFFER_SIZE;
+        grown = realloc( *buffer, size );
+
+        if ( grown ) {
+          *buffer = grown;
+          *bufferSize = size;
+        } else {
+          error->code = MEMORY_ERROR;
+          error->errnoCopy = errno;
+        }
+      }
+
+      bytesRead =
+        grown ? gzread( inputFile, *buffer + length,
+                        (unsigned int) ( *bufferSize - 1 - length ) )
+        : 0;
+      length += bytesRead > 0 ? bytesRead : 0;
+    } while ( AND2( bytesRead > 0, length + 1 < MAXIMUM_BUFFER_SIZE ) );
+
+    if ( *buffer ) {
+      CHECK( length < *bufferSize );
+      (*buffer)[ length ] = '\0';
+    }
+
+    if ( AND2( error->code == 0, OR2( bytesRead < 0, length == 0 ) ) ) {
       int unused = 0;
-      failureMessage( "Failed to read up to %d bytes from file %s"
-                      "because %s.",
-                      bufferSize - 1, fileName, gzerror( inputFile, &unused ));
+      error->code = READ_ERROR;
+      error->errnoCopy = 0; /* reason says why. */
+      strncpy( error->reason, gzerror( inputFile, &unused ),
+               sizeof error->reason / sizeof *error->reason - 1 );
     }
 
+    result = error->code == 0;
     gzclose( inputFile ), inputFile = 0;
   }
 
@@ -65,10 +133,69 @@ static int readCompressedFile( const char* fileName,
   return result;
 }
 
+static void reportFileError( const char* fileName, const FileError* error ) {
+
+  if ( error->code ) {
+    errno = error->errnoCopy;
+  }
+
+  switch ( error->code ) {
+  case OPEN_ERROR:
+    failureMessage( "Failed to open file %s for reading.", fileName );
+    break;
+  case READ_ERROR:
+    failureMessage( "Failed to read up to %d bytes from file %s "
+                    "because %s.",
+                    MAXIMUM_BUFFER_SIZE - 1, fileName, error->reason );
+    break;
+  case MEMORY_ERROR:
+    failureMessage( "Can't allocate enough memory to read file %s.",
+                    fileName );
+    break;
+  case COUNT_ERROR:
+    failureMessage( "Failed to read valid count for %s in header.",
+                    error->name );
+    break;
+  case WORD_ERROR:
+    failureMessage( "Failed to read valid word for %s in header.",
+                    error->name );
+    break;
+  default:
+    break;
+  }
+}
+
 /*================================== TYPES ==================================*/
 
 #define MISSING (-9999.0)
 
+/*
+ * Decoded coordinates are cached (see Cache.h) so later scans and runs need
+ * not decompress and parse them. The key is a CoordinatesCacheKey and the
+ * payload is native Integer dimensions[ COLUMN ROW ] then
+ * longitudes[ rows * columns ] and latitudes[ rows * columns ].
+ * The grid points within the bounds are also cached, keyed by a
+ * SubsetCacheKey, so later runs on the same domain need not search the grid.
+ * That payload is native Integer subset[ COLUMN ROW ][ MINIMUM MAXIMUM ]
+ * then subsetIndices[ subsetPoints ].
+ */
+
+#define COORDINATES_CACHE_KIND "GOESSubset_coordinates"
+#define SUBSET_CACHE_KIND "GOESSubset_subset"
+#define COORDINATES_CACHE_TAG "GOESSubset coordinates cache 2.0"
+
+typedef struct {
+  char     tag[ 40 ];           /* COORDINATES_CACHE_TAG. */
+  Integer  modified;            /* st_mtime of coordinates file. */
+  Integer  size;                /* st_size of coordinates file. */
+  FileName coordinatesFileName; /* Name of cached coordinates file. */
+} CoordinatesCacheKey;
+
+typedef struct {
+  CoordinatesCacheKey coordinates; /* Coordinates file subsetted. */
+  Bounds              bounds;      /* Longitude-latitude bounds of subset. */
+} SubsetCacheKey;
+
 /* For -corners option: */
 
 enum{ VARIABLE_SIZE = 32 };
@@ -209,12 +336,14 @@ typedef struct {
   Integer   rows;              /* Number of coordinate rows. */
   Integer   columns;           /* Number of coordinate columns. */
   Integer   subset[ 2 ][ 2 ];  /* subset[ ROW COLUMN ][ MINIMUM MAXIMUM ]. */
+  Integer   subsetPoints;      /* Number of coordinates within bounds. */
+  Integer*  subsetIndices;     /* subsetIndices[ subsetPoints ] in bounds. */
   Variable  variable;          /* Name of data variable. "INSL" ... "PARM". */
   Real*     longitudes;        /* longitudes[ rows ][ columns ]. */
   Real*     latitudes;         /* latitudes[  rows ][ columns ]. */
   Real*     corners;/*corners[LONGITUDE LATITUDE][SW SE NW NE][rows][columns]*/
   Integer   bufferSize;        /* sizeof buffer. */
-  char*     buffer;            /* buffer[bufferSize] uncompressed file bytes.*/
+  char*     buffer;            /* buffer[bufferSize] coordinates file bytes. */
   Arguments arguments;         /* User-supplied (command-line) arguments. */
   Scan      scan;              /* Scan of current file being read/processed. */
   VoidList* subsettedScans;    /* List of subsetted scans already read. */
@@ -227,6 +356,7 @@ static void deallocateData( Data* data ) {
   FREE( data->longitudes );
   FREE( data->latitudes );
   FREE( data->corners );
+  FREE( data->subsetIndices );
   FREE( data->buffer );
   deallocateScan( &data->scan );
   FREE_OBJECT( data->subsettedScans ); /* Calls deallocateSubsettedScan(). */
@@ -240,7 +370,7 @@ static void deallocateData( Data* data ) {
 
 static Integer isValidData( const Data* data ) {
   Integer result =
-    AND20( data,
+    AND19( data,
            isValidArguments( &data->arguments ),
            isprint( data->variable[ 0 ] ),
            data->rows > 0,
@@ -264,8 +394,7 @@ static Integer isValidData( const Data* data ) {
                                   data->corners +
                                     4 * data->rows * data->columns ) ),
                          ! data->corners ),
-           data->bufferSize > 0,
-           data->buffer,
+           IMPLIES( data->buffer, data->bufferSize > 0 ),
            isValidScan( &data->scan ),
            data->subsettedScans,
            data->subsettedScans->invariant( data->subsettedScans ),
@@ -290,6 +419,26 @@ static Integer isValidData( const Data* data ) {
 #endif /* ! defined( NO_ASSERTIONS ) */
 
 
+/*
+ * ScanFile: A listed GOES data file and its scan.
+ * Batches of these are read and parsed in parallel then processed in order.
+ * At most MAXIMUM_PARALLEL_SCANS since each keeps a decompression buffer.
+ */
+
+enum { MAXIMUM_PARALLEL_SCANS = 8 };
+
+typedef struct {
+  FileName  fileName;   /* Name of GOES data file. */
+  Integer   timestamp;  /* YYYYDDDHHMM of file name or 0 if invalid. */
+  Integer   ok;         /* Was the file read and parsed? */
+  FileError error;      /* Why the file was not read, if known. */
+  Variable  variable;   /* Product name of file. */
+  Scan      scan;       /* Scan read from file. */
+  Integer   bufferSize; /* sizeof buffer. */
+  char*     buffer;     /* buffer[bufferSize] uncompressed file bytes. */
+} ScanFile;
+
+
 /*========================== FORWARD DECLARATIONS ===========================*/
 
 static void copyWord( char* output, const char* input, const size_t length ) {
@@ -325,7 +474,7 @@ static const char* readAndSkipReal( const char* string, Real* value ) {
 
     *value = atof( result );
 
-    while ( ! isspace( *result ) ) {
+    while ( AND2( *result, ! isspace( *result ) ) ) {
       ++result;
     }
 
@@ -355,21 +504,37 @@ static void appendDailyMeans( const Integer yyyyddd0000,
                               const Integer counts[], const Real means[],
                               Data* data );
 
-static void readGOESDataFile( const char* fileName, Data* data );
+static void readScanFile( ScanFile* scanFile );
 
 static Integer findCoordinatesFile( const char* const dataFileName,
                                     FileName coordinatesFileName );
 
 static void readGOESCoordinatesFile( Data* data );
 
+static Integer coordinatesCacheKey( const char* coordinatesFileName,
+                                    CoordinatesCacheKey* key );
+
+static Integer readCoordinatesCache( Data* data );
+
+static void writeCoordinatesCache( const Data* data );
+
+static void subsetCoordinates( Data* data );
+
+static Integer readSubsetCache( Data* data );
+
+static void writeSubsetCache( const Data* data );
+
 static const char* parseHeader( const char* buffer,
                                 Integer* rows, Integer* columns,
                                 Variable variable,
-                                FileName coordinatesFileName );
+                                FileName coordinatesFileName,
+                                FileError* error );
 
-static Integer parseCount( const char* header, const char* name );
+static Integer parseCount( const char* header, const char* name,
+                           FileError* error );
 
-static const char* parseWord( const char* header, const char* name );
+static const char* parseWord( const char* header, const char* name,
+                              FileError* error );
 
 static Integer parseData( const char* buffer, const Integer count,
                           Real data[], Real data2[] );
@@ -377,17 +542,16 @@ static Integer parseData( const char* buffer, const Integer count,
 static Integer timestampOfFileName( const char* fileName );
 
 static SubsettedScan* subsetScan( const Bounds bounds,
-                                  const Integer subset[ 2 ][ 2 ],
+                                  const Integer subsetPoints,
+                                  const Integer subsetIndices[],
                                   const Real longitudes[],
                                   const Real latitudes[],
                                   const Real corners[],
                                   Scan* scan );
 
-static Integer subsetScanCount( const Bounds bounds,
-                                const Real longitudes[],
-                                const Real latitudes[],
-                                Integer subset[ 2 ][ 2 ],
-                                Scan* scan );
+static Integer subsetScanCount( const Integer subsetPoints,
+                                const Integer subsetIndices[],
+                                const Scan* scan );
 
 static Integer subsetIndicesByBounds( const Bounds bounds,
                                       const Integer rows,
@@ -399,10 +563,13 @@ static Integer subsetIndicesByBounds( const Bounds bounds,
                                       Integer* firstColumn,
                                       Integer* lastColumn );
 
-static void reduceSubset( const Integer rows, const Integer columns,
-                          const Real data[],
-                          Integer* firstRow, Integer* lastRow,
-                          Integer* firstColumn, Integer* lastColumn );
+static Integer* subsetPointsByBounds( const Bounds bounds,
+                                      const Integer rows,
+                                      const Integer columns,
+                                      const Real longitudes[],
+                                      const Real latitudes[],
+                                      const Integer subset[ 2 ][ 2 ],
+                                      Integer* points );
 
 static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                               const Integer columns,
@@ -411,10 +578,8 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                               const Real corners[],
                                               const Real data[],
                                               Integer points,
-                                              Integer firstRow,
-                                              Integer lastRow,
-                                              Integer firstColumn,
-                                              Integer lastColumn,
+                                              Integer subsetPoints,
+                                              const Integer subsetIndices[],
                                               Real subsetLongitudes[],
                                               Real subsetLatitudes[],
                                               Real subsetLongitudesSW[],
@@ -428,8 +593,8 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
 
 static void copySubsetData( const Integer rows, const Integer columns,
                             const Real data[],
-                            Integer firstRow, Integer lastRow,
-                            Integer firstColumn, Integer lastColumn,
+                            Integer subsetPoints,
+                            const Integer subsetIndices[],
                             Real output[] );
 
 static void computeMean( const Data* const data,
@@ -488,6 +653,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   Integer ok = 0;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     failureMessage( "Invalid command-line arguments." );
@@ -499,17 +666,12 @@ int main( int argc, char* argv[] ) {
     data.ok = parseArguments( argc, argv, &data.arguments );
 
     if ( data.ok ) {
-      const Integer bufferSize = 100 * 1024 * 1024; /*Decompressed file bytes*/
-      data.buffer = NEW_ZERO( char, bufferSize );
-      data.ok = data.buffer != 0;
+      timingStage( "read" );
+      readData( &data ); /* From list file named in arguments. */
 
       if ( data.ok ) {
-        data.bufferSize = bufferSize;
-        readData( &data ); /* From list file named in arguments. */
-
-        if ( data.ok ) {
-          writeData( &data ); /* To stdout. */
-        }
+        timingStage( "write" );
+        writeData( &data ); /* To stdout. */
       }
     }
 
@@ -517,6 +679,7 @@ int main( int argc, char* argv[] ) {
     deallocateData( &data );
   }
 
+  timingReport();
   ok = AND2( ok, failureCount() == 0 );
   POST0( IS_BOOL( ok ) );
   return ! ok;
@@ -733,6 +896,9 @@ static void readData( Data* data ) {
 
   Stream* listFile = newFileStream( data->arguments.listFile, "r" );
   const Integer computeDailyMean = data->arguments.daily;
+  const Integer batchSize =
+    CLAMPED_TO_RANGE( omp_get_max_threads(), 1, MAXIMUM_PARALLEL_SCANS );
+  ScanFile* scanFiles = NEW_ZERO( ScanFile, batchSize );
   Integer rows    = 0;
   Integer columns = 0;
   Integer* counts = 0;
@@ -740,35 +906,94 @@ static void readData( Data* data ) {
   Integer yyyyddd = 0;
   data->ok = 0;
 
-  if ( listFile ) {
+  if ( AND2( listFile, scanFiles ) ) {
     const Integer firstTimestamp = data->arguments.firstTimestamp;
     const Integer lastTimestamp =
       offsetTimestamp( firstTimestamp, data->arguments.hours );
     Integer previousTimestamp = 0;
 
     /*
-     * For each GOES data file,
+     * For each batch of listed GOES data files,
+     *   read and parse the data files in parallel, then in file order:
      *   read its corresponding lonlat file and dimensions,
      *   optionally compute corners,
-     *   read data into scan, subset scan by bounds, filter and append to list:
+     *   subset scan by bounds, filter and append to list:
      */
 
     do {
-      FileName fileName = "";
-      memset( fileName, 0, sizeof fileName );
-      listFile->readWord( listFile, fileName,
-                          sizeof fileName / sizeof *fileName );
+      Integer count = 0;
+      Integer index = 0;
+
+      do { /* List the next batch of files: */
+        ScanFile* const scanFile = scanFiles + count;
+        char newline[ 2 ] = "";
+        memset( scanFile->fileName, 0, sizeof scanFile->fileName );
+        listFile->readWord( listFile, scanFile->fileName,
+                            sizeof scanFile->fileName /
+                            sizeof *scanFile->fileName );
+
+        if ( listFile->ok( listFile ) ) {
+          DEBUG( fprintf( stderr, "listing GOES file %s\n",
+                          scanFile->fileName ); )
+          scanFile->timestamp = timestampOfFileName( scanFile->fileName );
+          scanFile->ok = 0;
+          ++count;
+        }
+
+        listFile->readString( listFile, newline, 2 ); /* Read '\n'. */
+      } while ( AND2( count < batchSize, ! listFile->isAtEnd( listFile ) ) );
+
+      /* Decompress and parse the batch of files in parallel: */
+
+#pragma omp parallel for schedule( dynamic )
+
+      for ( index = 0; index < count; ++index ) {
+        ScanFile* const scanFile = scanFiles + index;
+
+        if ( IN_RANGE( scanFile->timestamp, firstTimestamp, lastTimestamp ) ) {
+          readScanFile( scanFile );
+        }
+      }
+
+      /* Process the scans in file order: */
 
-      if ( listFile->ok( listFile ) ) {
-        const Integer currentTimestamp = timestampOfFileName( fileName );
-        DEBUG( fprintf( stderr, "listing GOES file %s\n", fileName ); )
+      for ( index = 0; index < count; ++index ) {
+        ScanFile* const scanFile = scanFiles + index;
+        const Integer currentTimestamp = scanFile->timestamp;
 
         if ( ! AND2( currentTimestamp > 0,
                      IMPLIES( previousTimestamp,
                               currentTimestamp > previousTimestamp ) ) ) {
-          failureMessage( "Invalid/unordered GOES file %s.", fileName );
+          failureMessage( "Invalid/unordered GOES file %s.",
+                          scanFile->fileName );
         } else if (IN_RANGE(currentTimestamp, firstTimestamp, lastTimestamp)) {
-          readGOESDataFile( fileName, data );
+          reportFileError( scanFile->fileName, &scanFile->error );
+          data->ok = scanFile->ok;
+
+          if ( data->ok ) { /* Check product then take ownership of scan: */
+
+            if ( *data->variable == '\0' ) {
+              memcpy( data->variable, scanFile->variable, sizeof (Variable) );
+            } else if ( strncmp( data->variable, scanFile->variable,
+                                 strlen( data->variable ) ) ) {
+              failureMessage( "Data file product name does not match "
+                              "expected variable name '%s'.",
+                              data->variable );
+              data->ok = 0;
+            }
+
+            if ( data->ok ) {
+              data->ok =
+                findCoordinatesFile( scanFile->fileName,
+                                     scanFile->scan.coordinatesFileName );
+            }
+
+            if ( data->ok ) {
+              deallocateScan( &data->scan );
+              data->scan = scanFile->scan;
+              memset( &scanFile->scan, 0, sizeof scanFile->scan );
+            }
+          }
 
           if ( data->ok ) {
 
@@ -778,18 +1003,8 @@ static void readData( Data* data ) {
                       data->scan.columns != data->columns ) ) {
               readGOESCoordinatesFile( data );
 
-              if ( data->ok ) {
-                data->ok =
-                  subsetIndicesByBounds( (const Real (*)[2])
-                                           data->arguments.bounds,
-                                         data->rows,
-                                         data->columns,
-                                         data->longitudes,
-                                         data->latitudes,
-                                         &data->subset[ ROW ][ MINIMUM ],
-                                         &data->subset[ ROW ][ MAXIMUM ],
-                                         &data->subset[ COLUMN ][ MINIMUM ],
-                                         &data->subset[ COLUMN ][ MAXIMUM ] );
+              if ( data->ok ) { /* Reuse grid points in bounds for each scan: */
+                subsetCoordinates( data );
               }
             }
 
@@ -838,7 +1053,7 @@ static void readData( Data* data ) {
               } else {
                 SubsettedScan* subsettedScan =
                   subsetScan( (const Real (*)[2]) data->arguments.bounds,
-                              (const Integer (*)[2]) data->subset,
+                              data->subsetPoints, data->subsetIndices,
                               data->longitudes, data->latitudes, data->corners,
                               &data->scan );
 
@@ -864,14 +1079,24 @@ static void readData( Data* data ) {
             }
           }
         }
-      }
 
-      listFile->readString( listFile, fileName, 2 ); /* Read '\n'. */
+        deallocateScan( &scanFile->scan ); /* Unless owned by data above. */
+      }
     } while ( ! listFile->isAtEnd( listFile ) );
+  }
 
-    FREE_OBJECT( listFile );
+  if ( scanFiles ) {
+    Integer index = 0;
+
+    for ( index = 0; index < batchSize; ++index ) {
+      deallocateScan( &scanFiles[ index ].scan );
+      FREE( scanFiles[ index ].buffer );
+    }
   }
 
+  FREE( scanFiles );
+  FREE_OBJECT( listFile );
+
   if ( data->ok ) {
 
     if ( computeDailyMean ) {
@@ -993,53 +1218,58 @@ static void appendDailyMeans( const Integer yyyyddd0000,
 
 
 /******************************************************************************
-PURPOSE: readGOESDataFile - Read scan data from GOES data file.
-INPUTS:  const char* fileName  Name of compressed GOES file to read.
-         Data* data            data->buffer, data->bufferSize, data->variable
-OUTPTUS: Data* data            data->buffer, data->bufferSize, data->variable
-                               data->scan.yyyydddhhmm  YYYYDDDHHMM of file
-                               data->rows, data->columns,
-                               data->scan.data[ rows ][ columns ] scan data.
-NOTES:  If successful data->ok is 1
-        else data->ok is 0 and failureMessage() is called.
+PURPOSE: readScanFile - Read scan data from a listed GOES data file.
+INPUTS:  ScanFile* scanFile  scanFile->fileName   Name of compressed GOES file.
+                             scanFile->timestamp  YYYYDDDHHMM of file.
+                             scanFile->buffer     Buffer to reuse or 0.
+OUTPTUS: ScanFile* scanFile  scanFile->buffer, scanFile->bufferSize
+                             grown to hold the uncompressed file bytes.
+                             scanFile->variable   Product name of file.
+                             scanFile->scan.yyyydddhhmm, rows, columns,
+                             coordinatesFileName (georef), data.
+                             scanFile->ok     1 if read and parsed, else 0.
+                             scanFile->error  Why it was not read, if known.
+NOTES:   Called in parallel so it does not call failureMessage() or NEW().
+         Errors are reported later by reportFileError().
 ******************************************************************************/
 
-static void readGOESDataFile( const char* fileName, Data* data ) {
+static void readScanFile( ScanFile* scanFile ) {
 
-  PRE04( fileName, data,
-         IN_RANGE(  data->bufferSize, 10LL * 1024LL * 1024LL, INT_MAX / 2LL ),
-         data->buffer );
+  PRE02( scanFile, isValidTimestamp( scanFile->timestamp ) );
 
-  data->ok = readCompressedFile( fileName, (const int) data->bufferSize,
-                                 (void*) data->buffer );
+  Scan* const scan = &scanFile->scan;
+  memset( &scanFile->error, 0, sizeof scanFile->error );
+  scanFile->ok =
+    readCompressedFile( scanFile->fileName,
+                        &scanFile->bufferSize, &scanFile->buffer,
+                        &scanFile->error );
 
-  if ( data->ok ) { /* Parse header and data: */
-    Scan* const scan = &data->scan;
+  if ( scanFile->ok ) { /* Parse header and data: */
     const char* const dataPointer =
-      parseHeader( data->buffer,
-                   &scan->rows, &scan->columns, data->variable,
-                   scan->coordinatesFileName );
-    data->ok = dataPointer != 0;
+      parseHeader( scanFile->buffer, &scan->rows, &scan->columns,
+                   scanFile->variable, scan->coordinatesFileName,
+                   &scanFile->error );
+    scanFile->ok = dataPointer != 0;
 
-    if ( data->ok ) {
+    if ( scanFile->ok ) {
       const Integer points = scan->rows * scan->columns;
-      data->scan.data = NEW_ZERO( Real, points );
-      data->ok = data->scan.data != 0;
-
-      if ( data->ok ) {
-        data->ok = parseData( dataPointer, points, scan->data, 0 );
+      FREE( scan->data );
+      scan->data = malloc( points * sizeof *scan->data );
+      scanFile->ok = scan->data != 0;
 
-        if ( data->ok ) {
-          const Integer yyyydddhhmm = timestampOfFileName( fileName );
-          CHECK( isValidTimestamp( yyyydddhhmm ) );
-          scan->yyyydddhhmm = yyyydddhhmm;
-          data->ok = findCoordinatesFile( fileName, scan->coordinatesFileName);
-        }
+      if ( ! scanFile->ok ) {
+        scanFile->error.code = MEMORY_ERROR;
+        scanFile->error.errnoCopy = errno;
+      } else {
+        scanFile->ok = parseData( dataPointer, points, scan->data, 0 );
+        scan->yyyydddhhmm = scanFile->timestamp;
       }
     }
   }
 
-  POST0( IMPLIES( data->ok, isValidScan( &data->scan ) ) );
+  POST02( IS_BOOL( scanFile->ok ),
+          IMPLIES( scanFile->ok,
+                   AND3( scan->rows > 0, scan->columns > 0, scan->data ) ) );
 }
 
 
@@ -1152,7 +1382,7 @@ static Integer findCoordinatesFile( const char* const dataFileName,
 PURPOSE: readGOESCoordinatesFile - Read scan lonlats from GOES lonlat file.
 INPUTS:  const char* fileName  Name of compressed GOES file to read.
          Data* data            data->buffer, data->bufferSize,
-OUTPTUS: Data* data            data->buffer, data->bufferSize,
+OUTPTUS: Data* data            data->buffer, data->bufferSize grown as needed,
                                data->scan.yyyydddhhmm  YYYYDDDHHMM of file
                                data->rows, data->columns,
                                data->scan.data[ rows ][ columns ] scan data.
@@ -1162,24 +1392,31 @@ NOTES:  If successful data->ok is 1
 
 static void readGOESCoordinatesFile( Data* data ) {
 
-  PRE04( data, data->scan.coordinatesFileName,
-         IN_RANGE(  data->bufferSize, 64LL * 1024LL * 1024LL, INT_MAX / 2LL ),
-         data->buffer );
+  PRE03( data, data->scan.coordinatesFileName,
+         IMPLIES( data->buffer, data->bufferSize > 0 ) );
 
-  data->ok = readCompressedFile( data->scan.coordinatesFileName,
-                                 (const int) data->bufferSize,
-                                 (void*) data->buffer );
+  FREE( data->corners );
+  data->ok = readCoordinatesCache( data );
+
+  if ( ! data->ok ) {
+    const char* dataPointer = 0;
+    FileError error;
+    memset( &error, 0, sizeof error );
+    data->ok = readCompressedFile( data->scan.coordinatesFileName,
+                                   &data->bufferSize, &data->buffer, &error );
+
+    if ( data->ok ) { /* Parse header and data: */
+      dataPointer =
+        parseHeader( data->buffer, &data->rows, &data->columns, 0, 0, &error);
+      data->ok = dataPointer != 0;
+    }
 
-  if ( data->ok ) { /* Parse header and data: */
-    const char* const dataPointer =
-      parseHeader( data->buffer, &data->rows, &data->columns, 0, 0 );
-    data->ok = dataPointer != 0;
+    reportFileError( data->scan.coordinatesFileName, &error );
 
     if ( data->ok ) {
       const Integer points = data->rows * data->columns;
       FREE( data->longitudes );
       FREE( data->latitudes );
-      FREE( data->corners );
       data->longitudes = NEW_ZERO( Real, points );
       data->latitudes = data->longitudes ? NEW_ZERO( Real, points ) : 0;
       data->ok = data->latitudes != 0;
@@ -1190,23 +1427,325 @@ static void readGOESCoordinatesFile( Data* data ) {
                      data->longitudes, data->latitudes );
 
         if ( data->ok ) {
+          writeCoordinatesCache( data );
+        }
+      }
+    }
+  }
 
-          if ( data->arguments.corners ) {
-            data->corners = NEW_ZERO( Real, 2 * 4 * points );
-            data->ok = data->corners != 0;
+  if ( AND2( data->ok, data->arguments.corners ) ) {
+    const Integer points = data->rows * data->columns;
+    data->corners = NEW_ZERO( Real, 2 * 4 * points );
+    data->ok = data->corners != 0;
 
-            if ( data->ok ) {
-              computeCorners( data->rows, data->columns,
-                              data->longitudes, data->latitudes,
-                              data->corners );
-            }
-          }
+    if ( data->ok ) {
+      computeCorners( data->rows, data->columns,
+                      data->longitudes, data->latitudes,
+                      data->corners );
+    }
+  }
+
+  POST0( IMPLIES( data->ok, isValidScan( &data->scan ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: coordinatesCacheKey - Cache key of a coordinates file.
+INPUTS:  const char* coordinatesFileName  Name of (compressed) coordinates file.
+OUTPUTS: CoordinatesCacheKey* key         Key of cached coordinates.
+RETURNS: Integer 1 if coordinates file exists and the name fits, else 0.
+NOTES:   The key includes the modification time and size of the coordinates
+         file so a replaced coordinates file gets a new cache.
+******************************************************************************/
+
+static Integer coordinatesCacheKey( const char* coordinatesFileName,
+                                    CoordinatesCacheKey* key ) {
+
+  PRE03( coordinatesFileName, *coordinatesFileName, key );
+
+  Integer result = 0;
+  struct stat info;
+  memset( key, 0, sizeof *key );
+
+  if ( AND2( strlen( coordinatesFileName ) < sizeof key->coordinatesFileName,
+             stat( coordinatesFileName, &info ) == 0 ) ) {
+    strncpy( key->tag, COORDINATES_CACHE_TAG, sizeof key->tag - 1 );
+    key->modified = info.st_mtime;
+    key->size = info.st_size;
+    strncpy( key->coordinatesFileName, coordinatesFileName,
+             sizeof key->coordinatesFileName - 1 );
+    result = 1;
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readCoordinatesCache - Read cached decoded coordinates, if present.
+INPUTS:  Data* data  data->scan.coordinatesFileName.
+OUTPTUS: Data* data  data->rows, data->columns, data->longitudes,
+                     data->latitudes.
+RETURNS: Integer 1 if read, else 0 if there is no valid cache.
+******************************************************************************/
+
+static Integer readCoordinatesCache( Data* data ) {
+
+  PRE02( data, *data->scan.coordinatesFileName );
+
+  Integer result = 0;
+  CoordinatesCacheKey key;
+
+  if ( coordinatesCacheKey( data->scan.coordinatesFileName, &key ) ) {
+    size_t size = 0;
+    Integer* dimensions =
+      readCache( COORDINATES_CACHE_KIND, &key, sizeof key, &size );
+
+    if ( AND4( dimensions, size > 2 * sizeof (Integer),
+               GT_ZERO2( dimensions[ ROW ], dimensions[ COLUMN ] ),
+               size == 2 * sizeof (Integer) +
+                       2 * sizeof (Real) *
+                       dimensions[ ROW ] * dimensions[ COLUMN ] ) ) {
+      const Integer rows = dimensions[ ROW ];
+      const Integer columns = dimensions[ COLUMN ];
+      const Integer points = rows * columns;
+      const Real* const coordinates = (const Real*) ( dimensions + 2 );
+      Real* longitudes = NEW_ZERO( Real, points );
+      Real* latitudes = longitudes ? NEW_ZERO( Real, points ) : 0;
+
+      if ( latitudes ) {
+        memcpy( longitudes, coordinates, points * sizeof (Real) );
+        memcpy( latitudes, coordinates + points, points * sizeof (Real) );
+        result = validLongitudesAndLatitudes( points, longitudes, latitudes );
+      }
+
+      if ( result ) {
+        FREE( data->longitudes );
+        FREE( data->latitudes );
+        data->rows = rows;
+        data->columns = columns;
+        data->longitudes = longitudes;
+        data->latitudes = latitudes;
+      } else {
+        FREE( longitudes );
+        FREE( latitudes );
+      }
+    }
+
+    free( dimensions ), dimensions = 0;
+  }
+
+  DEBUG( fprintf( stderr, "readCoordinatesCache( %s ) = %lld\n",
+                  data->scan.coordinatesFileName, result ); )
+  POST02( IS_BOOL( result ),
+          IMPLIES( result,
+                   AND3( GT_ZERO2( data->rows, data->columns ),
+                         data->longitudes, data->latitudes ) ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeCoordinatesCache - Write decoded coordinates to the cache.
+INPUTS:  const Data* data  data->scan.coordinatesFileName, data->rows,
+                           data->columns, data->longitudes, data->latitudes.
+******************************************************************************/
+
+static void writeCoordinatesCache( const Data* data ) {
+
+  PRE05( data, *data->scan.coordinatesFileName,
+         GT_ZERO2( data->rows, data->columns ),
+         data->longitudes, data->latitudes );
+
+  CoordinatesCacheKey key;
+
+  if ( coordinatesCacheKey( data->scan.coordinatesFileName, &key ) ) {
+    Integer dimensions[ 2 ] = { 0, 0 };
+    const size_t bytes = data->rows * data->columns * sizeof (Real);
+    const void* const payloads[ 3 ] =
+      { dimensions, data->longitudes, data->latitudes };
+    const size_t sizes[ 3 ] = { sizeof dimensions, bytes, bytes };
+    dimensions[ ROW    ] = data->rows;
+    dimensions[ COLUMN ] = data->columns;
+    writeCache( COORDINATES_CACHE_KIND, &key, sizeof key, 3, payloads, sizes );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: subsetCoordinates - Find the grid points within the bounds.
+INPUTS:  Data* data  data->arguments.bounds, data->scan.coordinatesFileName,
+                     data->rows, data->columns,
+                     data->longitudes, data->latitudes.
+OUTPTUS: Data* data  data->ok, data->subset, data->subsetPoints,
+                     data->subsetIndices.
+NOTES:   If no points are within the bounds then data->ok is 0 but
+         failureMessage() is not called.
+******************************************************************************/
+
+static void subsetCoordinates( Data* data ) {
+
+  PRE06( data, data->ok, GT_ZERO2( data->rows, data->columns ),
+         data->longitudes, data->latitudes,
+         isValidBounds( (const Real (*)[2]) data->arguments.bounds ) );
+
+  data->ok = readSubsetCache( data );
+
+  if ( ! data->ok ) {
+    data->ok =
+      subsetIndicesByBounds( (const Real (*)[2]) data->arguments.bounds,
+                             data->rows,
+                             data->columns,
+                             data->longitudes,
+                             data->latitudes,
+                             &data->subset[ ROW ][ MINIMUM ],
+                             &data->subset[ ROW ][ MAXIMUM ],
+                             &data->subset[ COLUMN ][ MINIMUM ],
+                             &data->subset[ COLUMN ][ MAXIMUM ] );
+
+    if ( data->ok ) {
+      FREE( data->subsetIndices );
+      data->subsetIndices =
+        subsetPointsByBounds( (const Real (*)[2]) data->arguments.bounds,
+                              data->rows,
+                              data->columns,
+                              data->longitudes,
+                              data->latitudes,
+                              (const Integer (*)[2]) data->subset,
+                              &data->subsetPoints );
+      data->ok = data->subsetIndices != 0;
+
+      if ( data->ok ) {
+        writeSubsetCache( data );
+      }
+    }
+  }
+
+  POST0( IMPLIES( data->ok,
+                  AND3( data->subsetIndices,
+                        IN_RANGE( data->subsetPoints,
+                                  1, data->rows * data->columns ),
+                        IN_RANGE( data->subsetIndices[ data->subsetPoints-1 ],
+                                  0, data->rows * data->columns - 1 ) ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: readSubsetCache - Read cached grid points within bounds, if present.
+INPUTS:  Data* data  data->arguments.bounds, data->scan.coordinatesFileName,
+                     data->rows, data->columns.
+OUTPTUS: Data* data  data->subset, data->subsetPoints, data->subsetIndices.
+RETURNS: Integer 1 if read, else 0 if there is no valid cache.
+NOTES:   The cached indices must be increasing and within the cached subset
+         rows and columns of the current coordinates.
+******************************************************************************/
+
+static Integer readSubsetCache( Data* data ) {
+
+  PRE04( data, *data->scan.coordinatesFileName,
+         GT_ZERO2( data->rows, data->columns ),
+         isValidBounds( (const Real (*)[2]) data->arguments.bounds ) );
+
+  Integer result = 0;
+  SubsetCacheKey key;
+  memset( &key, 0, sizeof key );
+
+  if ( coordinatesCacheKey( data->scan.coordinatesFileName,
+                            &key.coordinates ) ) {
+    const size_t header = 4 * sizeof (Integer);
+    size_t size = 0;
+    Integer* cached = 0;
+    memcpy( key.bounds, data->arguments.bounds, sizeof key.bounds );
+    cached = readCache( SUBSET_CACHE_KIND, &key, sizeof key, &size );
+
+    if ( AND3( cached, size > header, size % sizeof (Integer) == 0 ) ) {
+      const Integer rows = data->rows;
+      const Integer columns = data->columns;
+      const Integer (* const subset )[ 2 ] = (const Integer (*)[ 2 ]) cached;
+      const Integer firstRow    = subset[ ROW    ][ MINIMUM ];
+      const Integer lastRow     = subset[ ROW    ][ MAXIMUM ];
+      const Integer firstColumn = subset[ COLUMN ][ MINIMUM ];
+      const Integer lastColumn  = subset[ COLUMN ][ MAXIMUM ];
+      const Integer points = ( size - header ) / sizeof (Integer);
+      const Integer* const indices = cached + 4;
+      Integer point = 0;
+      Integer previous = -1;
+      result =
+        AND5( IN_RANGE( firstRow, 0, rows - 1 ),
+              IN_RANGE( lastRow, firstRow, rows - 1 ),
+              IN_RANGE( firstColumn, 0, columns - 1 ),
+              IN_RANGE( lastColumn, firstColumn, columns - 1 ),
+              points <= ( lastRow - firstRow + 1 ) *
+                        ( lastColumn - firstColumn + 1 ) );
+
+      for ( point = 0; AND2( result, point < points ); ++point ) {
+        const Integer index = indices[ point ];
+        result =
+          AND3( index > previous,
+                IN_RANGE( index / columns, firstRow, lastRow ),
+                IN_RANGE( index % columns, firstColumn, lastColumn ) );
+        previous = index;
+      }
+
+      if ( result ) {
+        Integer* subsetIndices = NEW_ZERO( Integer, points );
+        result = subsetIndices != 0;
+
+        if ( result ) {
+          memcpy( subsetIndices, indices, points * sizeof (Integer) );
+          FREE( data->subsetIndices );
+          data->subsetIndices = subsetIndices;
+          data->subsetPoints = points;
+          data->subset[ ROW    ][ MINIMUM ] = firstRow;
+          data->subset[ ROW    ][ MAXIMUM ] = lastRow;
+          data->subset[ COLUMN ][ MINIMUM ] = firstColumn;
+          data->subset[ COLUMN ][ MAXIMUM ] = lastColumn;
         }
       }
     }
+
+    free( cached ), cached = 0;
   }
 
-  POST0( IMPLIES( data->ok, isValidScan( &data->scan ) ) );
+  DEBUG( fprintf( stderr, "readSubsetCache( %s ) = %lld\n",
+                  data->scan.coordinatesFileName, result ); )
+  POST02( IS_BOOL( result ),
+          IMPLIES( result,
+                   AND2( data->subsetIndices, data->subsetPoints > 0 ) ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeSubsetCache - Write grid points within bounds to the cache.
+INPUTS:  const Data* data  data->arguments.bounds,
+                           data->scan.coordinatesFileName, data->subset,
+                           data->subsetPoints, data->subsetIndices.
+******************************************************************************/
+
+static void writeSubsetCache( const Data* data ) {
+
+  PRE04( data, *data->scan.coordinatesFileName,
+         data->subsetPoints > 0, data->subsetIndices );
+
+  SubsetCacheKey key;
+  memset( &key, 0, sizeof key );
+
+  if ( coordinatesCacheKey( data->scan.coordinatesFileName,
+                            &key.coordinates ) ) {
+    const void* const payloads[ 2 ] = { data->subset, data->subsetIndices };
+    const size_t sizes[ 2 ] =
+      { sizeof data->subset, data->subsetPoints * sizeof (Integer) };
+    memcpy( key.bounds, data->arguments.bounds, sizeof key.bounds );
+    writeCache( SUBSET_CACHE_KIND, &key, sizeof key, 2, payloads, sizes );
+  }
 }
 
 
@@ -1216,26 +1755,29 @@ PURPOSE: parseHeader - Parse dimensions from a GOES header.
 INPUTS:  const char* buffer  String contents of a GOES file.
 OUTPTUS: Integer* rows       Number of data rows.
          Integer* columns    Number of data columns.
-         Variable variable   Or 0. If empty then init else verify match.
+         Variable variable   Or 0. If not 0 then product name of file.
          FileName coordinatesFileName  If not 0 then
                                        Name of corresponding coordinates file.
+         FileError* error    Why the header could not be parsed, if known.
 RETURNS: const char* pointer into buffer of start of data or 0 if failed to
-         parse valid header content and failureMessage() is called.
+         parse valid header content.
+NOTES:   Called in parallel so it does not call failureMessage().
 ******************************************************************************/
 
 static const char* parseHeader( const char* buffer,
                                 Integer* rows, Integer* columns,
                                 Variable variable,
-                                FileName coordinatesFileName ) {
-  PRE03( buffer, rows, columns );
+                                FileName coordinatesFileName,
+                                FileError* error ) {
+  PRE04( buffer, rows, columns, error );
   const char* result = 0;
-  const Integer headerLines = parseCount( buffer, "hdr_lines" );
+  const Integer headerLines = parseCount( buffer, "hdr_lines", error );
 
   if ( headerLines > 0 ) {
-    *columns = parseCount( buffer, "NX" );
+    *columns = parseCount( buffer, "NX", error );
 
     if ( *columns > 0 ) {
-      *rows = parseCount( buffer, "NY" );
+      *rows = parseCount( buffer, "NY", error );
 
       if ( *rows * *columns > 0 ) {
         result = skipLines( buffer, headerLines );
@@ -1243,25 +1785,17 @@ static const char* parseHeader( const char* buffer,
         if ( result ) {
 
           if ( variable ) {
-            const char* const name = parseWord( buffer, "product" );
+            const char* const name = parseWord( buffer, "product", error );
 
             if ( name ) {
-
-              if ( *variable == '\0' ) { /* Initialize variable: */
-                memset( variable, 0, sizeof (Variable) );
-                copyWord( variable, name,
-                          sizeof (Variable) / sizeof *variable - 1 );
-              } else if ( strncmp( variable, name, strlen( variable ) ) ) {
-                failureMessage( "Data file product name does not match "
-                                "expected variable name '%s'.",
-                                variable ); 
-                result = 0;
-              }
+              memset( variable, 0, sizeof (Variable) );
+              copyWord( variable, name,
+                        sizeof (Variable) / sizeof *variable - 1 );
             }
           }
 
           if ( AND2( result, coordinatesFileName ) ) {
-            const char* const name = parseWord( buffer, "georef" );
+            const char* const name = parseWord( buffer, "georef", error );
 
             if ( name ) {
               memset( coordinatesFileName, 0, sizeof (FileName) );
@@ -1306,11 +1840,13 @@ static const char* parseHeader( const char* buffer,
 PURPOSE: parseCount - Read an integer value > 0 for given name in a string.
 INPUTS:  const char* header   GOES header string to parse.
          const char* name     Name of value to parse.
-RETURNS: Integer value > 0 or 0 if failed and failureMessage() is called.
+OUTPUTS: FileError* error     COUNT_ERROR if failed.
+RETURNS: Integer value > 0 or 0 if failed.
 ******************************************************************************/
 
-static Integer parseCount( const char* header, const char* name ) {
-  PRE03( header, name, *name );
+static Integer parseCount( const char* header, const char* name,
+                           FileError* error ) {
+  PRE04( header, name, *name, error );
   Integer result = 0;
   const char* const line = strstr( header, name );
 
@@ -1324,7 +1860,8 @@ static Integer parseCount( const char* header, const char* name ) {
   }
 
   if ( ! result ) {
-    failureMessage( "Failed to read valid count for %s in header.", name );
+    error->code = COUNT_ERROR;
+    error->name = name;
   }
 
   return result;
@@ -1336,11 +1873,13 @@ static Integer parseCount( const char* header, const char* name ) {
 PURPOSE: parseWord - Find a word value for given name in a string.
 INPUTS:  const char* header   GOES header string to parse.
          const char* name     Name of value to parse.
-RETURNS: const char* start of word or 0 if failed and failureMessage() called.
+OUTPUTS: FileError* error     WORD_ERROR if failed.
+RETURNS: const char* start of word or 0 if failed.
 ******************************************************************************/
 
-static const char* parseWord( const char* header, const char* name ) {
-  PRE03( header, name, *name );
+static const char* parseWord( const char* header, const char* name,
+                              FileError* error ) {
+  PRE04( header, name, *name, error );
   const char* result = 0;
   const char* const line = strstr( header, name );
 
@@ -1357,7 +1896,8 @@ static const char* parseWord( const char* header, const char* name ) {
   }
 
   if ( ! result ) {
-    failureMessage( "Failed to read valid word for %s in header.", name );
+    error->code = WORD_ERROR;
+    error->name = name;
   }
 
   return result;
@@ -1371,7 +1911,7 @@ INPUTS:  const char* content  GOES data string to parse.
          const Integer count  Number of values to parse.
 OUTPUTS: Real data[ count ]   Data values read.
          Real data2[ count ]  0 or 2nd data values read (if lonlats).
-RETURNS: Integer 1 if valid values or 0 if failed and failureMessage() called.
+RETURNS: Integer 1 if valid values or 0 if failed.
 ******************************************************************************/
 
 static Integer parseData( const char* buffer, const Integer count,
@@ -1484,50 +2024,44 @@ static Integer timestampOfFileName( const char* fileName ) {
 
 /******************************************************************************
 PURPOSE: subsetScan - Subset scan by bounds and data filtering.
-INPUTS:  const Bounds bounds         Subset longitude-latitude bounds.
-         const Integer subset[2][2]  Subset indices[ ROW COLUMN][MIN/MAXIMUM].
+INPUTS:  const Bounds bounds          Subset longitude-latitude bounds.
+         const Integer subsetPoints   Number of grid points within bounds.
+         const Integer subsetIndices[ subsetPoints ]  Grid indices in bounds.
          const Real longitudes[rows][columns]     Longitudes.
          const Real latitudes[rows][columns]      Latitudes.
          const Real corners[2][4][rows][columns]  lonlat corners or 0.
          Scan* scan                               Uncompressed scan.
-OUTPUTS: Scan* scan  scan->data[ rows ][ columns ] Zero'd by filter.
 RETURNS: SubsettedScan* if successful, else 0 if no points are in the subset or
          there was a memory allocation failure and failureMessage() is called.
 NOTES:   Must use FREE() on returned result when finished.
 ******************************************************************************/
 
 static SubsettedScan* subsetScan( const Bounds bounds,
-                                  const Integer subset[ 2 ][ 2 ],
+                                  const Integer subsetPoints,
+                                  const Integer subsetIndices[],
                                   const Real longitudes[],
                                   const Real latitudes[],
                                   const Real corners[],
                                   Scan* scan ) {
 
-  PRE010( isValidBounds( bounds ),
-          isValidScan( scan ),
-          IN_RANGE( subset[ ROW ][ MINIMUM ], 0, scan->rows - 1 ),
-          IN_RANGE( subset[ ROW ][ MAXIMUM ],
-                    subset[ ROW ][ MINIMUM ], scan->rows - 1 ),
-          IN_RANGE( subset[ COLUMN ][ MINIMUM ], 0, scan->columns - 1 ),
-          IN_RANGE( subset[ COLUMN ][ MAXIMUM ],
-                    subset[ COLUMN ][ MINIMUM ], scan->columns - 1 ),
-          longitudes,
-          latitudes,
-          validLongitudesAndLatitudes( scan->rows * scan->columns,
-                                       longitudes, latitudes ),
-          IMPLIES( corners,
-                   validLongitudesAndLatitudes( scan->rows * scan->columns * 4,
-                                                corners,
-                                                corners +
-                                                  scan->rows *
-                                                  scan->columns * 4 ) ) );
+  PRE09( isValidBounds( bounds ),
+         isValidScan( scan ),
+         IN_RANGE( subsetPoints, 1, scan->rows * scan->columns ),
+         subsetIndices,
+         IN_RANGE( subsetIndices[ 0 ], 0, scan->rows * scan->columns - 1 ),
+         IN_RANGE( subsetIndices[ subsetPoints - 1 ],
+                   subsetIndices[ 0 ], scan->rows * scan->columns - 1 ),
+         longitudes,
+         latitudes,
+         IMPLIES( corners,
+                  validLongitudesAndLatitudes( scan->rows * scan->columns * 4,
+                                               corners,
+                                               corners +
+                                                 scan->rows *
+                                                 scan->columns * 4 ) ) );
 
   SubsettedScan* result = 0;
-  Integer filteredSubset[ 2 ][ 2 ] = { { 0, 0 }, { 0, 0 } };
-  const void* const unused_ =
-    memcpy( filteredSubset, subset, sizeof filteredSubset );
-  const Integer points =
-    subsetScanCount( bounds, longitudes, latitudes, filteredSubset, scan );
+  const Integer points = subsetScanCount( subsetPoints, subsetIndices, scan );
 
   if ( points ) { /* If not all points are filtered-out, copy subset of them:*/
     result = NEW_ZERO( SubsettedScan, 1 );
@@ -1559,14 +2093,8 @@ static SubsettedScan* subsetScan( const Bounds bounds,
           corners ? subsetLatitudesSE + points : 0;
         Real* const subsetLatitudesNE  =
           corners ? subsetLatitudesNW + points : 0;
-        const Integer firstRow    = filteredSubset[ ROW    ][ MINIMUM ];
-        const Integer lastRow     = filteredSubset[ ROW    ][ MAXIMUM ];
-        const Integer firstColumn = filteredSubset[ COLUMN ][ MINIMUM ];
-        const Integer lastColumn  = filteredSubset[ COLUMN ][ MAXIMUM ];
 
-        CHECK( IN_RANGE( ( 1 + lastRow - firstRow ) *
-                         ( 1 + lastColumn - firstColumn ),
-                          points, scan->rows * scan->columns ) );
+        CHECK( IN_RANGE( points, 1, subsetPoints ) );
 
         copySubsetLongitudesAndLatitudes( scan->rows,
                                           scan->columns,
@@ -1575,8 +2103,8 @@ static SubsettedScan* subsetScan( const Bounds bounds,
                                           corners,
                                           scan->data,
                                           points,
-                                          firstRow, lastRow,
-                                          firstColumn, lastColumn,
+                                          subsetPoints,
+                                          subsetIndices,
                                           subsetLongitudes,
                                           subsetLatitudes,
                                           subsetLongitudesSW,
@@ -1589,8 +2117,7 @@ static SubsettedScan* subsetScan( const Bounds bounds,
                                           subsetLatitudesNE );
 
         copySubsetData( scan->rows, scan->columns, scan->data,
-                        firstRow, lastRow, firstColumn, lastColumn,
-                        subsetData );
+                        subsetPoints, subsetIndices, subsetData );
       }
     }
   }
@@ -1615,98 +2142,36 @@ static SubsettedScan* subsetScan( const Bounds bounds,
 
 
 /******************************************************************************
-PURPOSE: subsetScanCount - Count scan points subsetted by indices and ranges.
-INPUTS:  const Bounds bounds                  Subset lon-lat bounds.
-         const Real ranges[ VARIABLES ][ 2 ]  Data ranges to filter by.
-         Integer subset[ 2 ][ 2 ]             subset[ROW COLUMN][MIN/MAXIMUM].
-         const Real longitudes[ scan->rows ][ scan->rows ]  Longitudes.
-         const Real latitudes[ scan->rows ][ scan->rows ]   Latitudes.
-         Scan* scan                           Uncompressed & decoded scan.
-OUTPUTS: Integer subset[ 2 ][ 2 ]  Subset indices reduced by bounds/filtering.
+PURPOSE: subsetScanCount - Count valid scan points within bounds.
+INPUTS:  const Integer subsetPoints   Number of grid points within bounds.
+         const Integer subsetIndices[ subsetPoints ]  Grid indices in bounds.
+         const Scan* scan             Uncompressed scan.
 RETURNS: Integer number of points remaining after subsetting/filtering.
+NOTES:   Bounds were applied once per coordinates file by
+         subsetPointsByBounds() so only the data is tested here.
 ******************************************************************************/
 
-static Integer subsetScanCount( const Bounds bounds,
-                                const Real longitudes[],
-                                const Real latitudes[],
-                                Integer subset[ 2 ][ 2 ],
-                                Scan* scan ) {
+static Integer subsetScanCount( const Integer subsetPoints,
+                                const Integer subsetIndices[],
+                                const Scan* scan ) {
 
-  PRE08( isValidBounds( bounds ),
-         isValidScan( scan ),
-         subset,
-         IN_RANGE( subset[ ROW ][ MINIMUM ], 0, scan->rows - 1 ),
-         IN_RANGE( subset[ ROW ][ MAXIMUM ],
-                   subset[ ROW ][ MINIMUM ], scan->rows - 1 ),
-         IN_RANGE( subset[ COLUMN ][ MINIMUM ], 0, scan->columns - 1 ),
-         IN_RANGE( subset[ COLUMN ][ MAXIMUM ],
-                   subset[ COLUMN ][ MINIMUM ], scan->columns - 1 ),
-         validLongitudesAndLatitudes( scan->rows * scan->columns,
-                                      longitudes, latitudes ) );
-
-  Real* const data = scan->data;
-  const Integer rows          = scan->rows;
-  const Integer columns       = scan->columns;
-  const Integer firstRow      = subset[ ROW    ][ MINIMUM ];
-  const Integer lastRow       = subset[ ROW    ][ MAXIMUM ];
-  const Integer firstColumn   = subset[ COLUMN ][ MINIMUM ];
-  const Integer lastColumn    = subset[ COLUMN ][ MAXIMUM ];
-  const Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
-  const Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
-  const Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
-  const Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
-  Integer result = 0;
-  Integer row = 0;
+  PRE04( isValidScan( scan ),
+         IN_RANGE( subsetPoints, 1, scan->rows * scan->columns ),
+         subsetIndices,
+         IN_RANGE( subsetIndices[ subsetPoints - 1 ],
+                   0, scan->rows * scan->columns - 1 ) );
 
-  /* Compute reduced mask in parallel: */
+  const Real* const data = scan->data;
+  Integer result = 0;
+  Integer point = 0;
 
 #pragma omp parallel for reduction( + : result )
 
-  for ( row = firstRow; row <= lastRow; ++row ) {
-    const Integer rowOffset = row * columns;
-    Integer column = 0;
-    CHECK( rowOffset + lastColumn < scan->rows * scan->columns );
-
-    for ( column = firstColumn; column <= lastColumn; ++column ) {
-      const Integer index = rowOffset + column;
-      const Real longitude = longitudes[ index ];
-      const Real latitude  = latitudes[ index ];
-      const Real value = data[ index ];
-      const Integer output =
-        AND3( value >= 0.0,
-              IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
-              IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ) );
-      result += output;
-      data[ index ] = output ? value : MISSING;
-    }
-  }
-
-  /* Compute reduced subset sequentially: */
-
-  if ( result ) {
-    reduceSubset( rows, columns, data,
-                  &subset[ ROW ][ MINIMUM ],
-                  &subset[ ROW ][ MAXIMUM ],
-                  &subset[ COLUMN ][ MINIMUM ],
-                  &subset[ COLUMN ][ MAXIMUM ] );
-
-    CHECK4( IN_RANGE( subset[ ROW ][ MINIMUM ], firstRow, lastRow ),
-            IN_RANGE( subset[ ROW ][ MAXIMUM ],
-                      subset[ ROW ][ MINIMUM ], lastRow ),
-            IN_RANGE( subset[ COLUMN ][ MINIMUM ], firstColumn, lastColumn ),
-            IN_RANGE( subset[ COLUMN ][ MAXIMUM ],
-                      subset[ COLUMN ][ MINIMUM ], lastColumn ) );
+  for ( point = 0; point < subsetPoints; ++point ) {
+    result += data[ subsetIndices[ point ] ] >= 0.0;
   }
 
-  POST06( result >= 0,
-          isValidScan( scan ),
-          IN_RANGE( subset[ ROW ][ MINIMUM ], 0, scan->rows - 1 ),
-          IN_RANGE( subset[ ROW ][ MAXIMUM ],
-                    subset[ ROW ][ MINIMUM ], scan->rows - 1 ),
-          IN_RANGE( subset[ COLUMN ][ MINIMUM ], 0, scan->columns - 1 ),
-          IN_RANGE( subset[ COLUMN ][ MAXIMUM ],
-                    subset[ COLUMN ][ MINIMUM ], scan->columns - 1 ) );
-
+  POST0( IN_RANGE( result, 0, subsetPoints ) );
   return result;
 }
 
@@ -1861,127 +2326,103 @@ static Integer subsetIndicesByBounds( const Bounds bounds,
 
 
 /******************************************************************************
-PURPOSE: reduceSubset - Reduce subset row and column indices by MISSING data.
-INPUTS:  const Real data[ rows ][ columns ]  Subset-modified data.
-         Integer*   firstRow     Index of first row of bounds subset.
-         Integer*   lastRow      Index of alst row of bounds subset.
-         Integer*   firstColumn  Index of first column of bounds subset.
-         Integer*   lastColumn   Index of last column of bounds subset.
-OUTPUTS: Integer*   firstRow     Index of first row of mask-filtered subset.
-         Integer*   lastRow      Index of last row of mask-filtered subset.
-         Integer*   firstColumn  Index of first column of mask-filtered subset.
-         Integer*   lastColumn   Index of last column of mask-filtered subset.
+PURPOSE: subsetPointsByBounds - Grid indices of points within bounds.
+INPUTS:  const Bounds bounds    Longitude-latitude bounds of subset.
+         const Integer rows     Number of row points.
+         const Integer columns  Number of column points.
+         const Real longitudes[ rows ][ columns ]  Longitudes.
+         const Real latitudes[  rows ][ columns ]  Latitudes.
+         const Integer subset[ 2 ][ 2 ]  subset[ROW COLUMN][MINIMUM MAXIMUM]
+                                         from subsetIndicesByBounds().
+OUTPUTS: Integer* points        Number of grid points within bounds.
+RETURNS: Integer* indices[ points ] in increasing (row-major) order if
+         successful, else 0 and failureMessage() is called.
+NOTES:   The coordinates are fixed per coordinates file so this is computed
+         once then reused by subsetScan() and subsetScanCount() for each scan.
+         Must use FREE() on returned result when finished.
 ******************************************************************************/
 
-static void reduceSubset( const Integer rows, const Integer columns,
-                          const Real data[],
-                          Integer* firstRow, Integer* lastRow,
-                          Integer* firstColumn, Integer* lastColumn) {
-
-  PRE012( rows > 0,
-          columns > 0,
-          rows * columns > 0,
-          isNanFree( data, rows * columns ),
-          firstRow,
-          lastRow,
-          firstColumn,
-          lastColumn,
-          IN_RANGE( *firstRow, 0, rows - 1 ),
-          IN_RANGE( *lastRow, *firstRow, rows - 1 ),
-          IN_RANGE( *firstColumn, 0, columns - 1 ),
-          IN_RANGE( *lastColumn, *firstColumn, columns - 1 ) );
-
-  CHECKING( const Integer OLD( firstRow ) = *firstRow; )
-  CHECKING( const Integer OLD( lastRow ) = *lastRow; )
-  CHECKING( const Integer OLD( firstColumn ) = *firstColumn; )
-  CHECKING( const Integer OLD( lastColumn ) = *lastColumn; )
-  Integer theFirstRow    = *firstRow;
-  Integer theLastRow     = *lastRow;
-  Integer theFirstColumn = *firstColumn;
-  Integer theLastColumn  = *lastColumn;
-  Integer row = 0;
-  Integer column = 0;
-
-  /* Loop forward through rows to find first subset row: */
-
-  for ( row = theFirstRow; row <= theLastRow; ++row ) {
-    const Integer rowOffset = row * columns;
-    CHECK( rowOffset + theLastColumn < rows * columns );
-
-    for ( column = theFirstColumn; column <= theLastColumn; ++column ) {
-      const Integer index = rowOffset + column;
-      const Real value = data[ index ];
+static Integer* subsetPointsByBounds( const Bounds bounds,
+                                      const Integer rows,
+                                      const Integer columns,
+                                      const Real longitudes[],
+                                      const Real latitudes[],
+                                      const Integer subset[ 2 ][ 2 ],
+                                      Integer* points ) {
 
-      if ( value >= 0.0 ) {
-        theFirstRow = row;
-        row = rows;
-        column = columns;
-      }
-    }
-  }
+  PRE011( bounds, isValidBounds( bounds ),
+          rows > 0, columns > 0, rows * columns > 0,
+          validLongitudesAndLatitudes( rows * columns, longitudes, latitudes ),
+          IN_RANGE( subset[ ROW ][ MINIMUM ], 0, rows - 1 ),
+          IN_RANGE( subset[ ROW ][ MAXIMUM ],
+                    subset[ ROW ][ MINIMUM ], rows - 1 ),
+          IN_RANGE( subset[ COLUMN ][ MINIMUM ], 0, columns - 1 ),
+          IN_RANGE( subset[ COLUMN ][ MAXIMUM ],
+                    subset[ COLUMN ][ MINIMUM ], columns - 1 ),
+          points );
 
-  /* Loop backward through rows to find last subset row: */
+  const Integer firstRow    = subset[ ROW    ][ MINIMUM ];
+  const Integer lastRow     = subset[ ROW    ][ MAXIMUM ];
+  const Integer firstColumn = subset[ COLUMN ][ MINIMUM ];
+  const Integer lastColumn  = subset[ COLUMN ][ MAXIMUM ];
+  const Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
+  const Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
+  const Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
+  const Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
+  Integer* result = 0;
+  Integer count = 0;
+  Integer pass = 0;
 
-  for ( row = theLastRow; row >= theFirstRow; --row ) {
-    const Integer rowOffset = row * columns;
-    CHECK( rowOffset + theLastColumn < rows * columns );
+  *points = 0;
 
-    for ( column = theFirstColumn; column <= theLastColumn; ++column ) {
-      const Integer index = rowOffset + column;
-      const Real value = data[ index ];
+  /* First pass counts, second pass stores indices: */
 
-      if ( value >= 0.0 ) {
-        theLastRow = row;
-        row = 0;
-        column = columns;
-      }
-    }
-  }
+  for ( pass = 0; pass < 2; ++pass ) {
+    Integer row = 0;
+    count = 0;
 
-  CHECK2( IN_RANGE( theFirstRow, *firstRow, *lastRow ),
-          IN_RANGE( theLastRow, theFirstRow, *lastRow ) );
+    for ( row = firstRow; row <= lastRow; ++row ) {
+      const Integer rowOffset = row * columns;
+      Integer column = 0;
+      CHECK( rowOffset + lastColumn < rows * columns );
 
-  /* Loop forward through columns to find first subset column: */
+      for ( column = firstColumn; column <= lastColumn; ++column ) {
+        const Integer index = rowOffset + column;
+        const Real longitude = longitudes[ index ];
+        const Real latitude  = latitudes[ index ];
 
-  for ( column = theFirstColumn; column <= theLastColumn; ++column ) {
+        if ( AND2( IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
+                   IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ) )) {
 
-    for ( row = theFirstRow; row <= theLastRow; ++row ) {
-      const Integer index = row * columns + column;
-      const Real value = data[ index ];
+          if ( result ) {
+            result[ count ] = index;
+          }
 
-      if ( value >= 0.0 ) {
-        theFirstColumn = column;
-        row = rows;
-        column = columns;
+          ++count;
+        }
       }
     }
-  }
-
-  /* Loop backward through columns to find last subset column: */
 
-  for ( column = theLastColumn; column >= theFirstColumn; --column ) {
+    if ( pass == 0 ) {
+      result = count ? NEW_ZERO( Integer, count ) : 0;
 
-    for ( row = theFirstRow; row <= theLastRow; ++row ) {
-      const Integer index = row * columns + column;
-      const Real value = data[ index ];
-
-      if ( value >= 0.0 ) {
-        theLastColumn = column;
-        row = rows;
-        column = 0;
+      if ( ! result ) {
+        pass = 2;
       }
     }
   }
 
-  *firstRow    = theFirstRow;
-  *lastRow     = theLastRow;
-  *firstColumn = theFirstColumn;
-  *lastColumn  = theLastColumn;
+  if ( result ) {
+    *points = count;
+  }
 
-  POST04( IN_RANGE( *firstRow, OLD( firstRow ), OLD( lastRow ) ),
-          IN_RANGE( *lastRow, *firstRow, OLD( lastRow ) ),
-          IN_RANGE( *firstColumn, OLD( firstColumn ), OLD( lastColumn ) ),
-          IN_RANGE( *lastColumn, *firstColumn, OLD( lastColumn ) ) );
+  POST0( IMPLIES_ELSE( result,
+                       AND3( *points > 0,
+                             IN_RANGE( result[ 0 ], 0, rows * columns - 1 ),
+                             IN_RANGE( result[ *points - 1 ],
+                                       result[ 0 ], rows * columns - 1 ) ),
+                       *points == 0 ) );
+  return result;
 }
 
 
@@ -1994,12 +2435,10 @@ INPUTS:  const Integer rows                  Number of data rows.
          const Real longitudes[ rows ][ columns ]  Data longitudes.
          const Real latitudes[  rows ][ columns ]  Data latitudes.
          const Real corners[ 2 ][ 4 ][  rows ][ columns ]  Lonlat corners or 0.
-         const Real data[ rows ][ columns ]  Subset-modified data.
+         const Real data[ rows ][ columns ]  Scan data.
          Integer    points       Number of subset points.
-         Integer    firstRow     Index of first row of subset.
-         Integer    lastRow      Index of alst row os subset.
-         Integer    firstColumn  Index of first column of subset.
-         Integer    lastColumn   Index of last column of subset.
+         Integer    subsetPoints Number of grid points within bounds.
+         const Integer subsetIndices[ subsetPoints ] Grid indices in bounds.
 OUTPUTS: Real subsetLongitudes[ points ]  Longitudes to append to.
          Real subsetLatitudes[ points ]   Latitudes to append to.
          Real subsetLongitudesSW[ points ]  Optional: for corners or 0.
@@ -2020,10 +2459,8 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                               const Real corners[],
                                               const Real data[],
                                               Integer points,
-                                              Integer firstRow,
-                                              Integer lastRow,
-                                              Integer firstColumn,
-                                              Integer lastColumn,
+                                              Integer subsetPoints,
+                                              const Integer subsetIndices[],
                                               Real subsetLongitudes[],
                                               Real subsetLatitudes[],
                                               Real subsetLongitudesSW[],
@@ -2035,7 +2472,7 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                               Real subsetLatitudesNW[],
                                               Real subsetLatitudesNE[] ) {
 
-  PRE016( rows > 0,
+  PRE015( rows > 0,
           columns > 0,
           rows * columns > 0,
           longitudes,
@@ -2046,12 +2483,10 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                                 corners,
                                                 corners + rows * columns * 4)),
           isNanFree( data, rows * columns ),
-          IN_RANGE( points, 1,
-                    (1 + lastRow - firstRow) * (1 + lastColumn - firstColumn)),
-          IN_RANGE( firstRow, 0, rows - 1 ),
-          IN_RANGE( lastRow, firstRow, rows - 1 ),
-          IN_RANGE( firstColumn, 0, columns - 1 ),
-          IN_RANGE( lastColumn, firstColumn, columns - 1 ),
+          IN_RANGE( points, 1, subsetPoints ),
+          IN_RANGE( subsetPoints, 1, rows * columns ),
+          subsetIndices,
+          IN_RANGE( subsetIndices[ subsetPoints - 1 ], 0, rows * columns - 1),
           subsetLongitudes,
           subsetLatitudes,
           IMPLIES_ELSE( subsetLongitudesSW,
@@ -2071,7 +2506,7 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
                                   subsetLatitudesNE ) ) );
 
   CHECKING( Integer count = 0; )
-  Integer row = 0;
+  Integer point = 0;
   Integer output = 0;
   const Integer rowsTimesColumns = rows * columns;
   const Real* const longitudesSW = corners;
@@ -2083,38 +2518,32 @@ static void copySubsetLongitudesAndLatitudes( const Integer rows,
   const Real* const latitudesNW  = corners ? corners + rowsTimesColumns * 6 :0;
   const Real* const latitudesNE  = corners ? corners + rowsTimesColumns * 7 :0;
 
-  for ( row = firstRow; row <= lastRow; ++row ) {
-    const Integer rowOffset = row * columns;
-    Integer column = 0;
-    CHECK( rowOffset + lastColumn < rows * columns );
-
-    for ( column = firstColumn; column <= lastColumn; ++column ) {
-      const Integer index = rowOffset + column;
-      const Real value = data[ index ];
-
-      if ( value >= 0.0 ) {
-        const Real longitude = longitudes[ index ];
-        const Real latitude  = latitudes[ index ];
-        CHECKING( ++count; )
-        CHECK3( IN_RANGE( longitude, -180.0, 180.0 ),
-                IN_RANGE( latitude, -90.0, 90.0 ),
-                IN_RANGE( count, 1, points ) );
-        subsetLongitudes[ output ] = longitude;
-        subsetLatitudes[  output ] = latitude;
-
-        if ( subsetLongitudesSW ) {
-          subsetLongitudesSW[ output ] = longitudesSW[ index ];
-          subsetLongitudesSE[ output ] = longitudesSE[ index ];
-          subsetLongitudesNW[ output ] = longitudesNW[ index ];
-          subsetLongitudesNE[ output ] = longitudesNE[ index ];
-          subsetLatitudesSW[  output ] = latitudesSW[ index ];
-          subsetLatitudesSE[  output ] = latitudesSE[ index ];
-          subsetLatitudesNW[  output ] = latitudesNW[ index ];
-          subsetLatitudesNE[  output ] = latitudesNE[ index ];
-        }
+  for ( point = 0; point < subsetPoints; ++point ) {
+    const Integer index = subsetIndices[ point ];
+    const Real value = data[ index ];
 
-        ++output;
+    if ( value >= 0.0 ) {
+      const Real longitude = longitudes[ index ];
+      const Real latitude  = latitudes[ index ];
+      CHECKING( ++count; )
+      CHECK3( IN_RANGE( longitude, -180.0, 180.0 ),
+              IN_RANGE( latitude, -90.0, 90.0 ),
+              IN_RANGE( count, 1, points ) );
+      subsetLongitudes[ output ] = longitude;
+      subsetLatitudes[  output ] = latitude;
+
+      if ( subsetLongitudesSW ) {
+        subsetLongitudesSW[ output ] = longitudesSW[ index ];
+        subsetLongitudesSE[ output ] = longitudesSE[ index ];
+        subsetLongitudesNW[ output ] = longitudesNW[ index ];
+        subsetLongitudesNE[ output ] = longitudesNE[ index ];
+        subsetLatitudesSW[  output ] = latitudesSW[ index ];
+        subsetLatitudesSE[  output ] = latitudesSE[ index ];
+        subsetLatitudesNW[  output ] = latitudesNW[ index ];
+        subsetLatitudesNE[  output ] = latitudesNE[ index ];
       }
+
+      ++output;
     }
   }
 
@@ -2142,50 +2571,38 @@ PURPOSE: copySubsetData - Copy subsetted/filtered variable data.
 INPUTS:  const Integer rows                  Number of data rows.
          const Integer columns               Number of data columns.
          const Real data[ rows ][ columns ]  Data to copy.
-         Integer     firstRow     Index of first row of subset.
-         Integer     lastRow      Index of alst row os subset.
-         Integer     firstColumn  Index of first column of subset.
-         Integer     lastColumn   Index of last column of subset.
+         Integer     subsetPoints Number of grid points within bounds.
+         const Integer subsetIndices[ subsetPoints ] Grid indices in bounds.
          Real        output[ points ] Array of subset data to append data to.
 ******************************************************************************/
 
 static void copySubsetData( const Integer rows, const Integer columns,
                             const Real data[],
-                            Integer firstRow, Integer lastRow,
-                            Integer firstColumn, Integer lastColumn,
+                            Integer subsetPoints,
+                            const Integer subsetIndices[],
                             Real output[] ) {
 
-  PRE010( rows > 0,
-          columns > 0,
-          rows * columns > 0,
-          data,
-          isNanFree( data, rows * columns ),
-          IN_RANGE( firstRow, 0, rows - 1 ),
-          IN_RANGE( lastRow, firstRow, rows - 1 ),
-          IN_RANGE( firstColumn, 0, columns - 1 ),
-          IN_RANGE( lastColumn, firstColumn, columns - 1 ),
-          output );
+  PRE09( rows > 0,
+         columns > 0,
+         rows * columns > 0,
+         data,
+         isNanFree( data, rows * columns ),
+         IN_RANGE( subsetPoints, 1, rows * columns ),
+         subsetIndices,
+         IN_RANGE( subsetIndices[ subsetPoints - 1 ], 0, rows * columns - 1 ),
+         output );
 
   CHECKING( Integer points = 0; )
   Real* values = output;
-  Integer row = 0;
+  Integer point = 0;
 
-  for ( row = firstRow; row <= lastRow; ++row ) {
-    const Integer rowOffset = row * columns;
-    Integer column = 0;
-    CHECK( rowOffset + lastColumn < rows * columns );
+  for ( point = 0; point < subsetPoints; ++point ) {
+    const Real value = data[ subsetIndices[ point ] ];
 
-    for ( column = firstColumn; column <= lastColumn; ++column ) {
-      const Integer index = rowOffset + column;
-      const Real value = data[ index ];
-
-      if ( value >= 0.0 ) {
-        CHECKING(  ++points; )
-        CHECK( IN_RANGE( points, 1,
-                        ( 1 + lastRow - firstRow ) *
-                        ( 1 + lastColumn - firstColumn ) ) );
-        *values++ = value;
-      }
+    if ( value >= 0.0 ) {
+      CHECKING(  ++points; )
+      CHECK( IN_RANGE( points, 1, subsetPoints ) );
+      *values++ = value;
     }
   }
 
@@ -2694,6 +3111,7 @@ static void writeScanData( const VoidList* scans, Stream* output ) {
     CHECK( isValidSubsettedScan( scan ) );
     output->write64BitReals( output, scan->data,
                              scan->variables * scan->points );
+    timingPoints( scan->points );
     ++scanIndex;
   } while ( AND2( output->ok( output ), scanIndex < scanCount ) );
 
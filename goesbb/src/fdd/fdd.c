@@ -23,7 +23,15 @@ STATUS:  unreviewed, untested.
 #include <limits.h>    /* For LONG_MAX, ULONG_MAX. */
 #include <unistd.h>    /* For unlink(). */
 #include <sys/types.h> /* For struct stat. */
-#include <sys/stat.h>  /* For stat(). */
+#include <sys/stat.h>  /* For stat(), fstat(). */
+
+#ifdef __linux__
+#include <sys/sendfile.h> /* For sendfile(). */
+#endif
+
+#ifdef __SSE2__
+#include <emmintrin.h> /* For __m128i, _mm_loadu_si128(), _mm_shufflelo_epi16()*/
+#endif
 
 /*================================== MACROS =================================*/
 
@@ -288,9 +296,19 @@ assert_static( LARGEST_WORD_SIZE >= sizeof (double) );
 assert_static( LARGEST_WORD_SIZE %  sizeof (double) == 0 );
 
 static const size_t minimumBufferSize = 1024 * 1024; /* 1MB. */
+static const size_t defaultBufferSize = 16 * 1024 * 1024; /* 16MB. */
 static const size_t maximumBufferSize =
   ULONG_MAX / LARGEST_WORD_SIZE - ULONG_MAX % LARGEST_WORD_SIZE;
 
+/* Buffer is page-aligned so swappers can use aligned SIMD loads/stores: */
+
+enum { BUFFER_ALIGNMENT = 4096 };
+assert_static( BUFFER_ALIGNMENT % LARGEST_WORD_SIZE == 0 );
+
+/* Largest number of bytes to copy per call to sendfile(): */
+
+static const size_t maximumSendSize = 1024 * 1024 * 1024; /* 1GB. */
+
 static const char* programName = 0;
 static int failures = 0; /* Number of program failures. */
 
@@ -304,6 +322,7 @@ static void allocate( Parameters* self );
 static void processArguments( int argc, char* argv[], Parameters* self );
 static void processArgument( const char* argument, Parameters* self );
 static void processFiles( Parameters* self );
+static int copyFile( Parameters* self );
 static void processSubset( Parameters* self );
 static void processAll( Parameters* self );
 static void checkWordSizes( Parameters* self, const char* option );
@@ -317,6 +336,9 @@ static void swapper8( Parameters* self, size_t count );
 static void swapper4( Parameters* self, size_t count );
 static void swapper2( Parameters* self, size_t count );
 static void seekFiles( Parameters* self );
+#ifdef __SSE2__
+static __m128i swapBytes2( __m128i words );
+#endif
 
 /* Helpers: */
 
@@ -394,7 +416,7 @@ static void usage( const char* programName ) {
   fprintf( stderr, " [all]\n");
   fprintf( stderr, "                      (In words only if conv=ascii-*)\n");
   fprintf( stderr, "  cbs=bytes           Size of i/o buffer. " );
-  fprintf( stderr, "            [1048576]\n");
+  fprintf( stderr, "            [16777216]\n");
   fprintf( stderr, "  conv=swab           Byte swap 2-byte words." );
   fprintf( stderr, "         [no swap]\n");
   fprintf( stderr, "  conv=swab2          Byte swap 2-byte words." );
@@ -521,7 +543,9 @@ static void allocate( Parameters* self ) {
                          IS_SEEKABLE( self->outputFile ) ),
                    self->outputFileName ) );
 
-  self->buffer = malloc( self->bufferSize );
+  if ( posix_memalign( &self->buffer, BUFFER_ALIGNMENT, self->bufferSize )) {
+    self->buffer = 0;
+  }
 
   if ( ! self->buffer ) {
     self->ok = 0;
@@ -566,11 +590,13 @@ static void processArguments( int argc, char* argv[], Parameters* self ) {
   assert( minimumBufferSize < maximumBufferSize );
   assert( minimumBufferSize % LARGEST_WORD_SIZE == 0 );
   assert( maximumBufferSize % LARGEST_WORD_SIZE == 0 );
+  assert( IN_RANGE( defaultBufferSize, minimumBufferSize, maximumBufferSize));
+  assert( defaultBufferSize % BUFFER_ALIGNMENT == 0 );
 
   ZERO_OBJECT( self );
   self->inputFile  = stdin;
   self->outputFile = stdout;
-  self->bufferSize = minimumBufferSize;
+  self->bufferSize = defaultBufferSize;
   self->ok = 1;
 
   for ( argument = 1; AND2( self->ok, argument < argc ); ++argument ) {
@@ -602,6 +628,8 @@ static void processFiles( Parameters* self ) {
 
     if ( IS_READ_ASCII_MODE( self->mode ) ) {
       readASCII( self );
+    } else if ( copyFile( self ) ) {
+      /* Copied by the kernel without using the buffer. */
     } else if ( self->count ) { /* Read a specified subset of bytes: */
       processSubset( self );
     } else { /* Read until the end of the input file: */
@@ -618,6 +646,102 @@ static void processFiles( Parameters* self ) {
 
 
 
+/******************************************************************************
+PURPOSE: copyFile - Copy bytes from the input file to the output file without
+         reading them into the buffer, if possible.
+INPUTS:  Parameters* self  Object containing parameters for processing.
+RETURNS: int 1 if the bytes were copied (or the copy failed and self->ok = 0),
+         else 0 if this fast path does not apply and nothing was written.
+NOTES:   Only applies to unconverted (no conv=) copies from a regular input
+         file (if=file) on Linux, which uses sendfile() so the data is copied
+         by the kernel from the page cache directly to the output file/pipe.
+         This is the common 'fdd if=file iseek=bytes count=bytes' case.
+         Input and output file offsets are those established by seekFiles().
+         If count= exceeds the bytes remaining in the input file then this
+         fast path does not apply so processSubset() fails the same way as
+         before (writing only the complete buffers read before end of input).
+******************************************************************************/
+
+static int copyFile( Parameters* self ) {
+  int result = 0;
+  assert( invariant( self ) ); assert( self->ok );
+
+#ifdef __linux__
+
+  if ( AND3( self->mode == BINARY, self->swapper == 0,
+             IS_SEEKABLE( self->inputFile ) ) ) {
+    const int inputFile  = fileno( self->inputFile );
+    const int outputFile = fileno( self->outputFile );
+    struct stat status;
+    memset( &status, 0, sizeof status );
+
+    if ( AND3( fstat( inputFile, &status ) == 0, S_ISREG( status.st_mode ),
+               fflush( self->outputFile ) == 0 ) ) {
+      off_t inputOffset = ftello( self->inputFile );
+      int ok =
+        AND2( inputOffset >= 0,
+              IMPLIES( self->count,
+                       inputOffset <= status.st_size &&
+                       (size_t) ( status.st_size - inputOffset ) >=
+                         self->count ) );
+
+      /* Position output descriptor where the (flushed) stream would write: */
+
+      if ( AND2( ok, IS_SEEKABLE( self->outputFile ) ) ) {
+        const off_t outputOffset = ftello( self->outputFile );
+        ok = AND2( outputOffset >= 0,
+                   lseek( outputFile, outputOffset, SEEK_SET ) == outputOffset);
+      }
+
+      if ( ok ) {
+        size_t remainder = self->count; /* 0 means until end of input. */
+        size_t bytesProcessed = 0;
+        int done = 0;
+
+        do {
+          const size_t sendNow =
+            self->count ? MIN( remainder, maximumSendSize ) : maximumSendSize;
+          const ssize_t sent =
+            sendfile( outputFile, inputFile, &inputOffset, sendNow );
+
+          if ( sent > 0 ) {
+            bytesProcessed += sent;
+
+            if ( self->count ) {
+              remainder -= sent;
+              done = remainder == 0;
+            }
+          } else if ( sent == 0 ) { /* End of input file. */
+            done = 1;
+            self->ok = self->count == 0;
+          } else if ( AND2( bytesProcessed == 0,
+                            OR2( errno == EINVAL, errno == ENOSYS ) ) ) {
+            done = 1; /* sendfile() unsupported for these files so fall back.*/
+            errno = 0;
+          } else {
+            done = 1;
+            self->ok = 0;
+          }
+
+        } while ( ! done );
+
+        result = OR2( bytesProcessed, ! self->ok );
+
+        if ( AND2( result, self->ok ) ) {
+          self->ok = bytesProcessed != 0;
+        }
+      }
+    }
+  }
+
+#endif
+
+  assert( IS_BOOL( result ) );
+  assert( invariant( self ) );
+  return result;
+}
+
+
 /******************************************************************************
 PURPOSE: processSubset - Process a specified subset of input file data.
 INPUTS:  Parameters* self  Object containing parameters for processing.
@@ -888,7 +1012,7 @@ OUTPUTS: Parameters* self    Partially initialized object.
 
 static void cbsParser( const char* option, Parameters* self ) {
   assert( option ); assert( self ); assert( self->ok );
-  self->ok = self->bufferSize == minimumBufferSize;
+  self->ok = self->bufferSize == defaultBufferSize;
 
   if ( ! self->ok ) {
     failure( "Invalid redundant cbs= argument '%s'.", option );
@@ -1237,7 +1361,21 @@ static void swapper8( Parameters* self, size_t bytes ) {
     unsigned long long* word = self->buffer;
     size_t count = bytes / sizeof *word;
 
-    do {
+#ifdef __SSE2__
+
+    /* Swap 2 words at a time: reverse order of 2-byte pieces then swap bytes*/
+
+    for ( ; count >= 2; count -= 2, word += 2 ) {
+      __m128i* const words = (__m128i*) word;
+      const __m128i value = _mm_load_si128( words );
+      const __m128i reversed =
+        _mm_shufflehi_epi16( _mm_shufflelo_epi16( value, 0x1b ), 0x1b );
+      _mm_store_si128( words, swapBytes2( reversed ) );
+    }
+
+#endif
+
+    while ( count ) {
       const unsigned long long value = *word;
       const unsigned long long swapped =
         ( value & 0xff00000000000000ULL ) >> 56 |
@@ -1251,7 +1389,7 @@ static void swapper8( Parameters* self, size_t bytes ) {
       *word = swapped;
       ++word;
       --count;
-    } while ( count );
+    }
   }
 }
 
@@ -1273,7 +1411,21 @@ static void swapper4( Parameters* self, size_t bytes ) {
     unsigned int* word = self->buffer;
     size_t count = bytes / sizeof *word;
 
-    do {
+#ifdef __SSE2__
+
+    /* Swap 4 words at a time: swap 2-byte pieces then swap their bytes: */
+
+    for ( ; count >= 4; count -= 4, word += 4 ) {
+      __m128i* const words = (__m128i*) word;
+      const __m128i value = _mm_load_si128( words );
+      const __m128i reversed =
+        _mm_shufflehi_epi16( _mm_shufflelo_epi16( value, 0xb1 ), 0xb1 );
+      _mm_store_si128( words, swapBytes2( reversed ) );
+    }
+
+#endif
+
+    while ( count ) {
       const unsigned int value = *word;
       const unsigned int swapped =
         ( value & 0xff000000 ) >> 24 |
@@ -1283,7 +1435,7 @@ static void swapper4( Parameters* self, size_t bytes ) {
       *word = swapped;
       ++word;
       --count;
-    } while ( count );
+    }
   }
 }
 
@@ -1305,19 +1457,49 @@ static void swapper2( Parameters* self, size_t bytes ) {
     unsigned short* word = self->buffer;
     size_t count = bytes / sizeof *word;
 
-    do {
+#ifdef __SSE2__
+
+    /* Swap 8 words at a time: */
+
+    for ( ; count >= 8; count -= 8, word += 8 ) {
+      __m128i* const words = (__m128i*) word;
+      _mm_store_si128( words, swapBytes2( _mm_load_si128( words ) ) );
+    }
+
+#endif
+
+    while ( count ) {
       const unsigned short value = *word;
       const unsigned short swapped =
         ( value & 0xff00 ) >> 8 | ( value & 0x00ff ) << 8;
       *word = swapped;
       ++word;
       --count;
-    } while ( count );
+    }
   }
 }
 
 
 
+#ifdef __SSE2__
+
+/******************************************************************************
+PURPOSE: swapBytes2 - Swap byte order of each 2-byte word in a SIMD register.
+INPUTS:  __m128i words  8 2-byte words to swap.
+RETURNS: __m128i words with bytes swapped.
+NOTES:   Uses only SSE2 instructions, which all x86_64 CPUs have.
+******************************************************************************/
+
+static __m128i swapBytes2( __m128i words ) {
+  const __m128i result =
+    _mm_or_si128( _mm_slli_epi16( words, 8 ), _mm_srli_epi16( words, 8 ) );
+  return result;
+}
+
+#endif
+
+
+
 /******************************************************************************
 PURPOSE: seekFiles - Seek/skip to specified byte offset in input/output files.
 INPUTS:  Parameters* self  Object containing parameters for processing.
@@ -147,6 +147,13 @@ static void processData( char* const fileData, const size_t lines,
                          const Arguments* const arguments,
                          SubsetData* const subsetData );
 
+static size_t findFirstLineOfHour( const char* const fileData,
+                                   const size_t lines,
+                                   const size_t line,
+                                   const int yyyymmddhh );
+
+static int lineTimestamp( const char* const dataLine );
+
 static size_t findMatchedLine( char* const fileData, const size_t lines,
                                const size_t line, const int yyyymmddhh,
                                const Bounds bounds,
@@ -458,12 +465,14 @@ static void processData( char* const fileData, const size_t lines,
                   lines, yyyymmddhh, hours, longitude0, latitude0, scale ); )
 
   for ( hour = 0; hour < hours; ++hour ) {
-    size_t line = line0; /* Skip earlier lines. */
+    size_t line = findFirstLineOfHour( fileData, lines, line0, yyyymmddhh );
     double distance = distances[ hour ];
+    line0 = line; /* Subsequent hours are at or after this line. */
 
-    DEBUG( fprintf( stderr, "  %d distance = %lg\n", yyyymmddhh, distance ); )
+    DEBUG( fprintf( stderr, "  %d distance = %lg, line = %lu\n",
+                    yyyymmddhh, distance, line ); )
 
-    if ( distance > 0.0 ) { /* It is possible that there is a closer point. */
+    if ( AND2( line < lines, distance > 0.0 ) ) { /* Maybe a closer point.*/
 
       do {
         double longitude = 0.0;
@@ -479,10 +488,6 @@ static void processData( char* const fileData, const size_t lines,
             : longitude - longitude0;
           CHECK( longitudeDistance >= 0.0 );
 
-          if ( line0 == 1 ) {
-            line0 = line; /* Index of subset hour 0. Subsequent hours are > */
-          }
-
           if ( longitudeDistance < distance ) {
             const double latitudeDistance =
               latitude < latitude0 ? latitude0 - latitude
@@ -518,6 +523,72 @@ static void processData( char* const fileData, const size_t lines,
 
 
 
+/******************************************************************************
+PURPOSE: findFirstLineOfHour - Binary search for the first line in fileData
+         at or after yyyymmddhh.
+INPUTS:  const char* const fileData        Array of strings/lines of data.
+         const size_t lines                Number of lines in fileData[].
+         const size_t line                 First line index to search from.
+         const int yyyymmddhh              Timestamp to find.
+RETURNS: size_t index >= line of first line with timestamp >= yyyymmddhh
+         or else lines if there is no such line.
+NOTES:   Data lines are constant-length and date-time-ordered so each hour's
+         block of lines is found in O(log(lines)) rather than by scanning
+         all lines of preceding hours. See findMatchedLine().
+******************************************************************************/
+
+static size_t findFirstLineOfHour( const char* const fileData,
+                                   const size_t lines,
+                                   const size_t line,
+                                   const int yyyymmddhh ) {
+
+  PRE05( fileData, lines, IN_RANGE( line, 1, lines ),
+         isValidYearMonthDay( yyyymmddhh / 100 ),
+         IN_RANGE( yyyymmddhh % 100, 0, 23 ) );
+
+  const size_t eachLineLength = lineLength( fileData ); /* Assume constant! */
+  size_t lower = line;  /* First candidate line. */
+  size_t upper = lines; /* One past last candidate line. */
+
+  while ( lower < upper ) {
+    const size_t middle = lower + ( upper - lower ) / 2;
+    const char* const dataLine = fileData + middle * eachLineLength;
+
+    if ( lineTimestamp( dataLine ) < yyyymmddhh ) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+
+  DEBUG( fprintf( stderr, "    findFirstLineOfHour( %d ): result = %lu\n",
+                  yyyymmddhh, lower ); )
+
+  POST0( IN_RANGE( lower, line, lines ) );
+  return lower;
+}
+
+
+
+/******************************************************************************
+PURPOSE: lineTimestamp - Timestamp of a data line.
+INPUTS:  const char* const dataLine  Data line to parse. E.g.,
+                                     2008,  1,  1,  7, 24.3000,-120.4000, ...
+RETURNS: int yyyymmddhh of line.
+******************************************************************************/
+
+static int lineTimestamp( const char* const dataLine ) {
+  PRE0( dataLine );
+  const int yyyy = atoi( dataLine );
+  const int mm   = atoi( dataLine + 5 );
+  const int dd   = atoi( dataLine + 9 );
+  const int hh   = atoi( dataLine + 13 );
+  const int result = ( ( yyyy * 100 + mm ) * 100 + dd ) * 100 + hh;
+  return result;
+}
+
+
+
 /******************************************************************************
 PURPOSE: findMatchedLine - Search for the first line in fileData matching
          yyyymmddhh and within bounds and output its coordinates and value.
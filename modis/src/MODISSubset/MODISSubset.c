@@ -74,6 +74,12 @@ STATUS: unreviewed tested
 #include <stdlib.h>    /* For malloc(), free(). */
 #include <unistd.h>    /* For unlink(), getpid() */
 
+#ifdef _OPENMP
+#include <omp.h>       /* For omp_get_max_threads(). */
+#else
+#define omp_get_max_threads() 1
+#endif
+
 #include "Utilities.h" /* For MISSING_VALUE, IN_RANGE(), LONGITUDE, Bounds. */
 #include "ReadData.h"  /* For openFile(), readFileBounds(), readFileData()*/
 
@@ -101,6 +107,35 @@ typedef struct {
   int         corners;     /* Compute interpolated lon-lat corner points?*/
 } Arguments;
 
+/*
+ * Granule: A listed MODIS file and its data.
+ * Batches of granules are read and subset in parallel then written in list
+ * order. HDF-EOS and HDF4 are not thread-safe (and ReadData.c has one open
+ * swath) so each file is opened, read and closed within a critical section
+ * while other granules of the batch compute corners and subset.
+ * Each batch holds at most one granule per thread (up to
+ * MAXIMUM_PARALLEL_GRANULES) and only as many granules as fit their
+ * buffers (sized by each granule's rows, columns and variables) within
+ * MAXIMUM_BATCH_BYTES. A single larger granule is read alone.
+ */
+
+enum { MAXIMUM_PARALLEL_GRANULES = 32 };
+
+static const size_t MAXIMUM_BATCH_BYTES = 1024 * 1024 * 1024;
+
+typedef struct {
+  const char* fileName;     /* Name of MODIS file in subset time and domain. */
+  long long   yyyydddhhmm;  /* Timestamp of file. */
+  size_t      rows;         /* Rows of data in file. */
+  size_t      columns;      /* Columns of data in file. */
+  size_t      capacity;     /* Number of points allocated in buffer. */
+  size_t      subsetPoints; /* Number of points in subset domain. */
+  double*     buffer;       /* lon, lat, values [, corners][ capacity ]. */
+  char        units[ 80 ];  /* Units of variable if readUnits. */
+  int         readUnits;    /* Was variable read (so units are set)? */
+  int         ok;           /* Was granule read and subset? */
+} Granule;
+
 /* Data type: */
 
 typedef struct {
@@ -131,22 +166,34 @@ static void allocateTimestampsAndPoints( const char* const listFileContent,
 
 static long long swathFileTimestamp( const char* const fileName );
 
-static void readFileInfo( Data* const data,
-                          const char* const fileName,
-                          int* const file,
-                          long long* const yyyydddhhmm,
-                          size_t* const rows,
-                          size_t* const columns,
-                          size_t* const size,
-                          int* const changedDimensions );
-
-static void readCoordinatesAndValues( Data* const data,
-                                      const int file,
-                                      const size_t rows,
-                                      const size_t columns,
-                                      double* const longitudes,
-                                      double* const latitudes,
-                                      double* const values );
+static int listGranules( const Arguments* const arguments,
+                         const int batchSize,
+                         char** const fileName,
+                         char** const end,
+                         Granule granules[] );
+
+static void readGranule( const Arguments* const arguments,
+                         Granule* const granule );
+
+static void granuleArrays( const Granule* const granule, const int corners,
+                           double* arrays[ 11 ] );
+
+static int readFileInfo( const Arguments* const arguments,
+                         const char* const fileName,
+                         int* const file,
+                         long long* const yyyydddhhmm,
+                         size_t* const rows,
+                         size_t* const columns );
+
+static int readCoordinatesAndValues( const Arguments* const arguments,
+                                     const int file,
+                                     const size_t rows,
+                                     const size_t columns,
+                                     char units[ 80 ],
+                                     int* const readUnits,
+                                     double* const longitudes,
+                                     double* const latitudes,
+                                     double* const values );
 
 static void writeSubsetData( Data* const data,
                              const size_t points,
@@ -391,135 +438,77 @@ OUTPUTS: Data* data  data->yyyydddhhmm, points, scans, ok, tempFile = 0 closed.
 static void readData( Data* const data ) {
   const Arguments* const arguments = &( data->arguments );
   const int corners = arguments->corners;
+  const int batchSize =
+    CLAMPED_TO_RANGE( omp_get_max_threads(), 1, MAXIMUM_PARALLEL_GRANULES );
   char* listFileContent = readListFileAndAllocateTimestampsAndPoints( data );
   int wroteSomeData = 0;
-  char* fileName       = 0;
-  char* end            = 0;
-  size_t rows          = 0;
-  size_t columns       = 0;
-  size_t size          = 0;
-  double* buffer       = 0;
-  double* longitudes   = 0;
-  double* latitudes    = 0;
-  double* values       = 0;
-  double* longitudesSW = 0;
-  double* longitudesSE = 0;
-  double* longitudesNW = 0;
-  double* longitudesNE = 0;
-  double* latitudesSW  = 0;
-  double* latitudesSE  = 0;
-  double* latitudesNW  = 0;
-  double* latitudesNE  = 0;
+  char* fileName = 0;
+  char* end      = 0;
+  Granule granules[ MAXIMUM_PARALLEL_GRANULES ];
+  int index = 0;
+  memset( granules, 0, sizeof granules );
   data->ok = 0;
 
   /* Get each line of list file. It is the MODIS data file to read: */
 
-  for ( fileName = strtok_r( listFileContent, "\n", &end );
-        fileName;
-        fileName = strtok_r( 0, "\n", &end ) ) {
-    int file = 0;
-    long long yyyydddhhmm = 0;
-    int changedDimensions = 0;
+  fileName = listFileContent ? strtok_r( listFileContent, "\n", &end ) : 0;
 
-    readFileInfo( data, fileName, &file, &yyyydddhhmm, &rows, &columns,
-                  &size, &changedDimensions );
+  while ( fileName ) {
+    const int count =
+      listGranules( arguments, batchSize, &fileName, &end, granules );
 
-    if ( data->ok ) {
-      const size_t points = size;
+    /* Release buffers of slots not used by this batch: */
 
-      if ( changedDimensions ) {
-        const size_t variables = 3 + 8 * corners;
-        const size_t dataSize = variables * size;
-        const size_t bytes = dataSize * sizeof (double);
+    for ( index = count; index < MAXIMUM_PARALLEL_GRANULES; ++index ) {
+      free( granules[ index ].buffer );
+      granules[ index ].buffer = 0;
+      granules[ index ].capacity = 0;
+    }
 
-        if ( buffer ) {
-          free( buffer );
-          buffer = 0;
-        }
+    /* Read and subset the batch of granules in parallel: */
 
-        buffer = malloc( bytes );
-        data->ok = buffer != 0;
-
-        if ( buffer ) {
-          longitudes   = buffer;
-          latitudes    = longitudes + size;
-          values       = latitudes  + size;
-          longitudesSW = corners ? values       + size : 0;
-          longitudesSE = corners ? longitudesSW + size : 0;
-          longitudesNW = corners ? longitudesSE + size : 0;
-          longitudesNE = corners ? longitudesNW + size : 0;
-          latitudesSW  = corners ? longitudesNE + size : 0;
-          latitudesSE  = corners ? latitudesSW  + size : 0;
-          latitudesNW  = corners ? latitudesSE  + size : 0;
-          latitudesNE  = corners ? latitudesNW  + size : 0;
-        } else {
-          fprintf( stderr,
-                   "\nCan't allocate %lu bytes "
-                   "to complete the requested action.\n", bytes );
-        }
-      }
+#pragma omp parallel for schedule( dynamic )
 
-      if ( data->ok ) {
-        readCoordinatesAndValues( data, file, rows, columns,
-                                  longitudes, latitudes, values );
-      }
+    for ( index = 0; index < count; ++index ) {
+      readGranule( arguments, granules + index );
+    }
 
-      closeFile( file ), file = -1;
+    /* Write the subsets in list order: */
 
-      if ( data->ok ) {
-        size_t subsetPoints = 0;
-
-        if ( corners ) {
-          computeCorners( rows, columns,
-                          longitudes,   latitudes,
-                          longitudesSW, longitudesSE,
-                          longitudesNW, longitudesNE,
-                          latitudesSW,  latitudesSE,
-                          latitudesNW,  latitudesNE );
-        }
+    for ( index = 0; index < count; ++index ) {
+      const Granule* const granule = granules + index;
 
-        subsetPoints =
-          pointsInSubset( (const double (*)[2]) arguments->domain,
-                          points, longitudes, latitudes, values,
-                          longitudesSW, longitudesSE,
-                          longitudesNW, longitudesNE,
-                          latitudesSW,  latitudesSE,
-                          latitudesNW,  latitudesNE );
-
-        DEBUG( fprintf( stderr, "subsetPoints = %lu\n", subsetPoints ); )
-
-        if ( subsetPoints ) {
-
-          if ( subsetPoints < points ) {
-            compactSubsetData( subsetPoints, points,
-                               longitudes, latitudes, values,
-                               longitudesSW, longitudesSE,
-                               longitudesNW, longitudesNE,
-                               latitudesSW,  latitudesSE,
-                               latitudesNW,  latitudesNE );
-          }
+      if ( granule->readUnits ) {
+        memcpy( data->units, granule->units, sizeof data->units );
+      }
 
-          writeSubsetData( data, subsetPoints,
-                           longitudes, latitudes, values,
-                           longitudesSW, longitudesSE,
-                           longitudesNW, longitudesNE,
-                           latitudesSW,  latitudesSE,
-                           latitudesNW,  latitudesNE );
-
-          if ( data->ok ) {
-            data->yyyydddhhmm[ data->scans ] = yyyydddhhmm;
-            data->points[ data->scans ] = subsetPoints;
-            DEBUG( fprintf( stderr, "scan %d: %lld %lld\n",
-                            wroteSomeData, data->yyyydddhhmm[ data->scans ],
-                            data->points[ data->scans ] ); )
-            data->scans += 1;
-            wroteSomeData = 1;
-          }
+      if ( AND2( granule->ok, granule->subsetPoints ) ) {
+        double* arrays[ 11 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        granuleArrays( granule, corners, arrays );
+        data->ok = 1;
+        writeSubsetData( data, granule->subsetPoints,
+                         arrays[ 0 ], arrays[ 1 ], arrays[ 2 ],
+                         arrays[ 3 ], arrays[ 4 ], arrays[ 5 ], arrays[ 6 ],
+                         arrays[ 7 ], arrays[ 8 ], arrays[ 9 ], arrays[ 10 ]);
+
+        if ( data->ok ) {
+          data->yyyydddhhmm[ data->scans ] = granule->yyyydddhhmm;
+          data->points[ data->scans ] = granule->subsetPoints;
+          DEBUG( fprintf( stderr, "scan %d: %lld %lld\n",
+                          wroteSomeData, data->yyyydddhhmm[ data->scans ],
+                          data->points[ data->scans ] ); )
+          data->scans += 1;
+          wroteSomeData = 1;
         }
       }
     }
   } /* End loop on listFile. */
 
+  for ( index = 0; index < MAXIMUM_PARALLEL_GRANULES; ++index ) {
+    free( granules[ index ].buffer );
+    granules[ index ].buffer = 0;
+  }
+
   free( listFileContent );
   listFileContent = 0;
 
@@ -533,6 +522,195 @@ static void readData( Data* const data ) {
 
 
 
+/******************************************************************************
+PURPOSE: listGranules - List the next batch of granules to read: the next
+         listed files in the subset time range and domain whose buffers fit
+         within MAXIMUM_BATCH_BYTES.
+INPUTS:  const Arguments* const arguments  Subset arguments.
+         const int batchSize               Maximum granules in batch.
+         char** const fileName             Next listed file name or 0.
+         char** const end                  strtok_r() state of list file.
+         Granule granules[ batchSize ]     Buffers, capacities of prior batch.
+OUTPUTS: char** const fileName             Next listed file not in batch or 0.
+         char** const end                  Updated strtok_r() state.
+         Granule granules[ batchSize ]     fileName, yyyydddhhmm, rows,
+                                           columns of each granule in batch.
+RETURNS: int number of granules in batch. 0 if no more are in the subset.
+NOTES:   Each file's dimensions are read (serially) to size its buffer.
+         A slot's buffer is reused if large enough so its capacity counts.
+         The first granule is always listed even if larger than the budget.
+******************************************************************************/
+
+static int listGranules( const Arguments* const arguments,
+                         const int batchSize,
+                         char** const fileName,
+                         char** const end,
+                         Granule granules[] ) {
+
+  const size_t variables = 3 + 8 * arguments->corners;
+  size_t batchBytes = 0;
+  int result = 0;
+  int full = 0;
+
+  assert( arguments ); assert( batchSize > 0 );
+  assert( batchSize <= MAXIMUM_PARALLEL_GRANULES );
+  assert( fileName ); assert( end ); assert( granules );
+
+  while ( AND3( *fileName, result < batchSize, ! full ) ) {
+    Granule* const granule = granules + result;
+    int file = -1;
+
+    if ( readFileInfo( arguments, *fileName, &file, &granule->yyyydddhhmm,
+                       &granule->rows, &granule->columns ) ) {
+      const size_t points = granule->rows * granule->columns;
+      const size_t capacity =
+        points > granule->capacity ? points : granule->capacity;
+      const size_t bytes = variables * capacity * sizeof (double);
+      closeFile( file ), file = -1;
+      full = AND2( result, batchBytes + bytes > MAXIMUM_BATCH_BYTES );
+
+      if ( ! full ) { /* List granule in batch: */
+        granule->fileName = *fileName;
+        batchBytes += bytes;
+        ++result;
+      }
+    }
+
+    if ( ! full ) {
+      *fileName = strtok_r( 0, "\n", end );
+    }
+  }
+
+  DEBUG( fprintf( stderr, "batch of %d granules, %lu bytes\n",
+                  result, batchBytes ); )
+  assert( IN_RANGE( result, 0, batchSize ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readGranule - Read a listed MODIS file and subset its data.
+INPUTS:  const Arguments* const arguments  Subset arguments.
+         Granule* const granule            granule->fileName, buffer, capacity.
+OUTPUTS: Granule* const granule            granule->ok, yyyydddhhmm, rows,
+                                           columns, buffer, capacity, units,
+                                           readUnits, subsetPoints.
+NOTES:   Called in parallel. File access is serialized since HDF is not
+         thread-safe. The subset is compacted to the start of each array of
+         granule->buffer. See granuleArrays().
+******************************************************************************/
+
+static void readGranule( const Arguments* const arguments,
+                         Granule* const granule ) {
+
+  const int corners = arguments->corners;
+  double* arrays[ 11 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+  assert( arguments ); assert( granule ); assert( granule->fileName );
+
+  granule->ok = 0;
+  granule->readUnits = 0;
+  granule->subsetPoints = 0;
+
+#pragma omp critical (MODISSubset_HDF)
+  {
+    int file = -1;
+    granule->ok =
+      readFileInfo( arguments, granule->fileName, &file,
+                    &granule->yyyydddhhmm, &granule->rows, &granule->columns );
+
+    if ( granule->ok ) {
+      const size_t size = granule->rows * granule->columns;
+
+      if ( size > granule->capacity ) {
+        const size_t variables = 3 + 8 * corners;
+        const size_t bytes = variables * size * sizeof (double);
+        free( granule->buffer );
+        granule->capacity = 0;
+        granule->buffer = malloc( bytes );
+        granule->ok = granule->buffer != 0;
+
+        if ( granule->buffer ) {
+          granule->capacity = size;
+        } else {
+          fprintf( stderr,
+                   "\nCan't allocate %lu bytes "
+                   "to complete the requested action.\n", bytes );
+        }
+      }
+
+      if ( granule->ok ) {
+        granuleArrays( granule, corners, arrays );
+        granule->ok =
+          readCoordinatesAndValues( arguments, file,
+                                    granule->rows, granule->columns,
+                                    granule->units, &granule->readUnits,
+                                    arrays[ 0 ], arrays[ 1 ], arrays[ 2 ] );
+      }
+
+      closeFile( file ), file = -1;
+    }
+  }
+
+  if ( granule->ok ) {
+    const size_t points = granule->rows * granule->columns;
+
+    if ( corners ) {
+      computeCorners( granule->rows, granule->columns,
+                      arrays[ 0 ], arrays[ 1 ],
+                      arrays[ 3 ], arrays[ 4 ], arrays[ 5 ], arrays[ 6 ],
+                      arrays[ 7 ], arrays[ 8 ], arrays[ 9 ], arrays[ 10 ] );
+    }
+
+    granule->subsetPoints =
+      pointsInSubset( (const double (*)[2]) arguments->domain,
+                      points, arrays[ 0 ], arrays[ 1 ], arrays[ 2 ],
+                      arrays[ 3 ], arrays[ 4 ], arrays[ 5 ], arrays[ 6 ],
+                      arrays[ 7 ], arrays[ 8 ], arrays[ 9 ], arrays[ 10 ] );
+
+    DEBUG( fprintf( stderr, "subsetPoints = %lu\n", granule->subsetPoints ); )
+
+    if ( AND2( granule->subsetPoints, granule->subsetPoints < points ) ) {
+      compactSubsetData( granule->subsetPoints, points,
+                         arrays[ 0 ], arrays[ 1 ], arrays[ 2 ],
+                         arrays[ 3 ], arrays[ 4 ], arrays[ 5 ], arrays[ 6 ],
+                         arrays[ 7 ], arrays[ 8 ], arrays[ 9 ], arrays[ 10 ]);
+    }
+  }
+
+  assert( IMPLIES( granule->subsetPoints, granule->ok ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: granuleArrays - Arrays within granule buffer.
+INPUTS:  const Granule* const granule  granule->buffer, rows, columns.
+         const int corners             Are corner arrays allocated?
+OUTPUTS: double* arrays[ 11 ]          longitudes, latitudes, values,
+                                       longitudesSW, SE, NW, NE,
+                                       latitudesSW, SE, NW, NE or 0 if not
+                                       corners.
+******************************************************************************/
+
+static void granuleArrays( const Granule* const granule, const int corners,
+                           double* arrays[ 11 ] ) {
+  const size_t size = granule->rows * granule->columns;
+  const int variables = 3 + 8 * corners;
+  int variable = 0;
+
+  assert( granule ); assert( granule->buffer );
+  assert( size ); assert( size <= granule->capacity ); assert( arrays );
+
+  for ( variable = 0; variable < 11; ++variable ) {
+    arrays[ variable ] =
+      variable < variables ? granule->buffer + variable * size : 0;
+  }
+}
+
+
+
 /******************************************************************************
 PURPOSE: readListFileAndAllocateTimestampsAndPoints - Read list file and
          return its contents as a string and allocate timestamps and points
@@ -662,134 +840,127 @@ static long long swathFileTimestamp( const char* const fileName ) {
 /******************************************************************************
 PURPOSE: readFileInfo - Parse file timestamp, open it and read bounds and,
          if in subset, read dimensions.
-INPUTS:  Data* const data              data->arguments.domain.
+INPUTS:  const Arguments* const arguments  arguments->domain, yyyymmddhh, hours.
          const char* const fileName    Name of data file to open.
-         size_t* const rows            Rows of data in previous file or 0.
-         size_t* const columns         Columns of data in previous file or 0.
-OUTPUTS: Data* const data              data->ok.
-         int* const file               HDF file id of data file.
+OUTPUTS: int* const file               HDF file id of data file.
          long long* const yyyydddhhmm  Timestamp of file (if in subset range).
          size_t* const rows            Rows of data in file.
          size_t* const columns         Columns of data in file.
-         size_t* const size            rows * columns.
-         int* const changedDimensions  1 if rows or columns changed.
+RETURNS: int 1 if file is open and in subset, else 0 and file is closed.
 ******************************************************************************/
 
-static void readFileInfo( Data* const data,
-                          const char* const fileName,
-                          int* const file,
-                          long long* const yyyydddhhmm,
-                          size_t* const rows,
-                          size_t* const columns,
-                          size_t* const size,
-                          int* const changedDimensions ) {
+static int readFileInfo( const Arguments* const arguments,
+                         const char* const fileName,
+                         int* const file,
+                         long long* const yyyydddhhmm,
+                         size_t* const rows,
+                         size_t* const columns ) {
 
-  assert( data );
-  assert( isValidBounds( (const double (*)[2]) data->arguments.domain ) );
+  int result = 0;
+
+  assert( arguments );
+  assert( isValidBounds( (const double (*)[2]) arguments->domain ) );
   assert( fileName ); assert( *fileName );  assert( file );
-  assert( yyyydddhhmm ); assert( rows ); assert( columns ); assert( size );
-  assert( changedDimensions );
+  assert( yyyydddhhmm ); assert( rows ); assert( columns );
 
   *file = -1;
   *yyyydddhhmm = swathFileTimestamp( fileName );
-  data->ok = *yyyydddhhmm != 0;
-  *changedDimensions = 0;
+  result = *yyyydddhhmm != 0;
 
-  if ( data->ok ) {
-    const Arguments* const arguments = &( data->arguments );
+  if ( result ) {
     const long long firstTimestamp =
       convertTimestamp( arguments->yyyymmddhh * 100LL );
     const long long lastTimestamp =
       offsetTimestamp( firstTimestamp, arguments->hours );
-    data->ok = IN_RANGE( *yyyydddhhmm, firstTimestamp, lastTimestamp );
+    result = IN_RANGE( *yyyydddhhmm, firstTimestamp, lastTimestamp );
 
-    if ( data->ok ) {
+    if ( result ) {
       *file = openFile( fileName );
-      data->ok = *file != -1;
+      result = *file != -1;
 
-      if ( data->ok ) {
+      if ( result ) {
         Bounds bounds = { { -180.0, 180.0 }, { -90.0, 90.0 } };
-        data->ok = readFileBounds( *file, bounds );
+        result = readFileBounds( *file, bounds );
 
-        if ( data->ok ) {
-          data->ok =
+        if ( result ) {
+          result =
             boundsOverlap( (const double (*)[2]) bounds,
                            (const double (*)[2]) arguments->domain );
 
-          if ( data->ok ) {
-            size_t rows2 = 0;
-            size_t columns2 = 0;
-            data->ok = readFileDimensions( *file, &rows2, &columns2 );
-
-            if ( data->ok ) {
-
-              if ( rows2 != *rows || columns2 != *columns ) {
-                *rows = rows2;
-                *columns = columns2;
-                *size = rows2 * columns2;
-                *changedDimensions = 1;
-              }
-            }
+          if ( result ) {
+            result = readFileDimensions( *file, rows, columns );
           }
         }
       }
     }
   }
 
-  if ( ! data->ok ) {
+  if ( ! result ) {
 
     if ( *file != -1 ) {
       closeFile( *file ), *file = -1;
     }
   }
+
+  return result;
 }
 
 
 
 /******************************************************************************
 PURPOSE: readCoordinatesAndValues - Read lon-lats and variable data.
-INPUTS:  Data* const data              data->arguments.variable
+INPUTS:  const Arguments* const arguments  arguments->variable
          const int file                Data file id of file to read.
          const size_t rows             Rows of data to read.
          const size_t columns          Columns of data to read.
-OUTPUTS: Data* const data              data->ok, data->units[ 80 ]              Units of variable.
+OUTPUTS: char units[ 80 ]              Units of variable.
+         int* const readUnits          1 if variable was read (units set).
          double* const longitudes[ rows * columns ]  Longitudes read.
          double* const latitudes[  rows * columns ]  Latitudes read.
          double* const values[     rows * columns ]  Values read.
+RETURNS: int 1 if successful, else 0.
 ******************************************************************************/
 
-static void readCoordinatesAndValues( Data* const data,
-                                      const int file,
-                                      const size_t rows,
-                                      const size_t columns,
-                                      double* const longitudes,
-                                      double* const latitudes,
-                                      double* const values ) {
+static int readCoordinatesAndValues( const Arguments* const arguments,
+                                     const int file,
+                                     const size_t rows,
+                                     const size_t columns,
+                                     char units[ 80 ],
+                                     int* const readUnits,
+                                     double* const longitudes,
+                                     double* const latitudes,
+                                     double* const values ) {
 
   char unused[ 80 ] = "";
+  int result = 0;
 
-  assert( data ); assert( data->ok ); assert( data->arguments.variable );
+  assert( arguments ); assert( arguments->variable );
   assert( file > -1 );
   assert( rows != 0 ); assert( columns != 0 );
+  assert( units ); assert( readUnits );
   assert( longitudes ); assert( latitudes ); assert( values );
 
-  data->ok =
+  *readUnits = 0;
+  result =
     readFileData( file, "Longitude", rows, columns, unused, longitudes );
 
-  if ( data->ok ) {
-    data->ok =
+  if ( result ) {
+    result =
       readFileData( file, "Latitude", rows, columns, unused, latitudes ) ;
 
-    if ( data->ok ) {
-      data->ok =
+    if ( result ) {
+      result =
         clampInvalidCoordinates( rows * columns, longitudes, latitudes );
 
-      if ( data->ok ) {
-        data->ok = readFileData( file, data->arguments.variable, rows, columns,
-                                 data->units, values );
+      if ( result ) {
+        result = readFileData( file, arguments->variable, rows, columns,
+                               units, values );
+        *readUnits = 1;
       }
     }
   }
+
+  return result;
 }
 
 
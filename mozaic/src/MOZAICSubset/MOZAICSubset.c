@@ -6,6 +6,11 @@ PURPOSE: MOZAICSubset.c - Read a set of a MOZAIC files, subset the data to a
 
 NOTES:   Uses libUtilities.a (../../libs/Utilities).
 
+         A summary of each MOZAIC file (type, time range and lon-lat bounds)
+         is cached (see ../../../rsig/src/XDRConvert/Utilities/Cache.h) and
+         reused until the MOZAIC file changes so files outside the subset
+         are skipped without being read.
+
 HISTORY: 2010-01-26 plessel.todd@epa.gov, Created.
 STATUS: unreviewed, tested.
 ******************************************************************************/
@@ -13,11 +18,15 @@ STATUS: unreviewed, tested.
 /*================================ INCLUDES =================================*/
 
 #include <stdio.h>     /* For printf(). */
+#include <stdlib.h>    /* For free(). */
 #include <math.h>      /* For hypot(), atan2(). */
-#include <string.h>    /* For strlen(). */
+#include <string.h>    /* For strlen(), memcmp(). */
 #include <ctype.h>     /* For isdigit(), isalnum(), isspace(), isprint(). */
+#include <sys/stat.h>  /* For struct stat, stat(). */
 
 #include <Utilities.h> /* For PRE0*(), NEW_ZERO(), Stream, VoidList, Note. */
+#include <Cache.h>     /* For readCache(), writeCache(). */
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
 
 /*================================== TYPES ==================================*/
 
@@ -155,6 +164,50 @@ static Integer isValidTrack( const Track* track ) {
 
 
 
+/*
+ * FileSummary: Extent of the data in a MOZAIC file, cached (see Cache.h)
+ * with a SummaryCacheKey so that later runs can skip files that are outside
+ * the subset without reading and parsing them.
+ */
+
+#define SUMMARY_CACHE_KIND "MOZAICSubset_summary"
+#define SUMMARY_CACHE_TAG "MOZAICSubset file summary 2.0"
+
+typedef struct {
+  char     tag[ 40 ];             /* SUMMARY_CACHE_TAG. */
+  Integer  modified;              /* st_mtime of MOZAIC file. */
+  Integer  changed;               /* st_ctime of MOZAIC file. */
+  Integer  size;                  /* st_size of MOZAIC file. */
+  FileName fileName;              /* Name of summarized MOZAIC file. */
+} SummaryCacheKey;
+
+typedef struct {
+  Integer  profile;               /* 0 = non-profile, 1 = ascent, -1 = desc.*/
+  Integer  profileFirstTimestamp; /* YYYYMMDDHHMMSS of profile or 0. */
+  Integer  profileLastTimestamp;  /* YYYYMMDDHHMMSS of profile or 0. */
+  Integer  points;                /* Number of data lines with valid point. */
+  Integer  firstTimestamp;        /* Earliest YYYYMMDDHHMMSS of points. */
+  Integer  lastTimestamp;         /* Latest YYYYMMDDHHMMSS of points. */
+  Bounds   bounds;                /* Lon-lat bounds of points. */
+} FileSummary;
+
+/*
+ * MOZAICFile: A listed MOZAIC file and the result of reading it.
+ * Batches of these are read in parallel then appended in file order.
+ */
+
+enum { MAXIMUM_PARALLEL_FILES = 16 };
+
+typedef struct {
+  FileName    fileName;   /* Name of MOZAIC file. */
+  Track*      track;      /* Subset track or 0 if no data in subset. */
+  FileSummary summary;    /* Summary of file if summarized or summarize. */
+  Integer     summarized; /* Was summary read from the cache? */
+  Integer     summarize;  /* Write summary to the cache after the batch? */
+} MOZAICFile;
+
+
+
 /* Data type: */
 
 typedef struct {
@@ -225,7 +278,38 @@ static Track* readMOZAICFile( const char* fileName,
                               const Integer firstTimestamp,
                               const Integer lastTimestamp,
                               const Integer selected[ VARIABLES ],
-                              const Bounds bounds );
+                              const Bounds bounds,
+                              const Integer summarized,
+                              FileSummary* summary,
+                              Integer* summarize );
+
+static void loadElevations( const FileSummary* summary, const Bounds bounds );
+
+static Integer summaryCacheKey( const char* fileName, SummaryCacheKey* key );
+
+static Integer readFileSummary( const char* fileName, FileSummary* summary );
+
+static Integer isValidFileSummary( const FileSummary* summary );
+
+static void writeFileSummary( const char* fileName,
+                              const FileSummary* summary );
+
+static void summarizeFileData( const char* dataLines,
+                               const Integer lines,
+                               const Integer points,
+                               const Integer profile,
+                               const Integer profileFirstTimestamp,
+                               const Integer profileLastTimestamp,
+                               const Integer seconds1,
+                               const Integer seconds2,
+                               FileSummary* summary );
+
+static Integer isSummaryInSubset( const FileSummary* summary,
+                                  const Integer firstTimestamp,
+                                  const Integer lastTimestamp,
+                                  const Bounds bounds );
+
+static Integer splitLines( char* string );
 
 static Integer isProfileFile( const char* fileName, const char* fileData,
                               Integer* firstTimestamp, Integer* lastTimestamp,
@@ -295,6 +379,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   Integer ok = 0;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     failureMessage( "Invalid command-line arguments." );
@@ -306,9 +392,11 @@ int main( int argc, char* argv[] ) {
     data.ok = parseArguments( argc, argv, &data.arguments );
 
     if ( data.ok ) {
+      timingStage( "read" );
       readData( &data ); /* From list file named in arguments. */
 
       if ( data.ok ) {
+        timingStage( "write" );
         writeData( &data ); /* To stdout. */
       }
     }
@@ -317,6 +405,7 @@ int main( int argc, char* argv[] ) {
     deallocateData( &data );
   }
 
+  timingReport();
   POST0( IS_BOOL( ok ) );
   return ! ok;
 }
@@ -585,60 +674,136 @@ static void readData( Data* data ) {
          data->tracks == 0 );
 
   Stream* listFile = newFileStream( data->arguments.listFile, "r" );
-  data->ok = listFile != 0;
+  MOZAICFile* mozaicFiles = NEW_ZERO( MOZAICFile, MAXIMUM_PARALLEL_FILES );
+  data->ok = AND2( listFile, mozaicFiles );
 
-  if ( listFile ) {
+  if ( data->ok ) {
     const Integer firstTimestamp = data->arguments.firstTimestamp;
     const Integer lastTimestamp  = data->arguments.lastTimestamp;
     const Integer fileTimestamp  = previousDay( firstTimestamp );
 
-    /* For each file, read a subset of it into track and append to list: */
+    /*
+     * For each batch of listed files within the time range,
+     *   read a subset of each file into a track in parallel, then
+     *   in file order append each track to list:
+     */
 
     do {
-      FileName fileName = "";
-      listFile->readWord( listFile, fileName,
-                          sizeof fileName / sizeof *fileName );
-      data->ok = listFile->ok( listFile );
+      Integer count = 0;
+      Integer index = 0;
+
+      do { /* List the next batch of files: */
+        MOZAICFile* const mozaicFile = mozaicFiles + count;
+        memset( mozaicFile, 0, sizeof *mozaicFile );
+        listFile->readWord( listFile, mozaicFile->fileName,
+                            sizeof mozaicFile->fileName /
+                            sizeof *mozaicFile->fileName );
+        data->ok = listFile->ok( listFile );
+
+        if ( data->ok ) {
+          const Integer currentTimestamp =
+            timestampOfFileName( mozaicFile->fileName );
+          DEBUG( fprintf( stderr, "listing MOZAIC file %s\n",
+                          mozaicFile->fileName ); )
+          data->ok = currentTimestamp > 0;
+
+          if ( ! data->ok ) {
+            failureMessage( "Invalid MOZAIC file %s.", mozaicFile->fileName );
+          } else if ( IN_RANGE( currentTimestamp,
+                                fileTimestamp, lastTimestamp ) ) {
+            ++count;
+          }
+        }
 
-      if ( data->ok ) {
-        const Integer currentTimestamp = timestampOfFileName( fileName );
-        DEBUG( fprintf( stderr, "listing MOZAIC file %s\n", fileName ); )
-        data->ok = currentTimestamp > 0;
-
-        if ( ! data->ok ) {
-          failureMessage( "Invalid MOZAIC file %s.", fileName );
-        } else if (IN_RANGE(currentTimestamp, fileTimestamp, lastTimestamp)) {
-          Track* track =
-            readMOZAICFile( fileName, firstTimestamp, lastTimestamp,
-                            data->arguments.selected,
+        {
+          char newline[ 2 ] = "";
+          listFile->readString( listFile, newline, 2 ); /* Read '\n'. */
+        }
+      } while ( AND3( data->ok, count < MAXIMUM_PARALLEL_FILES,
+                      ! listFile->isAtEnd( listFile ) ) );
+
+      /* Read cached summaries and load elevations the batch may need: */
+
+      for ( index = 0; index < count; ++index ) {
+        MOZAICFile* const mozaicFile = mozaicFiles + index;
+        mozaicFile->summarized =
+          readFileSummary( mozaicFile->fileName, &mozaicFile->summary );
+        loadElevations( mozaicFile->summarized ? &mozaicFile->summary : 0,
+                        (const Real (*)[2]) data->arguments.bounds );
+      }
+
+      /* Read the batch of files in parallel: */
+
+#pragma omp parallel for schedule( dynamic )
+
+      for ( index = 0; index < count; ++index ) {
+        MOZAICFile* const mozaicFile = mozaicFiles + index;
+        mozaicFile->track =
+          readMOZAICFile( mozaicFile->fileName, firstTimestamp, lastTimestamp,
+                          data->arguments.selected,
+                          (const Real (*)[2]) data->arguments.bounds,
+                          mozaicFile->summarized,
+                          &mozaicFile->summary, &mozaicFile->summarize );
+      }
+
+      /* Cache new summaries and append the tracks to list in file order: */
+
+      for ( index = 0; index < count; ++index ) {
+        MOZAICFile* const mozaicFile = mozaicFiles + index;
+        Track* track = mozaicFile->track;
+        mozaicFile->track = 0;
+
+        if ( mozaicFile->summarize ) {
+          writeFileSummary( mozaicFile->fileName, &mozaicFile->summary );
+
+          if ( mozaicFile->summarized ) {
+
+            /*
+             * The cached summary did not match the file so it was not
+             * subset in parallel. Now load its elevations and subset it:
+             */
+
+            loadElevations( &mozaicFile->summary,
                             (const Real (*)[2]) data->arguments.bounds );
+            track =
+              readMOZAICFile( mozaicFile->fileName,
+                              firstTimestamp, lastTimestamp,
+                              data->arguments.selected,
+                              (const Real (*)[2]) data->arguments.bounds,
+                              1, &mozaicFile->summary,
+                              &mozaicFile->summarize );
+          }
+        }
 
-          if ( track ) {
+        if ( AND2( track, data->ok ) ) {
 
-            if ( data->tracks == 0 ) { /* Create list if needed: */
-              data->tracks = newVoidList( deallocateTrack, 0 );
-              data->ok = data->tracks != 0;
-            }
+          if ( data->tracks == 0 ) { /* Create list if needed: */
+            data->tracks = newVoidList( deallocateTrack, 0 );
+            data->ok = data->tracks != 0;
+          }
 
-            if ( data->tracks ) { /* Append subsetted track to list: */
-              data->tracks->insert( data->tracks, track, LAST_ITEM );
-              data->ok = data->tracks->ok( data->tracks );
-            }
+          if ( data->tracks ) { /* Append subsetted track to list: */
+            data->tracks->insert( data->tracks, track, LAST_ITEM );
+            data->ok = data->tracks->ok( data->tracks );
 
-            if ( ! data->ok ) {
-              deallocateTrack( track );
-              FREE( track );
+            if ( data->ok ) {
+              track = 0; /* Transfered ownership to list. */
             }
           }
         }
+
+        if ( track ) {
+          deallocateTrack( track );
+          FREE( track );
+        }
       }
 
-      listFile->readString( listFile, fileName, 2 ); /* Read '\n'. */
     } while ( AND2( data->ok, ! listFile->isAtEnd( listFile ) ) );
-
-    FREE_OBJECT( listFile );
   }
 
+  FREE( mozaicFiles );
+  FREE_OBJECT( listFile );
+
   if ( AND2( data->ok, data->tracks == 0 ) ) {
     failureMessage( "No tracks were in the subset." );
     data->ok = 0;
@@ -657,28 +822,51 @@ INPUTS:  const char* fileName          Name of compressed MOZAIC file to read.
          const Integer lastTimestamp   Ending timestamp of subset.
          const Integer selected[ VARIABLES ]  Selected variables of subset.
          const Bounds bounds                  Lon-lat bounds of subset.
+         const Integer summarized             Is summary from the cache?
+         FileSummary* summary                 If summarized, cached summary.
+OUTPUTS: FileSummary* summary  Summary of file computed from its data if
+                               summarize.
+         Integer* summarize    1 if summary is new and should be cached.
 RETURNS: Track* track  Track of subset data or 0 if no data in subset.
 NOTES:   If unsuccessful then failureMessage() is called and 0 is returned.
+         Files whose cached summary is outside the subset are not read.
+         A cached summary of a file that is read is checked against its data
+         and if it does not match then the file is not subset, since
+         loadElevations() used the cached bounds, and 0 is returned.
+         Called in parallel so writeFileSummary() is called later, serially.
 ******************************************************************************/
 
 static Track* readMOZAICFile( const char* fileName,
                               const Integer firstTimestamp,
                               const Integer lastTimestamp,
                               const Integer selected[ VARIABLES ],
-                              const Bounds bounds ) {
+                              const Bounds bounds,
+                              const Integer summarized,
+                              FileSummary* summary,
+                              Integer* summarize ) {
 
-  PRE08( fileName,
-         isValidYYYYMMDDHHMMSS( firstTimestamp ),
-         isValidYYYYMMDDHHMMSS( lastTimestamp ),
-         selected,
-         minimumItemI( selected, VARIABLES ) >= 0,
-         maximumItemI( selected, VARIABLES ) == 1,
-         sumI( selected, VARIABLES ) > IMPLICIT_VARIABLES,
-         isValidBounds( bounds ) );
+  PRE011( fileName,
+          isValidYYYYMMDDHHMMSS( firstTimestamp ),
+          isValidYYYYMMDDHHMMSS( lastTimestamp ),
+          selected,
+          minimumItemI( selected, VARIABLES ) >= 0,
+          maximumItemI( selected, VARIABLES ) == 1,
+          sumI( selected, VARIABLES ) > IMPLICIT_VARIABLES,
+          isValidBounds( bounds ),
+          IS_BOOL( summarized ),
+          summary,
+          summarize );
 
   Track* result = 0;
   Integer length = 0;
-  char* fileData = readFile( fileName, &length );
+  char* fileData =
+    IMPLIES( summarized,
+             isSummaryInSubset( summary, firstTimestamp, lastTimestamp,
+                                bounds ) ) ?
+      readFile( fileName, &length )
+    : 0;
+
+  *summarize = 0;
 
   if ( fileData ) {
     Integer profileFirstTimestamp = 0;
@@ -689,68 +877,470 @@ static Track* readMOZAICFile( const char* fileName,
       isProfileFile( fileName, fileData,
                      &profileFirstTimestamp, &profileLastTimestamp,
                      &seconds1, &seconds2 );
+    const Integer headerLines = profile ? 5 : 3;
+    const Integer points = linesInString( fileData ) - headerLines;
+    char* const dataLines =
+      points > 0 ? (char*) skipLines( fileData, headerLines ) : 0;
+
+    /* Terminate each data line so sscanf() only scans one line: */
+
+    const Integer lines = dataLines ? splitLines( dataLines ) : 0;
+    FileSummary fileSummary;
+    Integer stale = 0;
+
+    summarizeFileData( dataLines, lines, points, profile,
+                       profileFirstTimestamp, profileLastTimestamp,
+                       seconds1, seconds2, &fileSummary );
+    stale =
+      AND2( summarized, memcmp( &fileSummary, summary, sizeof fileSummary ));
+
+    if ( OR2( ! summarized, stale ) ) {
+      *summary = fileSummary;
+      *summarize = 1;
+    }
 
-    if ( IMPLIES( profile,
-                  AND2( IN_RANGE( profileFirstTimestamp,
-                                  firstTimestamp, lastTimestamp ),
-                        IN_RANGE( profileLastTimestamp,
-                                  firstTimestamp, lastTimestamp ) ) ) ) {
-      const Integer headerLines = profile ? 5 : 3;
-      const Integer points = linesInString( fileData ) - headerLines;
-      DEBUG( fprintf( stderr, "Reading MOZAIC file %s, points = %lld\n",
-                      fileName, points ); )
-
-      if ( points > 0 ) {
-        const Integer subsetVariables = sumI( selected, VARIABLES );
-        Integer subsetPoints = 0;
-        Real* data = NEW_ZERO( Real, subsetVariables * points );
-
-        if ( data ) {
-          Real* output = data;
-          const char* const headerLine = skipLines( fileData, headerLines - 1);
-          const char* dataLine = skipLines( fileData, headerLines );
-
-          while ( dataLine ) {
-            Real variables[ VARIABLES ];
-
-            if ( parseDataLine( headerLine, dataLine, points,
-                                firstTimestamp, lastTimestamp,
-                                profile, profileFirstTimestamp,
-                                profileLastTimestamp, seconds1, seconds2,
-                                bounds, selected, variables ) ) {
-              Integer variable = 0;
-
-              for ( variable = 0; variable < VARIABLES; ++variable ) {
-
-                if ( selected[ variable ] ) {
-                  *output++ = variables[ variable ];
-                }
+    DEBUG( fprintf( stderr, "Reading MOZAIC file %s, points = %lld\n",
+                    fileName, points ); )
+
+    if ( AND3( ! stale, lines > 0,
+               isSummaryInSubset( summary, firstTimestamp, lastTimestamp,
+                                  bounds ) ) ) {
+      const Integer subsetVariables = sumI( selected, VARIABLES );
+      Integer subsetPoints = 0;
+      Real* data = NEW_ZERO( Real, subsetVariables * lines );
+
+      if ( data ) {
+        Real* output = data;
+        const char* const headerLine = skipLines( fileData, headerLines - 1);
+        const char* dataLine = dataLines;
+        Integer line = 0;
+
+        for ( line = 0; line < lines;
+              ++line, dataLine += strlen( dataLine ) + 1 ) {
+          Real variables[ VARIABLES ];
+
+          if ( parseDataLine( headerLine, dataLine, points,
+                              firstTimestamp, lastTimestamp,
+                              profile, profileFirstTimestamp,
+                              profileLastTimestamp, seconds1, seconds2,
+                              bounds, selected, variables ) ) {
+            Integer variable = 0;
+
+            for ( variable = 0; variable < VARIABLES; ++variable ) {
+
+              if ( selected[ variable ] ) {
+                *output++ = variables[ variable ];
               }
-
-              ++subsetPoints;
             }
 
-            dataLine = skipLines( dataLine, 1 );
+            ++subsetPoints;
+          }
+        }
+
+        if ( subsetPoints ) {
+          Note note = "";
+          memset( note, 0, sizeof note );
+          parseNote( fileData, note );
+          result =
+            copySubsetData( data, subsetVariables, subsetPoints,
+                            profile == -1, note );
+        }
+
+        FREE( data );
+      }
+    }
+
+    FREE( fileData );
+  }
+
+  POST02( IMPLIES( result, isValidTrack( result ) ),
+          IMPLIES( *summarize, isValidFileSummary( summary ) ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: loadElevations - Load the elevation files that elevationAt() may
+         use for the points of a MOZAIC file within bounds.
+INPUTS:  const FileSummary* summary  Summary of file or 0 if not known.
+         const Bounds bounds         Lon-lat bounds of subset.
+NOTES:   elevationAt() reads the 90 x 90 degree elevation file containing a
+         point on first use, so it is called once for each such file that
+         overlaps the bounds (and the summary bounds). Later calls for those
+         points then only read loaded data so they may be made in parallel.
+         Elevation files that do not exist are not loaded and elevationAt()
+         returns 0 for their points, as before.
+******************************************************************************/
+
+static void loadElevations( const FileSummary* summary, const Bounds bounds ) {
+
+  PRE03( IMPLIES( summary, isValidFileSummary( summary ) ),
+         bounds, isValidBounds( bounds ) );
+
+  extern float elevationAt( float longitude, float latitude );
+  Real longitudeMinimum = bounds[ LONGITUDE ][ MINIMUM ];
+  Real longitudeMaximum = bounds[ LONGITUDE ][ MAXIMUM ];
+  Real latitudeMinimum  = bounds[ LATITUDE  ][ MINIMUM ];
+  Real latitudeMaximum  = bounds[ LATITUDE  ][ MAXIMUM ];
+  Real west = -180.0;
+
+  if ( summary ) { /* Clip to the data of the file: */
+    const Real (* const extent )[ 2 ] = (const Real (*)[ 2 ]) summary->bounds;
+
+    if ( extent[ LONGITUDE ][ MINIMUM ] > longitudeMinimum ) {
+      longitudeMinimum = extent[ LONGITUDE ][ MINIMUM ];
+    }
+
+    if ( extent[ LONGITUDE ][ MAXIMUM ] < longitudeMaximum ) {
+      longitudeMaximum = extent[ LONGITUDE ][ MAXIMUM ];
+    }
+
+    if ( extent[ LATITUDE ][ MINIMUM ] > latitudeMinimum ) {
+      latitudeMinimum = extent[ LATITUDE ][ MINIMUM ];
+    }
+
+    if ( extent[ LATITUDE ][ MAXIMUM ] < latitudeMaximum ) {
+      latitudeMaximum = extent[ LATITUDE ][ MAXIMUM ];
+    }
+
+    if ( summary->points == 0 ) { /* No points so nothing to load: */
+      longitudeMinimum = 1.0;
+      longitudeMaximum = 0.0;
+    }
+  }
+
+  for ( west = -180.0;
+        AND2( west < 180.0, longitudeMinimum <= longitudeMaximum );
+        west += 90.0 ) {
+    const Real east = west + 90.0;
+    Real south = -90.0;
+
+    for ( south = -90.0; south < 90.0; south += 90.0 ) {
+      const Real north = south + 90.0;
+
+      if ( AND4( longitudeMinimum <= east, longitudeMaximum >= west,
+                 latitudeMinimum <= north, latitudeMaximum >= south ) ) {
+
+        /* Call at the center of the part of the file within the bounds: */
+
+        const Real longitude =
+          0.5 * ( ( west > longitudeMinimum ? west : longitudeMinimum ) +
+                  ( east < longitudeMaximum ? east : longitudeMaximum ) );
+        const Real latitude =
+          0.5 * ( ( south > latitudeMinimum ? south : latitudeMinimum ) +
+                  ( north < latitudeMaximum ? north : latitudeMaximum ) );
+        elevationAt( longitude, latitude );
+      }
+    }
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: summaryCacheKey - Cache key of the summary of a MOZAIC file.
+INPUTS:  const char* fileName  Name of MOZAIC file.
+OUTPUTS: SummaryCacheKey* key  Key of cached summary.
+RETURNS: Integer 1 if MOZAIC file exists and the name fits, else 0.
+NOTES:   The key includes the modification time, status change time and size
+         of the MOZAIC file so a replaced or rewritten file gets a new
+         summary.
+******************************************************************************/
+
+static Integer summaryCacheKey( const char* fileName, SummaryCacheKey* key ) {
+
+  PRE03( fileName, *fileName, key );
+
+  Integer result = 0;
+  struct stat info;
+  memset( key, 0, sizeof *key );
+
+  if ( AND2( strlen( fileName ) < sizeof key->fileName,
+             stat( fileName, &info ) == 0 ) ) {
+    strncpy( key->tag, SUMMARY_CACHE_TAG, sizeof key->tag - 1 );
+    key->modified = info.st_mtime;
+    key->changed = info.st_ctime;
+    key->size = info.st_size;
+    strncpy( key->fileName, fileName, sizeof key->fileName - 1 );
+    result = 1;
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readFileSummary - Read cached summary of a MOZAIC file, if present.
+INPUTS:  const char* fileName  Name of MOZAIC file.
+OUTPTUS: FileSummary* summary  Summary of file.
+RETURNS: Integer 1 if read, else 0 if there is no valid summary.
+NOTES:   Called in parallel.
+******************************************************************************/
+
+static Integer readFileSummary( const char* fileName, FileSummary* summary ) {
+
+  PRE03( fileName, *fileName, summary );
+
+  Integer result = 0;
+  SummaryCacheKey key;
+  memset( summary, 0, sizeof *summary );
+
+  if ( summaryCacheKey( fileName, &key ) ) {
+    size_t size = 0;
+    FileSummary* cached =
+      readCache( SUMMARY_CACHE_KIND, &key, sizeof key, &size );
+    result =
+      AND3( cached, size == sizeof *cached, isValidFileSummary( cached ) );
+
+    if ( result ) {
+      *summary = *cached;
+    }
+
+    free( cached ), cached = 0;
+  }
+
+  DEBUG( fprintf( stderr, "readFileSummary( %s ) = %lld\n",
+                  fileName, result ); )
+  POST02( IS_BOOL( result ),
+          IMPLIES_ELSE( result,
+                        isValidFileSummary( summary ),
+                        summary->points == 0 ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: isValidFileSummary - Is a summary of a MOZAIC file consistent?
+INPUTS:  const FileSummary* summary  Summary to check.
+RETURNS: Integer 1 if valid, else 0.
+NOTES:   Used to reject cached summaries with impossible time ranges or
+         bounds since such a summary could cause a file to be skipped.
+******************************************************************************/
+
+static Integer isValidFileSummary( const FileSummary* summary ) {
+
+  PRE0( summary );
+
+  const Integer result =
+    AND4( IN4( summary->profile, 0, 1, -1 ),
+          summary->points >= 0,
+          IMPLIES( summary->profile,
+                   AND3( isValidYYYYMMDDHHMMSS(
+                           summary->profileFirstTimestamp ),
+                         isValidYYYYMMDDHHMMSS(
+                           summary->profileLastTimestamp ),
+                         summary->profileFirstTimestamp <=
+                           summary->profileLastTimestamp ) ),
+          IMPLIES( summary->points,
+                   AND4( isValidYYYYMMDDHHMMSS( summary->firstTimestamp ),
+                         isValidYYYYMMDDHHMMSS( summary->lastTimestamp ),
+                         summary->firstTimestamp <= summary->lastTimestamp,
+                         isValidBounds( (const Real (*)[2])
+                                          summary->bounds ) ) ) );
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeFileSummary - Write summary of a MOZAIC file to the cache.
+INPUTS:  const char* fileName        Name of MOZAIC file.
+         const FileSummary* summary  Summary of file.
+NOTES:   Not called in parallel.
+******************************************************************************/
+
+static void writeFileSummary( const char* fileName,
+                              const FileSummary* summary ) {
+
+  PRE04( fileName, *fileName, summary, isValidFileSummary( summary ) );
+
+  SummaryCacheKey key;
+
+  if ( summaryCacheKey( fileName, &key ) ) {
+    const void* const payloads[ 1 ] = { summary };
+    const size_t sizes[ 1 ] = { sizeof *summary };
+    writeCache( SUMMARY_CACHE_KIND, &key, sizeof key, 1, payloads, sizes );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: summarizeFileData - Compute the time range and lon-lat bounds of the
+         data lines of a MOZAIC file.
+INPUTS:  const char* dataLines      0 or lines of data split by splitLines().
+         const Integer lines        Number of data lines.
+         const Integer points       Number of data points in file.
+         const Integer profile      0 = non-profile, 1 = ascent, -1 = descent.
+         const Integer profileFirstTimestamp  Beginning timestamp of profile.
+         const Integer profileLastTimestamp   Ending timestamp of profile.
+         const Integer seconds1     Total seconds from Jan 1 yyyy of
+                                    firstTimestamp to firstTimestamp.
+         const Integer seconds2     Total seconds from Jan 1 yyyy of
+                                    firstTimestamp to lastTimestamp.
+OUTPUTS: FileSummary* summary       Summary of data lines.
+NOTES:   Only the leading timestamp and lon-lat columns are parsed.
+         Lines that parseDataLine() would reject for other reasons are
+         included so the summary bounds every point that could be subset.
+******************************************************************************/
+
+static void summarizeFileData( const char* dataLines,
+                               const Integer lines,
+                               const Integer points,
+                               const Integer profile,
+                               const Integer profileFirstTimestamp,
+                               const Integer profileLastTimestamp,
+                               const Integer seconds1,
+                               const Integer seconds2,
+                               FileSummary* summary ) {
+
+  PRE05( IMPLIES( lines > 0, dataLines ),
+         lines >= 0,
+         IN4( profile, 0, 1, -1 ),
+         IMPLIES( profile, points > 0 ),
+         summary );
+
+  const char* dataLine = dataLines;
+  Integer line = 0;
+  memset( summary, 0, sizeof *summary );
+  summary->profile = profile;
+  summary->profileFirstTimestamp = profileFirstTimestamp;
+  summary->profileLastTimestamp  = profileLastTimestamp;
+
+  for ( line = 0; line < lines; ++line, dataLine += strlen( dataLine ) + 1 ) {
+    Integer yyyymmdd = 0;
+    Integer hhmmss = 0;
+    Real latitude = 0.0;
+    Real longitude = 0.0;
+
+    if ( sscanf( dataLine, "%lld %lld %lf %lf",
+                 &yyyymmdd, &hhmmss, &latitude, &longitude ) == 4 ) {
+      const Integer timestamp =
+        profile == 0 ? yyyymmdd * 1000000 + hhmmss
+        : profileTimestamp( yyyymmdd, points, profile,
+                            profileFirstTimestamp, profileLastTimestamp,
+                            seconds1, seconds2 );
+
+      if ( AND3( isValidYYYYMMDDHHMMSS( timestamp ),
+                 IN_RANGE( longitude, -180.0, 180.0 ),
+                 IN_RANGE( latitude, -90.0, 90.0 ) ) ) {
+
+        if ( summary->points == 0 ) {
+          summary->firstTimestamp = summary->lastTimestamp = timestamp;
+          summary->bounds[ LONGITUDE ][ MINIMUM ] = longitude;
+          summary->bounds[ LONGITUDE ][ MAXIMUM ] = longitude;
+          summary->bounds[ LATITUDE  ][ MINIMUM ] = latitude;
+          summary->bounds[ LATITUDE  ][ MAXIMUM ] = latitude;
+        } else {
+          Real* const longitudes = summary->bounds[ LONGITUDE ];
+          Real* const latitudes  = summary->bounds[ LATITUDE ];
+
+          if ( timestamp < summary->firstTimestamp ) {
+            summary->firstTimestamp = timestamp;
+          } else if ( timestamp > summary->lastTimestamp ) {
+            summary->lastTimestamp = timestamp;
           }
 
-          if ( subsetPoints ) {
-            Note note = "";
-            memset( note, 0, sizeof note );
-            parseNote( fileData, note );
-            result =
-              copySubsetData( data, subsetVariables, subsetPoints,
-                              profile == -1, note );
+          if ( longitude < longitudes[ MINIMUM ] ) {
+            longitudes[ MINIMUM ] = longitude;
+          } else if ( longitude > longitudes[ MAXIMUM ] ) {
+            longitudes[ MAXIMUM ] = longitude;
           }
 
-          FREE( data );
+          if ( latitude < latitudes[ MINIMUM ] ) {
+            latitudes[ MINIMUM ] = latitude;
+          } else if ( latitude > latitudes[ MAXIMUM ] ) {
+            latitudes[ MAXIMUM ] = latitude;
+          }
         }
+
+        ++summary->points;
       }
     }
+  }
 
-    FREE( fileData );
+  POST02( summary->points >= 0,
+          IMPLIES( summary->points,
+                   AND2( summary->firstTimestamp <= summary->lastTimestamp,
+                         isValidBounds( (const Real (*)[2])
+                                          summary->bounds ) ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: isSummaryInSubset - Could a summarized MOZAIC file have data in the
+         subset?
+INPUTS:  const FileSummary* summary    Summary of file.
+         const Integer firstTimestamp  Beginning timestamp of subset.
+         const Integer lastTimestamp   Ending timestamp of subset.
+         const Bounds bounds           Lon-lat bounds of subset.
+RETURNS: Integer 1 if the file's data overlaps the subset, else 0.
+NOTES:   A profile file is only subset if the whole profile is in the
+         subset time range.
+******************************************************************************/
+
+static Integer isSummaryInSubset( const FileSummary* summary,
+                                  const Integer firstTimestamp,
+                                  const Integer lastTimestamp,
+                                  const Bounds bounds ) {
+
+  PRE04( summary,
+         isValidYYYYMMDDHHMMSS( firstTimestamp ),
+         isValidYYYYMMDDHHMMSS( lastTimestamp ),
+         isValidBounds( bounds ) );
+
+  const Integer result =
+    AND5( summary->points > 0,
+          IMPLIES( summary->profile,
+                   AND2( IN_RANGE( summary->profileFirstTimestamp,
+                                   firstTimestamp, lastTimestamp ),
+                         IN_RANGE( summary->profileLastTimestamp,
+                                   firstTimestamp, lastTimestamp ) ) ),
+          summary->firstTimestamp <= lastTimestamp,
+          summary->lastTimestamp >= firstTimestamp,
+          overlap( (const Real (*)[2]) summary->bounds, bounds ) );
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: splitLines - Terminate each line of a string.
+INPUTS:  char* string  String of lines to split.
+OUTPUTS: char* string  Each '\n' is replaced by '\0'.
+RETURNS: Integer number of lines, including any final unterminated line.
+NOTES:   Lines are then traversed with line += strlen( line ) + 1.
+******************************************************************************/
+
+static Integer splitLines( char* string ) {
+
+  PRE0( string );
+
+  Integer result = 0;
+  char* line = string;
+
+  while ( AND2( line, *line ) ) {
+    char* const newline = strchr( line, '\n' );
+    ++result;
+
+    if ( newline ) {
+      *newline = '\0';
+      line = newline + 1;
+    } else {
+      line = 0;
+    }
   }
 
-  POST0( IMPLIES( result, isValidTrack( result ) ) );
+  POST0( result >= 0 );
   return result;
 }
 
@@ -1074,6 +1664,7 @@ static Integer parseDataLine( const char* headerLine,
         const Real longitude = variables[ AIRCRAFT_LONGITUDE ];
         const Real latitude  = variables[ AIRCRAFT_LATITUDE ];
         extern float elevationAt( float longitude, float latitude );
+        /* Parallel calls are safe since loadElevations() was called: */
         const Real surfaceElevation0 = elevationAt( longitude, latitude );
         const Real surfaceElevation =
           surfaceElevation0 > 0.0 ? surfaceElevation0 : 0.0;
@@ -1537,6 +2128,7 @@ static void writeData( Data* data ) {
 
     if ( data->ok ) {
       writeXDR( data, output );
+      timingPoints( totalSubsetPoints( data->tracks ) );
     }
 
     FREE_OBJECT( output );
@@ -1110,52 +1110,65 @@ static size_t pointsInSubset( const Bounds domain,
   const double latitudeMaximum  = domain[ LATITUDE  ][ MAXIMUM ];
   size_t point = 0;
 
+  /*
+   * First test all points against the domain. Use & rather than && so the
+   * loop has no branches and can be vectorized:
+   */
+
   for ( point = 0; point < points; ++point ) {
     const double value     = values[     point ];
     const double longitude = longitudes[ point ];
     const double latitude  = latitudes[  point ];
-    int valid =
-      AND3( value > MISSING_VALUE,
-            IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ),
-            IN_RANGE( latitude,  latitudeMinimum,  latitudeMaximum ) );
-
-    if ( AND2( valid, longitudesSW ) ) { /* Check for degenerate cells: */
-      const double longitudeSW = longitudesSW[ point ];
-      const double longitudeSE = longitudesSE[ point ];
-      const double longitudeNW = longitudesNW[ point ];
-      const double longitudeNE = longitudesNE[ point ];
-      const double latitudeSW  = latitudesSW[  point ];
-      const double latitudeSE  = latitudesSE[  point ];
-      const double latitudeNW  = latitudesNW[  point ];
-      const double latitudeNE  = latitudesNE[  point ];
-
-      valid =
-        AND20( longitudeSW != longitude,
-               longitudeSW != longitudeSE,
-               longitudeSW != longitudeNW,
-               longitudeSW != longitudeNE,
-               longitudeSE != longitude,
-               longitudeSE != longitudeNW,
-               longitudeSE != longitudeNE,
-               longitudeNW != longitude,
-               longitudeNW != longitudeNE,
-               longitudeNE != longitude,
-               latitudeSW != latitude,
-               latitudeSW != latitudeSE,
-               latitudeSW != latitudeNW,
-               latitudeSW != latitudeNE,
-               latitudeSE != latitude,
-               latitudeSE != latitudeNW,
-               latitudeSE != latitudeNE,
-               latitudeNW != latitude,
-               latitudeNW != latitudeNE,
-               latitudeNE != latitude );
-    }
+    const int valid =
+      ( value > MISSING_VALUE ) &
+      ( longitude >= longitudeMinimum ) & ( longitude <= longitudeMaximum ) &
+      ( latitude  >= latitudeMinimum  ) & ( latitude  <= latitudeMaximum  );
+    values[ point ] = valid ? value : MISSING_VALUE;
+    result += valid;
+  }
 
-    if ( valid ) {
-      ++result;
-    } else {
-      values[ point ] = MISSING_VALUE;
+  if ( longitudesSW ) { /* Check remaining valid points for degenerate cells: */
+
+    for ( point = 0; point < points; ++point ) {
+
+      if ( values[ point ] > MISSING_VALUE ) {
+        const double longitude   = longitudes[   point ];
+        const double latitude    = latitudes[    point ];
+        const double longitudeSW = longitudesSW[ point ];
+        const double longitudeSE = longitudesSE[ point ];
+        const double longitudeNW = longitudesNW[ point ];
+        const double longitudeNE = longitudesNE[ point ];
+        const double latitudeSW  = latitudesSW[  point ];
+        const double latitudeSE  = latitudesSE[  point ];
+        const double latitudeNW  = latitudesNW[  point ];
+        const double latitudeNE  = latitudesNE[  point ];
+        const int valid =
+          AND20( longitudeSW != longitude,
+                 longitudeSW != longitudeSE,
+                 longitudeSW != longitudeNW,
+                 longitudeSW != longitudeNE,
+                 longitudeSE != longitude,
+                 longitudeSE != longitudeNW,
+                 longitudeSE != longitudeNE,
+                 longitudeNW != longitude,
+                 longitudeNW != longitudeNE,
+                 longitudeNE != longitude,
+                 latitudeSW != latitude,
+                 latitudeSW != latitudeSE,
+                 latitudeSW != latitudeNW,
+                 latitudeSW != latitudeNE,
+                 latitudeSE != latitude,
+                 latitudeSE != latitudeNW,
+                 latitudeSE != latitudeNE,
+                 latitudeNW != latitude,
+                 latitudeNW != latitudeNE,
+                 latitudeNE != latitude );
+
+        if ( ! valid ) {
+          values[ point ] = MISSING_VALUE;
+          --result;
+        }
+      }
     }
   }
 
@@ -699,17 +699,17 @@ static int readFileData( const int dataset,
     } else { /* Decode values: */
       const double fillValue = readAttribute( dataset, "_FillValue" );
       const double scaleFactor = readAttribute( dataset, "ScaleFactor" );
+      const double scale = scaleFactor != MISSING_VALUE ? scaleFactor : 1.0;
+      const int hasFillValue = fillValue != MISSING_VALUE;
       const size_t count = dim0 * ( dim1 > 0 ? dim1 : 1 );
       size_t index = 0;
 
+      /* Attribute tests are hoisted out so the loop has no branches: */
+
       for ( index = 0; index < count; ++index ) {
         const double value = data[ index ];
-
-        if ( fillValue != MISSING_VALUE && value == fillValue ) {
-          data[ index ] = MISSING_VALUE;
-        } else if ( scaleFactor != MISSING_VALUE ) {
-          data[ index ] *= scaleFactor;
-        }
+        const int isFill = hasFillValue & ( value == fillValue );
+        data[ index ] = isFill ? MISSING_VALUE : value * scale;
       }
 
       if ( dim1 == 0 ) { /* Copy single-column row values to all columns: */
@@ -385,6 +385,8 @@ extern void rotate4ByteWordIfLittleEndian( void* value );
 extern void rotate4ByteArrayIfLittleEndian( void* array, Integer count );
 extern void rotate2ByteWordIfLittleEndian( void* value );
 extern void rotate2ByteArrayIfLittleEndian( void* array, Integer count );
+extern void expand32BitValues( Real* array, Integer count );
+extern void rotateAndExpand32BitValues( Real* array, Integer count );
 extern void compress64BitValues( Real* array, Integer count );
 
 extern Integer isValidArgs( Integer argc, const char* argv[] );
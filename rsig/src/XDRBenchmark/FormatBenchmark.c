@@ -0,0 +1,237 @@
+/******************************************************************************
+PURPOSE: FormatBenchmark.c - Measure throughput of the XDRConvert Helpers
+         formatFixedReal() and formatExponentialReal() routines used by ASCII
+         output and verify that their results are identical to sprintf().
+NOTES:   To compile: ./makeit
+         Usage: FormatBenchmark [count]
+         Example: FormatBenchmark 1000000
+         Checks boundary values (e.g., +/-1e18 and its neighbors, which are
+         on either side of the exact fast path of formatFixedReal()) at every
+         precision, then count random values, and prints values/s for each
+         routine. Exits with status 1 if any result differs from sprintf().
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stdio.h>    /* For printf(), sprintf(). */
+#include <stdlib.h>   /* For atoi(), drand48(). */
+#include <string.h>   /* For strcmp(). */
+#include <math.h>     /* For nextafter(), ldexp(), HUGE_VAL. */
+#include <sys/time.h> /* For gettimeofday(). */
+
+#include <Helpers.h> /* For formatFixedReal(), FORMATTED_NUMBER_SIZE, etc. */
+
+/*================================== TYPES ==================================*/
+
+typedef char* (*Formatter)( Real, Integer, Integer, char* );
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static double now( void );
+
+static Integer check( Formatter formatter, const char* format,
+                      Real value, Integer width, Integer precision );
+
+static Integer checkBoundaries( void );
+
+static Integer benchmarkFormat( Formatter formatter, const char* name,
+                                const char* format, Integer count,
+                                const Real values[] );
+
+/*============================= PUBLIC FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: main - Run the checks and benchmarks.
+INPUTS:  int argc     Number of command-line arguments.
+         char* argv[] [count].
+RETURNS: int 0 if all results matched sprintf(), else 1.
+******************************************************************************/
+
+int main( int argc, char* argv[] ) {
+  const Integer count = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+  Integer ok = 0;
+
+  if ( ! IN_RANGE( count, 1, 100000000 ) ) {
+    fprintf( stderr, "\nusage: %s [count]\n", argv[ 0 ] );
+  } else {
+    Real* values = NEW( Real, count );
+
+    if ( values ) {
+      Integer index = 0;
+
+      /* Random signs, magnitudes about 1e-20 to 1e20 and mantissa bits: */
+
+      for ( index = 0; index < count; ++index ) {
+        const Real mantissa = drand48() * 2.0 - 1.0;
+        values[ index ] = ldexp( mantissa, (int) ( drand48() * 133.0 ) - 66 );
+      }
+
+      ok = checkBoundaries();
+      printf( "%"INTEGER_FORMAT" random values:\n", count );
+      ok = AND2( benchmarkFormat( formatFixedReal, "formatFixedReal",
+                                  "%*.*f", count, values ), ok );
+      ok = AND2( benchmarkFormat( formatExponentialReal,
+                                  "formatExponentialReal",
+                                  "%*.*e", count, values ), ok );
+      FREE( values );
+      printf( "%s\n", ok ? "All results identical to sprintf()."
+                         : "MISMATCHED results!" );
+    }
+  }
+
+  return ! ok;
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: now - Wall-clock time in seconds.
+RETURNS: double seconds.
+******************************************************************************/
+
+static double now( void ) {
+  struct timeval tv;
+  gettimeofday( &tv, 0 );
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+
+/******************************************************************************
+PURPOSE: check - Check that a formatter matches sprintf() for a value.
+INPUTS:  Formatter formatter  formatFixedReal or formatExponentialReal.
+         const char* format   "%*.*f" or "%*.*e".
+         Real value           Value to format.
+         Integer width        Field width.
+         Integer precision    Digits after the decimal point.
+RETURNS: Integer 1 if identical, else 0 and the difference is printed.
+******************************************************************************/
+
+static Integer check( Formatter formatter, const char* format,
+                      Real value, Integer width, Integer precision ) {
+  char result[ FORMATTED_NUMBER_SIZE ] = "";
+  char expected[ FORMATTED_NUMBER_SIZE ] = "";
+  Integer ok = 0;
+  formatter( value, width, precision, result );
+  sprintf( expected, format, (int) width, (int) precision, value );
+  ok = ! strcmp( result, expected );
+
+  if ( ! ok ) {
+    printf( "  MISMATCH %s width %"INTEGER_FORMAT
+            " precision %"INTEGER_FORMAT": '%s' expected '%s'\n",
+            format, width, precision, result, expected );
+  }
+
+  return ok;
+}
+
+
+
+/******************************************************************************
+PURPOSE: checkBoundaries - Check both formatters at boundary values and
+         every precision.
+RETURNS: Integer 1 if all identical, else 0.
+******************************************************************************/
+
+static Integer checkBoundaries( void ) {
+  const Real values[] = {
+    0.0, 1.0, 0.5, 9.5, 0.05, 1e-20, 1e17, 1e18, 1e19, 1e20, 1e300,
+    999999999999999872.0, 1.7976931348623157e308, 4.9e-324
+  };
+  const Integer count = COUNT( values );
+  Integer ok = 1;
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    const Real neighbors[ 3 ] = {
+      values[ index ],
+      nextafter( values[ index ], 0.0 ),
+      nextafter( values[ index ], HUGE_VAL )
+    };
+    Integer neighbor = 0;
+
+    for ( neighbor = 0; neighbor < 3; ++neighbor ) {
+      Integer sign = 0;
+
+      for ( sign = 0; sign < 2; ++sign ) {
+        const Real value =
+          sign ? -neighbors[ neighbor ] : neighbors[ neighbor ];
+        Integer precision = 0;
+
+        for ( precision = 0; precision <= MAXIMUM_FORMAT_PRECISION;
+              ++precision ) {
+          ok = AND2( check( formatFixedReal, "%*.*f", value, 0, precision ),
+                     ok );
+          ok = AND2( check( formatFixedReal, "%*.*f", value,
+                            MAXIMUM_FORMAT_WIDTH, precision ), ok );
+          ok = AND2( check( formatExponentialReal, "%*.*e", value, 0,
+                            precision ), ok );
+          ok = AND2( check( formatExponentialReal, "%*.*e", value,
+                            MAXIMUM_FORMAT_WIDTH, precision ), ok );
+        }
+      }
+    }
+  }
+
+  printf( "Boundary values: %s\n", ok ? "identical" : "MISMATCH" );
+  return ok;
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkFormat - Time a formatter and sprintf() over values and
+         check that their results are identical.
+INPUTS:  Formatter formatter  formatFixedReal or formatExponentialReal.
+         const char* name     Name of formatter.
+         const char* format   "%*.*f" or "%*.*e".
+         Integer count        Number of values.
+         const Real values[]  Values to format.
+RETURNS: Integer 1 if all identical, else 0.
+******************************************************************************/
+
+static Integer benchmarkFormat( Formatter formatter, const char* name,
+                                const char* format, Integer count,
+                                const Real values[] ) {
+  const Integer width = 20;
+  const Integer precision = 10;
+  char result[ FORMATTED_NUMBER_SIZE ] = "";
+  char expected[ FORMATTED_NUMBER_SIZE ] = "";
+  Integer ok = 1;
+  Integer index = 0;
+  double seconds = 0.0;
+  double sprintfSeconds = 0.0;
+  double start = now();
+
+  for ( index = 0; index < count; ++index ) {
+    formatter( values[ index ], width, precision, result );
+  }
+
+  seconds = now() - start;
+  start = now();
+
+  for ( index = 0; index < count; ++index ) {
+    sprintf( expected, format, (int) width, (int) precision, values[ index ] );
+  }
+
+  sprintfSeconds = now() - start;
+
+  for ( index = 0; AND2( ok, index < count ); ++index ) {
+    ok = check( formatter, format, values[ index ], width, precision );
+  }
+
+  printf( "  %-24s %12.0f values/s (sprintf %12.0f)  %s\n", name,
+          seconds > 0.0 ? count / seconds : 0.0,
+          sprintfSeconds > 0.0 ? count / sprintfSeconds : 0.0,
+          ok ? "identical" : "MISMATCH" );
+  return ok;
+}
+
+
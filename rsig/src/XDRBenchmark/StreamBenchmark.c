@@ -0,0 +1,386 @@
+/******************************************************************************
+PURPOSE: StreamBenchmark.c - Measure throughput of the XDRConvert Utilities
+         byte-rotation, 32-bit expansion and Stream array read/write routines
+         and verify that their results are bit-identical to a plain byte-wise
+         reference implementation.
+NOTES:   To compile: ./makeit
+         Usage: StreamBenchmark [megabytes] [temporary_file]
+         Example: StreamBenchmark 512 /data/tmp/benchmark.xdr
+         Prints MB/s for each routine and exits with status 1 if any result
+         differs from the reference.
+HISTORY: 2025/03 plessel.todd@epa.gov, Created.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stdio.h>    /* For printf(), fprintf(), remove(). */
+#include <stdlib.h>   /* For atoi(), drand48(). */
+#include <string.h>   /* For memcpy(), memcmp(). */
+#include <sys/time.h> /* For gettimeofday(). */
+
+#include <Utilities.h> /* For Integer, Real, Stream, NEW(), FREE(). */
+
+/*================================== TYPES ==================================*/
+
+typedef struct {
+  Integer        bytes;     /* Size of each array in bytes. */
+  unsigned char* bigEndian; /* bigEndian[ bytes ] random XDR data. */
+  unsigned char* work;      /* work[ bytes * 2 ] routine under test. */
+  unsigned char* expected;  /* expected[ bytes * 2 ] reference results. */
+  const char*    fileName;  /* Temporary file for Stream read/write tests. */
+  Integer        ok;        /* Did all results match the reference? */
+} Benchmark;
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static double now( void );
+
+static void report( Benchmark* benchmark, const char* name, Integer bytes,
+                    double seconds, Integer matched );
+
+static void referenceRotate( const unsigned char* input, Integer count,
+                             Integer wordSize, unsigned char* output );
+
+static void referenceExpand( const unsigned char* input, Integer count,
+                             Real* output );
+
+static void benchmarkRotate( Benchmark* benchmark );
+
+static void benchmarkExpand( Benchmark* benchmark );
+
+static void benchmarkRead( Benchmark* benchmark );
+
+static void benchmarkWrite( Benchmark* benchmark );
+
+/*============================= PUBLIC FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: main - Run the benchmarks.
+INPUTS:  int argc     Number of command-line arguments.
+         char* argv[] [megabytes] [temporary_file].
+RETURNS: int 0 if all results matched the reference, else 1.
+******************************************************************************/
+
+int main( int argc, char* argv[] ) {
+  Benchmark benchmark;
+  const Integer megabytes = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+  memset( &benchmark, 0, sizeof benchmark );
+  benchmark.fileName = argc > 2 ? argv[ 2 ] : "/tmp/StreamBenchmark.xdr";
+
+  if ( ! IN_RANGE( megabytes, 1, 65536 ) ) {
+    fprintf( stderr, "\nusage: %s [megabytes] [temporary_file]\n", argv[ 0 ] );
+  } else {
+    benchmark.bytes = megabytes * 1024 * 1024;
+    benchmark.bigEndian = NEW( unsigned char, benchmark.bytes * 5 );
+
+    if ( benchmark.bigEndian ) {
+      Integer index = 0;
+      benchmark.work     = benchmark.bigEndian + benchmark.bytes;
+      benchmark.expected = benchmark.work + benchmark.bytes * 2;
+      benchmark.ok = 1;
+
+      /* Random bytes, but clear an exponent bit so there are no NaNs: */
+
+      for ( index = 0; index < benchmark.bytes; ++index ) {
+        const unsigned char byte = (unsigned char) ( drand48() * 256.0 );
+        benchmark.bigEndian[ index ] = index % 4 == 0 ? byte & 0xbf : byte;
+      }
+
+      printf( "%"INTEGER_FORMAT" MB arrays:\n", megabytes );
+      benchmarkRotate( &benchmark );
+      benchmarkExpand( &benchmark );
+      benchmarkRead( &benchmark );
+      benchmarkWrite( &benchmark );
+      remove( benchmark.fileName );
+      FREE( benchmark.bigEndian );
+      printf( "%s\n", benchmark.ok ? "All results identical to reference."
+                                   : "MISMATCHED results!" );
+    }
+  }
+
+  return ! benchmark.ok;
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: now - Wall-clock time in seconds.
+RETURNS: double seconds.
+******************************************************************************/
+
+static double now( void ) {
+  struct timeval tv;
+  gettimeofday( &tv, 0 );
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+
+/******************************************************************************
+PURPOSE: report - Print throughput of a routine and update benchmark->ok.
+INPUTS:  Benchmark* benchmark  Benchmark to update.
+         const char* name      Name of routine.
+         Integer bytes         Number of (input) bytes processed.
+         double seconds        Elapsed time.
+         Integer matched       Did the result match the reference?
+******************************************************************************/
+
+static void report( Benchmark* benchmark, const char* name, Integer bytes,
+                    double seconds, Integer matched ) {
+  const double megabytesPerSecond =
+    seconds > 0.0 ? bytes / ( 1024.0 * 1024.0 ) / seconds : 0.0;
+  printf( "  %-36s %10.1f MB/s  %s\n",
+          name, megabytesPerSecond, matched ? "identical" : "MISMATCH" );
+  benchmark->ok = AND2( benchmark->ok, matched );
+}
+
+
+
+/******************************************************************************
+PURPOSE: referenceRotate - Reverse bytes of each word, one byte at a time.
+INPUTS:  const unsigned char* input  Words to reverse.
+         Integer count               Number of words.
+         Integer wordSize            Bytes per word: 4 or 8.
+OUTPUTS: unsigned char* output       Reversed words.
+******************************************************************************/
+
+static void referenceRotate( const unsigned char* input, Integer count,
+                             Integer wordSize, unsigned char* output ) {
+  Integer word = 0;
+
+  for ( word = 0; word < count; ++word ) {
+    Integer byte = 0;
+
+    for ( byte = 0; byte < wordSize; ++byte ) {
+      output[ byte ] = input[ wordSize - 1 - byte ];
+    }
+
+    input  += wordSize;
+    output += wordSize;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: referenceExpand - Convert big-endian 32-bit reals to native Reals.
+INPUTS:  const unsigned char* input  Big-endian IEEE-754 32-bit reals.
+         Integer count               Number of reals.
+OUTPUTS: Real* output                Expanded reals.
+******************************************************************************/
+
+static void referenceExpand( const unsigned char* input, Integer count,
+                             Real* output ) {
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index, input += 4 ) {
+    union { unsigned int i; float f; } value;
+    value.i = (unsigned int) input[ 0 ] << 24 | input[ 1 ] << 16 |
+              input[ 2 ] << 8 | input[ 3 ];
+    output[ index ] = value.f;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkRotate - Time rotate4/8ByteArrayIfLittleEndian().
+INPUTS:  Benchmark* benchmark  Benchmark to run.
+******************************************************************************/
+
+static void benchmarkRotate( Benchmark* benchmark ) {
+  const Integer bytes = benchmark->bytes;
+  const Integer wordSizes[ 2 ] = { 8, 4 };
+  Integer index = 0;
+
+  for ( index = 0; index < 2; ++index ) {
+    const Integer wordSize = wordSizes[ index ];
+    const Integer count = bytes / wordSize;
+    double seconds = 0.0;
+    memcpy( benchmark->work, benchmark->bigEndian, bytes );
+
+    if ( IS_LITTLE_ENDIAN ) {
+      referenceRotate( benchmark->bigEndian, count, wordSize,
+                       benchmark->expected );
+    } else {
+      memcpy( benchmark->expected, benchmark->bigEndian, bytes );
+    }
+
+    seconds = now();
+
+    if ( wordSize == 8 ) {
+      rotate8ByteArrayIfLittleEndian( benchmark->work, count );
+    } else {
+      rotate4ByteArrayIfLittleEndian( benchmark->work, count );
+    }
+
+    seconds = now() - seconds;
+    report( benchmark,
+            wordSize == 8 ? "rotate8ByteArrayIfLittleEndian"
+                          : "rotate4ByteArrayIfLittleEndian",
+            bytes, seconds,
+            ! memcmp( benchmark->work, benchmark->expected, bytes ) );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkExpand - Time expand32BitValues() and
+         rotateAndExpand32BitValues().
+INPUTS:  Benchmark* benchmark  Benchmark to run.
+******************************************************************************/
+
+static void benchmarkExpand( Benchmark* benchmark ) {
+  const Integer bytes = benchmark->bytes;
+  const Integer count = bytes / 4 - 3; /* Odd count to test remainders. */
+  Real* const work = (Real*) benchmark->work;
+  double seconds = 0.0;
+
+  referenceExpand( benchmark->bigEndian, count, (Real*) benchmark->expected );
+  memcpy( work, benchmark->bigEndian, count * 4 );
+  seconds = now();
+  rotateAndExpand32BitValues( work, count );
+  seconds = now() - seconds;
+  report( benchmark, "rotateAndExpand32BitValues", count * 4, seconds,
+          ! memcmp( work, benchmark->expected, count * sizeof (Real) ) );
+
+  /* Expand already-rotated values: */
+
+  if ( IS_LITTLE_ENDIAN ) {
+    referenceRotate( benchmark->bigEndian, count, 4, (unsigned char*) work );
+  } else {
+    memcpy( work, benchmark->bigEndian, count * 4 );
+  }
+
+  seconds = now();
+  expand32BitValues( work, count );
+  seconds = now() - seconds;
+  report( benchmark, "expand32BitValues", count * 4, seconds,
+          ! memcmp( work, benchmark->expected, count * sizeof (Real) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkRead - Time Stream read64BitReals(), read32BitReals() and
+         read64BitIntegers() from a (cached) file.
+INPUTS:  Benchmark* benchmark  Benchmark to run.
+******************************************************************************/
+
+static void benchmarkRead( Benchmark* benchmark ) {
+  const Integer bytes = benchmark->bytes;
+  Stream* output = newFileStream( benchmark->fileName, "wb" );
+
+  if ( output ) {
+    output->writeBytes( output, benchmark->bigEndian, bytes );
+    FREE_OBJECT( output );
+    referenceRotate( benchmark->bigEndian, bytes / 8, IS_LITTLE_ENDIAN ? 8 : 1,
+                     benchmark->expected );
+    {
+      const char* const names[ 3 ] = {
+        "Stream read64BitReals", "Stream read64BitIntegers",
+        "Stream read32BitReals"
+      };
+      Integer test = 0;
+
+      for ( test = 0; test < 3; ++test ) {
+        Stream* input = newFileStream( benchmark->fileName, "rb" );
+
+        if ( input ) {
+          const Integer count = test < 2 ? bytes / 8 : bytes / 4;
+          Real* const work = (Real*) benchmark->work;
+          double seconds = now();
+
+          if ( test == 0 ) {
+            input->read64BitReals( input, work, count );
+          } else if ( test == 1 ) {
+            input->read64BitIntegers( input, (Integer*) work, count );
+          } else {
+            input->read32BitReals( input, work, count );
+          }
+
+          seconds = now() - seconds;
+
+          if ( test == 2 ) {
+            referenceExpand( benchmark->bigEndian, count,
+                             (Real*) benchmark->expected );
+          }
+
+          report( benchmark, names[ test ], bytes, seconds,
+                  AND2( input->ok( input ),
+                        ! memcmp( work, benchmark->expected,
+                                  count * sizeof (Real) ) ) );
+          FREE_OBJECT( input );
+        }
+      }
+    }
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkWrite - Time Stream write64BitReals() and write32BitReals()
+         to a file.
+INPUTS:  Benchmark* benchmark  Benchmark to run.
+******************************************************************************/
+
+static void benchmarkWrite( Benchmark* benchmark ) {
+  const Integer bytes = benchmark->bytes;
+  const Integer count8 = bytes / 8;
+  const Integer count4 = bytes / 4;
+  Real* const values = (Real*) benchmark->expected;
+  Integer test = 0;
+
+  for ( test = 0; test < 2; ++test ) {
+    const Integer count = test == 0 ? count8 : count4;
+    Stream* output = newFileStream( benchmark->fileName, "wb" );
+
+    if ( output ) {
+      double seconds = 0.0;
+
+      if ( test == 0 ) {
+        referenceRotate( benchmark->bigEndian, count, IS_LITTLE_ENDIAN ? 8 : 1,
+                         (unsigned char*) values );
+      } else {
+        referenceExpand( benchmark->bigEndian, count, values );
+      }
+
+      seconds = now();
+
+      if ( test == 0 ) {
+        output->write64BitReals( output, values, count );
+      } else {
+        output->write32BitReals( output, values, count );
+      }
+
+      seconds = now() - seconds;
+
+      if ( output->ok( output ) ) {
+        FREE_OBJECT( output );
+        output = newFileStream( benchmark->fileName, "rb" );
+
+        if ( output ) {
+          output->readBytes( output, benchmark->work, bytes );
+        }
+      }
+
+      report( benchmark,
+              test == 0 ? "Stream write64BitReals" : "Stream write32BitReals",
+              bytes, seconds,
+              AND2( output, ! memcmp( benchmark->work, benchmark->bigEndian,
+                                      bytes ) ) );
+      FREE_OBJECT( output );
+    }
+  }
+}
+
+
+
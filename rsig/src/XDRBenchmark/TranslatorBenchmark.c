@@ -0,0 +1,1058 @@
+/******************************************************************************
+PURPOSE: TranslatorBenchmark.c - Measure throughput of each XDRConvert
+         translator by generating synthetic XDR-format input of a given size
+         for each input type and timing XDRConvert on each of its
+         translate, regrid and compare paths.
+NOTES:   To compile: ./makeit
+         Usage: TranslatorBenchmark [points] [XDRConvert] [temporary_directory]
+         Example: TranslatorBenchmark 4000000 ../XDRConvert/XDRConvert /data/tmp
+         For each input type and output path prints input MB/s, observation
+         points/s and peak resident set size of the XDRConvert process.
+         Exits with status 1 if any run fails.
+         All inputs cover 2008-07-03 with hourly timesteps and are regridded
+         onto a CONUS 36km Lambert grid then compared to synthetic CMAQ
+         data on that grid.
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stdio.h>        /* For printf(), snprintf(), remove(). */
+#include <stdlib.h>       /* For atoi(), drand48(). */
+#include <string.h>       /* For memset(). */
+#include <math.h>         /* For sqrt(). */
+#include <fcntl.h>        /* For open(). */
+#include <unistd.h>       /* For fork(), execv(), dup2(), _exit(). */
+#include <sys/time.h>     /* For gettimeofday(). */
+#include <sys/resource.h> /* For struct rusage. */
+#include <sys/wait.h>     /* For wait4(). */
+
+#include <Utilities.h> /* For Integer, Real, Stream, NEW(), fileSize(). */
+
+/*================================== TYPES ==================================*/
+
+enum { HOURS = 24, CMAQ_ROWS = 80, CMAQ_COLUMNS = 100, CMAQ_LAYERS = 22 };
+
+#define DESCRIPTION "http://www.epa.gov/,TranslatorBenchmark"
+#define STARTING_TIMESTAMP "2008-07-03T00:00:00-0000"
+#define TIME_RANGE STARTING_TIMESTAMP " 2008-07-03T23:59:59-0000"
+#define DOMAIN "-120 26 -75 48"
+
+/* Synthetic observations lie within this domain: */
+
+#define LONGITUDE_MINIMUM (-120.0)
+#define LONGITUDE_MAXIMUM (-75.0)
+#define LATITUDE_MINIMUM 26.0
+#define LATITUDE_MAXIMUM 48.0
+
+/* Writes input to output and returns number of data points written or 0: */
+
+typedef Integer (*Generator)( Stream* output, Integer points );
+
+typedef struct {
+  const char* name;      /* Input type. E.g., "Point". */
+  Generator   generator; /* Writes synthetic input of this type. */
+  Integer     layered;   /* Regrid onto layers and compare to 3D CMAQ? */
+  Integer     isModel;   /* CMAQ: translate only, no regrid or compare. */
+} Input;
+
+typedef struct {
+  const char* program;   /* XDRConvert executable to benchmark. */
+  const char* directory; /* Directory for generated and output files. */
+  Integer     points;    /* Approximate data points per input. */
+  Integer     runs;      /* Number of XDRConvert runs. */
+  Integer     failures;  /* Number of XDRConvert runs that failed. */
+  char cmaqFileName[ 2 ][ 256 ]; /* Surface and layered CMAQ to compare to.*/
+} Benchmark;
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static double now( void );
+
+static Real uniform( Real minimum, Real maximum );
+
+static Real timestamp( Integer hour, Integer minute );
+
+static void fileName( const Benchmark* benchmark, const char* name,
+                      const char* suffix, char result[ 256 ] );
+
+static Integer append( const char* arguments[], Integer count,
+                       const char* const more[] );
+
+static Integer generate( const char* name, Generator generator,
+                         Integer points );
+
+static void run( Benchmark* benchmark, const char* input, const char* path,
+                 const char* inputFileName, Integer points,
+                 const char* outputFileName, const char* arguments[] );
+
+static void benchmarkInput( Benchmark* benchmark, const Input* input );
+
+static void writeNotes( Stream* output, const char* prefix, Integer count );
+
+static Integer writePoint( Stream* output, Integer points );
+
+static Integer writeSite( Stream* output, Integer points );
+
+static Integer writeSwath( Stream* output, Integer points );
+
+static Integer writeProfile( Stream* output, Integer points );
+
+static Integer writeAircraft( Stream* output, Integer points );
+
+static Integer writeCALIPSO( Stream* output, Integer points );
+
+static Integer writeGrid( Stream* output, Integer points );
+
+static Integer writeCMAQ( Stream* output, Integer layers );
+
+static Integer writeSurfaceCMAQ( Stream* output, Integer unused );
+
+static Integer writeLayeredCMAQ( Stream* output, Integer unused );
+
+/*============================= GLOBAL VARIABLES ============================*/
+
+static const Input inputs[] = {
+  { "Point",    writePoint,       0, 0 },
+  { "Site",     writeSite,        0, 0 },
+  { "Swath",    writeSwath,       0, 0 },
+  { "Profile",  writeProfile,     1, 0 },
+  { "Aircraft", writeAircraft,    1, 0 },
+  { "CALIPSO",  writeCALIPSO,     1, 0 },
+  { "Grid",     writeGrid,        0, 0 },
+  { "CMAQ",     writeLayeredCMAQ, 1, 1 }
+};
+
+static const char* const regridArguments[] = {
+  "-regrid", "mean", "-lambert", "33", "45", "-97", "40",
+  "-ellipsoid", "6370000", "6370000",
+  "-grid", "100", "80", "-1800000", "-1400000", "36000", "36000", 0
+};
+
+static const char* const layerArguments[] = {
+  "-layers", "22", "2", "10000",
+  "1.0", "0.995", "0.988", "0.979", "0.97", "0.96", "0.938", "0.914",
+  "0.889", "0.862", "0.834", "0.804", "0.774", "0.743", "0.694", "0.644",
+  "0.592", "0.502", "0.408", "0.311", "0.21", "0.106", "0.0",
+  "9.81", "287.04", "50.0", "290.0", "100000.0", 0
+};
+
+/*============================= PUBLIC FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: main - Run the benchmarks.
+INPUTS:  int argc     Number of command-line arguments.
+         char* argv[] [points] [XDRConvert] [temporary_directory].
+RETURNS: int 0 if all runs succeeded, else 1.
+******************************************************************************/
+
+int main( int argc, char* argv[] ) {
+  Benchmark benchmark;
+  memset( &benchmark, 0, sizeof benchmark );
+  benchmark.points    = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+  benchmark.program   = argc > 2 ? argv[ 2 ] : "../XDRConvert/XDRConvert";
+  benchmark.directory = argc > 3 ? argv[ 3 ] : "/tmp";
+
+  if ( ! IN_RANGE( benchmark.points, 1000, 1000000000 ) ) {
+    fprintf( stderr,
+             "\nusage: %s [points] [XDRConvert] [temporary_directory]\n",
+             argv[ 0 ] );
+    benchmark.failures = 1;
+  } else {
+    Integer index = 0;
+    fileName( &benchmark, "CMAQ_surface", "xdr",
+              benchmark.cmaqFileName[ 0 ] );
+    fileName( &benchmark, "CMAQ_layered", "xdr",
+              benchmark.cmaqFileName[ 1 ] );
+
+    if ( ! AND2( generate( benchmark.cmaqFileName[ 0 ], writeSurfaceCMAQ, 0 ),
+                 generate( benchmark.cmaqFileName[ 1 ], writeLayeredCMAQ, 0))) {
+      benchmark.failures = 1;
+    } else {
+      printf( "%s on %"INTEGER_FORMAT" point inputs:\n",
+              benchmark.program, benchmark.points );
+      printf( "  %-9s %-14s %10s %14s %10s\n",
+              "input", "path", "MB/s", "points/s", "peak MB" );
+
+      for ( index = 0; index < sizeof inputs / sizeof *inputs; ++index ) {
+        benchmarkInput( &benchmark, inputs + index );
+      }
+
+      printf( "%"INTEGER_FORMAT" of %"INTEGER_FORMAT" runs failed.\n",
+              benchmark.failures, benchmark.runs );
+    }
+
+    remove( benchmark.cmaqFileName[ 0 ] );
+    remove( benchmark.cmaqFileName[ 1 ] );
+  }
+
+  return benchmark.failures != 0;
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: now - Wall-clock time in seconds.
+RETURNS: double seconds.
+******************************************************************************/
+
+static double now( void ) {
+  struct timeval tv;
+  gettimeofday( &tv, 0 );
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+
+/******************************************************************************
+PURPOSE: uniform - Random value in a range.
+INPUTS:  Real minimum  Minimum value.
+         Real maximum  Maximum value.
+RETURNS: Real value in [minimum, maximum].
+******************************************************************************/
+
+static Real uniform( Real minimum, Real maximum ) {
+  return minimum + drand48() * ( maximum - minimum );
+}
+
+
+
+/******************************************************************************
+PURPOSE: timestamp - yyyymmddhhmmss timestamp of an hour and minute of the
+         benchmark day.
+INPUTS:  Integer hour    Hour [0, 23].
+         Integer minute  Minute [0, 59].
+RETURNS: Real yyyymmddhhmmss.
+******************************************************************************/
+
+static Real timestamp( Integer hour, Integer minute ) {
+  return 20080703000000.0 + hour * 10000 + minute * 100;
+}
+
+
+
+/******************************************************************************
+PURPOSE: fileName - Name of a benchmark file.
+INPUTS:  const Benchmark* benchmark  benchmark->directory.
+         const char* name            Name of input. E.g., "Point".
+         const char* suffix          File name extension. E.g., "xdr".
+OUTPUTS: char result[ 256 ]   directory/TranslatorBenchmark.pid.name.suffix
+******************************************************************************/
+
+static void fileName( const Benchmark* benchmark, const char* name,
+                      const char* suffix, char result[ 256 ] ) {
+  snprintf( result, 256, "%s/TranslatorBenchmark.%d.%s.%s",
+            benchmark->directory, (int) getpid(), name, suffix );
+}
+
+
+
+/******************************************************************************
+PURPOSE: append - Append 0-terminated arguments to arguments.
+INPUTS:  const char* arguments[]    Arguments to append to.
+         Integer count              Number of arguments so far.
+         const char* const more[]   0-terminated arguments to append.
+OUTPUTS: const char* arguments[]    Appended arguments.
+RETURNS: Integer updated count.
+******************************************************************************/
+
+static Integer append( const char* arguments[], Integer count,
+                       const char* const more[] ) {
+
+  while ( *more ) {
+    arguments[ count ] = *more;
+    ++count;
+    ++more;
+  }
+
+  return count;
+}
+
+
+
+/******************************************************************************
+PURPOSE: generate - Write a synthetic input file.
+INPUTS:  const char* name     Name of file to write.
+         Generator generator  Routine to write file contents.
+         Integer points       Approximate number of data points to write.
+RETURNS: Integer number of data points written or 0 if failed.
+******************************************************************************/
+
+static Integer generate( const char* name, Generator generator,
+                         Integer points ) {
+  Integer result = 0;
+  Stream* output = newFileStream( name, "wb" );
+
+  if ( output ) {
+    result = generator( output, points );
+
+    if ( ! output->ok( output ) ) {
+      result = 0;
+    }
+
+    FREE_OBJECT( output );
+  }
+
+  if ( ! result ) {
+    fprintf( stderr, "Failed to generate %s.\n", name );
+    remove( name );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: run - Run and time XDRConvert on a file.
+INPUTS:  Benchmark* benchmark        Benchmark to update.
+         const char* input           Name of input type. E.g., "Point".
+         const char* path            Name of path. E.g., "regrid ioapi".
+         const char* inputFileName   File to read from stdin.
+         Integer points              Number of data points in input file.
+         const char* outputFileName  File to write stdout to.
+         const char* arguments[]     0-terminated XDRConvert argv[].
+OUTPUTS: Benchmark* benchmark        Updated runs, failures.
+NOTES:   XDRConvert's stderr is discarded.
+         Peak RSS is of the XDRConvert process alone.
+******************************************************************************/
+
+static void run( Benchmark* benchmark, const char* input, const char* path,
+                 const char* inputFileName, Integer points,
+                 const char* outputFileName, const char* arguments[] ) {
+
+  const double start = now();
+  const pid_t pid = fork();
+  Integer ok = 0;
+  ++benchmark->runs;
+
+  if ( pid == 0 ) {
+    const int inputFile  = open( inputFileName, O_RDONLY );
+    const int outputFile = open( outputFileName, O_WRONLY|O_CREAT|O_TRUNC,
+                                 0644 );
+    const int errorFile  = open( "/dev/null", O_WRONLY );
+
+    if ( AND3( inputFile != -1, outputFile != -1, errorFile != -1 ) ) {
+      dup2( inputFile, 0 );
+      dup2( outputFile, 1 );
+      dup2( errorFile, 2 );
+      execv( benchmark->program, (char* const*) arguments );
+    }
+
+    _exit( 127 );
+  } else if ( pid > 0 ) {
+    struct rusage usage;
+    int status = 0;
+    memset( &usage, 0, sizeof usage );
+
+    if ( wait4( pid, &status, 0, &usage ) == pid ) {
+      const double seconds = now() - start;
+      const double megabytes = fileSize( inputFileName ) / ( 1024.0 * 1024.0 );
+#ifdef __APPLE__
+      const double peakMegabytes = usage.ru_maxrss / ( 1024.0 * 1024.0 );
+#else
+      const double peakMegabytes = usage.ru_maxrss / 1024.0;
+#endif
+      ok = AND2( WIFEXITED( status ), WEXITSTATUS( status ) == 0 );
+
+      if ( ok ) {
+        printf( "  %-9s %-14s %10.1f %14.0f %10.1f\n",
+                input, path, megabytes / seconds, points / seconds,
+                peakMegabytes );
+      }
+    }
+  }
+
+  if ( ! ok ) {
+    printf( "  %-9s %-14s %10s\n", input, path, "FAILED" );
+    ++benchmark->failures;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: benchmarkInput - Generate an input and run it on each XDRConvert
+         path it supports.
+INPUTS:  Benchmark* benchmark  Benchmark to run.
+         const Input* input    Input type to generate and benchmark.
+OUTPUTS: Benchmark* benchmark  Updated runs, failures.
+******************************************************************************/
+
+static void benchmarkInput( Benchmark* benchmark, const Input* input ) {
+  char inputFileName[ 256 ] = "";
+  char regriddedFileName[ 256 ] = "";
+  char outputFileName[ 256 ] = "";
+  Integer points = 0;
+  fileName( benchmark, input->name, "xdr", inputFileName );
+  fileName( benchmark, input->name, "regridded.xdr", regriddedFileName );
+  fileName( benchmark, input->name, "out", outputFileName );
+  points = generate( inputFileName, input->generator, benchmark->points );
+
+  if ( ! points ) {
+    ++benchmark->runs;
+    ++benchmark->failures;
+  } else {
+    const char* const formats[] = { "-ascii", "-coards", "-ioapi" };
+    const Integer formatCount = input->isModel ? 3 : 2;
+    const char* arguments[ 64 ];
+    Integer index = 0;
+
+    for ( index = 0; index < formatCount; ++index ) {
+      const char* const more[] = { formats[ index ], 0 };
+      Integer count = 1;
+      arguments[ 0 ] = benchmark->program;
+      count = append( arguments, count, more );
+      arguments[ count ] = 0;
+      run( benchmark, input->name, formats[ index ] + 1,
+           inputFileName, points, outputFileName, arguments );
+    }
+
+    if ( ! input->isModel ) {
+      const char* const tmpdir[] = { "-tmpdir", benchmark->directory, 0 };
+      const char* const xdr[]    = { "-xdr", 0 };
+      const char* const ioapi[]  = { "-ioapi", 0 };
+      const char* const compare[] = {
+        "-compare", "difference",
+        benchmark->cmaqFileName[ input->layered ], "-xdr", 0
+      };
+      Integer count = 1;
+
+      arguments[ 0 ] = benchmark->program;
+      count = append( arguments, count, tmpdir );
+      count = append( arguments, count, regridArguments );
+
+      if ( input->layered ) {
+        count = append( arguments, count, layerArguments );
+      }
+
+      arguments[ append( arguments, count, xdr ) ] = 0;
+      run( benchmark, input->name, "regrid xdr",
+           inputFileName, points, regriddedFileName, arguments );
+      arguments[ append( arguments, count, ioapi ) ] = 0;
+      run( benchmark, input->name, "regrid ioapi",
+           inputFileName, points, outputFileName, arguments );
+
+      count = append( arguments, 1, tmpdir );
+      arguments[ append( arguments, count, compare ) ] = 0;
+      run( benchmark, input->name, "compare",
+           regriddedFileName, points, outputFileName, arguments );
+    }
+  }
+
+  remove( inputFileName );
+  remove( regriddedFileName );
+  remove( outputFileName );
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeNotes - Write 80-character notes.
+INPUTS:  Stream* output       Stream to write to.
+         const char* prefix   Note prefix. E.g., "site".
+         Integer count        Number of notes to write.
+******************************************************************************/
+
+static void writeNotes( Stream* output, const char* prefix, Integer count ) {
+  Integer index = 0;
+
+  for ( index = 0; AND2( output->ok( output ), index < count ); ++index ) {
+    char note[ 80 ] = "";
+    snprintf( note, sizeof note, "%s %"INTEGER_FORMAT, prefix, index );
+    output->writeString( output, "%-79s\n", note );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: writePoint - Write synthetic Point input.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writePoint( Stream* output, Integer points ) {
+  Integer result = 0;
+  Real* data = NEW( Real, points * 4 );
+
+  if ( data ) {
+    Real* const timestamps = data;
+    Real* const longitudes = timestamps + points;
+    Real* const latitudes  = longitudes + points;
+    Real* const values     = latitudes  + points;
+    Integer point = 0;
+
+    for ( point = 0; point < points; ++point ) {
+      timestamps[ point ] = timestamp( point * HOURS / points, point % 60 );
+      longitudes[ point ] = uniform( LONGITUDE_MINIMUM, LONGITUDE_MAXIMUM );
+      latitudes[  point ] = uniform( LATITUDE_MINIMUM, LATITUDE_MAXIMUM );
+      values[     point ] = uniform( 0.0, 80.0 );
+    }
+
+    output->writeString( output,
+                         "Point 1.0\n" DESCRIPTION "\n" TIME_RANGE "\n"
+                         "# Dimensions: variables points\n"
+                         "4 %"INTEGER_FORMAT"\n"
+                         "# Variable names:\n"
+                         "timestamp longitude latitude pm25\n"
+                         "# Variable units:\n"
+                         "yyyymmddhhmmss deg deg ug/m3\n"
+                         "# IEEE-754 64-bit reals data[variables][points]:\n",
+                         points );
+    output->write64BitReals( output, data, points * 4 );
+    result = points;
+    FREE( data );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeSite - Write synthetic hourly Site input.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeSite( Stream* output, Integer points ) {
+  const Integer stations = points / HOURS + 1;
+  Integer result = 0;
+  Integer* ids = NEW( Integer, stations );
+  Real* sites = ids ? NEW( Real, stations * 2 + HOURS * stations ) : 0;
+
+  if ( sites ) {
+    Real* const data = sites + stations * 2;
+    Integer station = 0;
+
+    for ( station = 0; station < stations; ++station ) {
+      ids[ station ] = 1000 + station;
+      sites[ station + station ] =
+        uniform( LONGITUDE_MINIMUM, LONGITUDE_MAXIMUM );
+      sites[ station + station + 1 ] =
+        uniform( LATITUDE_MINIMUM, LATITUDE_MAXIMUM );
+    }
+
+    for ( station = 0; station < HOURS * stations; ++station ) {
+      data[ station ] = uniform( 0.0, 120.0 );
+    }
+
+    output->writeString( output,
+                         "SITE 2.0\n" DESCRIPTION "\n" STARTING_TIMESTAMP "\n"
+                         "# data dimensions: timesteps stations\n"
+                         "%d %"INTEGER_FORMAT"\n"
+                         "# Variable names:\n"
+                         "ozone\n"
+                         "# Variable units:\n"
+                         "ppb\n"
+                         "# char notes[stations][80] and\n"
+                         "# MSB 64-bit integers ids[stations] and\n"
+                         "# IEEE-754 64-bit reals sites[stations]"
+                         "[2=<longitude,latitude>] and\n"
+                         "# IEEE-754 64-bit reals data[timesteps][stations]:"
+                         "\n", HOURS, stations );
+    writeNotes( output, "site", stations );
+    output->write64BitIntegers( output, ids, stations );
+    output->write64BitReals( output, sites, stations * 2 + HOURS * stations );
+    result = HOURS * stations;
+    FREE( sites );
+  }
+
+  FREE( ids );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeSwath - Write synthetic Swath input with one scan per hour.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeSwath( Stream* output, Integer points ) {
+  const Integer scanPoints = points / HOURS + 1;
+  Integer result = 0;
+  Real* data = NEW( Real, 3 * scanPoints );
+
+  if ( data ) {
+    Integer timestamps[ HOURS ];
+    Integer counts[ HOURS ];
+    Integer scan = 0;
+
+    for ( scan = 0; scan < HOURS; ++scan ) {
+      timestamps[ scan ] = 20081850030LL + scan * 100; /* yyyydddhhmm. */
+      counts[ scan ] = scanPoints;
+    }
+
+    output->writeString( output,
+                         "Swath 2.0\n" DESCRIPTION "\n" STARTING_TIMESTAMP "\n"
+                         "# Dimensions: variables timesteps scans:\n"
+                         "3 %d %d\n"
+                         "# Variable names:\n"
+                         "Longitude Latitude no2\n"
+                         "# Variable units:\n"
+                         "deg deg molecules/cm2\n"
+                         "# Domain: <min_lon> <min_lat> <max_lon> <max_lat>\n"
+                         DOMAIN "\n"
+                         "# MSB 64-bit integers (yyyydddhhmm)"
+                         " timestamps[scans] and\n"
+                         "# MSB 64-bit integers points[scans] and\n"
+                         "# IEEE-754 64-bit reals data_1[variables][points_1]"
+                         " ... data_S[variables][points_S]:\n",
+                         HOURS, HOURS );
+    output->write64BitIntegers( output, timestamps, HOURS );
+    output->write64BitIntegers( output, counts, HOURS );
+
+    for ( scan = 0; AND2( output->ok( output ), scan < HOURS ); ++scan ) {
+      Integer point = 0;
+
+      for ( point = 0; point < scanPoints; ++point ) {
+        data[ point ] = uniform( LONGITUDE_MINIMUM, LONGITUDE_MAXIMUM );
+        data[ scanPoints + point ] =
+          uniform( LATITUDE_MINIMUM, LATITUDE_MAXIMUM );
+        data[ scanPoints + scanPoints + point ] = uniform( 1e15, 1e16 );
+      }
+
+      output->write64BitReals( output, data, 3 * scanPoints );
+    }
+
+    result = HOURS * scanPoints;
+    FREE( data );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeProfile - Write synthetic Profile input of 100-point profiles.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeProfile( Stream* output, Integer points ) {
+  enum { VARIABLES = 6, PROFILE_POINTS = 100 };
+  const Integer profiles = points / PROFILE_POINTS + 1;
+  Integer result = 0;
+  Integer* counts = NEW( Integer, profiles );
+
+  if ( counts ) {
+    Real data[ VARIABLES ][ PROFILE_POINTS ];
+    Integer profile = 0;
+
+    for ( profile = 0; profile < profiles; ++profile ) {
+      counts[ profile ] = PROFILE_POINTS;
+    }
+
+    output->writeString( output,
+                         "Profile 2.0\n" DESCRIPTION "\n" TIME_RANGE "\n"
+                         "# Subset domain: <min_lon> <min_lat> <max_lon>"
+                         " <max_lat>:\n"
+                         DOMAIN "\n"
+                         "# Dimensions: variables profiles:\n"
+                         "%d %"INTEGER_FORMAT"\n"
+                         "# Variable names:\n"
+                         "timestamp id longitude latitude elevation ozone\n"
+                         "# Variable units:\n"
+                         "yyyymmddhhmmss - deg deg m molecules/cm3\n"
+                         "# char notes[profiles][80] and\n"
+                         "# MSB 64-bit integers points[profiles] and\n"
+                         "# IEEE-754 64-bit reals data_1[variables][points_1]"
+                         " ... data_P[variables][points_T]:\n",
+                         VARIABLES, profiles );
+    writeNotes( output, "profile", profiles );
+    output->write64BitIntegers( output, counts, profiles );
+
+    for ( profile = 0; AND2( output->ok( output ), profile < profiles );
+          ++profile ) {
+      const Integer hour = profile * HOURS / profiles;
+      const Real longitude =
+        uniform( LONGITUDE_MINIMUM, LONGITUDE_MAXIMUM - 1.0 );
+      const Real latitude = uniform( LATITUDE_MINIMUM, LATITUDE_MAXIMUM - 1.0);
+      Integer point = 0;
+
+      for ( point = 0; point < PROFILE_POINTS; ++point ) {
+        data[ 0 ][ point ] = timestamp( hour, point * 60 / PROFILE_POINTS );
+        data[ 1 ][ point ] = profile + 1;
+        data[ 2 ][ point ] = longitude + point * 0.001;
+        data[ 3 ][ point ] = latitude  + point * 0.001;
+        data[ 4 ][ point ] = 10.0 + point * 100.0;
+        data[ 5 ][ point ] = uniform( 1e11, 1e12 );
+      }
+
+      output->write64BitReals( output, &data[ 0 ][ 0 ],
+                               VARIABLES * PROFILE_POINTS );
+    }
+
+    result = profiles * PROFILE_POINTS;
+    FREE( counts );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeAircraft - Write synthetic Aircraft input of ascending tracks.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeAircraft( Stream* output, Integer points ) {
+  enum { VARIABLES = 5 };
+  const Integer trackPoints = 1000;
+  const Integer tracks = points / trackPoints + 1;
+  Integer result = 0;
+  Integer* counts = NEW( Integer, tracks );
+  Real* bounds = counts ? NEW( Real, tracks * 4 ) : 0;
+  Real* data = bounds ? NEW( Real, trackPoints * VARIABLES ) : 0;
+
+  if ( data ) {
+    const Real longitudeStep = 0.01;
+    const Real latitudeStep  = 0.005;
+    Integer track = 0;
+
+    for ( track = 0; track < tracks; ++track ) {
+      Real* const trackBounds = bounds + track * 4;
+      counts[ track ] = trackPoints;
+      trackBounds[ 0 ] =
+        uniform( LONGITUDE_MINIMUM, LONGITUDE_MAXIMUM - 10.0 );
+      trackBounds[ 1 ] = trackBounds[ 0 ] + trackPoints * longitudeStep;
+      trackBounds[ 2 ] = uniform( LATITUDE_MINIMUM, LATITUDE_MAXIMUM - 5.0 );
+      trackBounds[ 3 ] = trackBounds[ 2 ] + trackPoints * latitudeStep;
+    }
+
+    output->writeString( output,
+                         "Aircraft 2.0\n" DESCRIPTION "\n" TIME_RANGE "\n"
+                         "# Subset bounds: <min_lon> <min_lat> <max_lon>"
+                         " <max_lat>:\n"
+                         DOMAIN "\n"
+                         "# Dimensions: variables points tracks:\n"
+                         "%d %"INTEGER_FORMAT" %"INTEGER_FORMAT"\n"
+                         "# Variable names:\n"
+                         "timestamp longitude latitude elevation ozone\n"
+                         "# Variable units:\n"
+                         "yyyymmddhhmmss deg deg m ppmV\n"
+                         "# char notes[tracks][80] and\n"
+                         "# IEEE-754 64-bit reals bounds[tracks]"
+                         "[2=lon,lat][2=min,max] and\n"
+                         "# MSB 64-bit integers points[tracks] and\n"
+                         "# IEEE-754 64-bit reals data_1[points_1][variables]"
+                         " ... data_T[points_T][variables]:\n",
+                         VARIABLES, tracks * trackPoints, tracks );
+    writeNotes( output, "track", tracks );
+    output->write64BitReals( output, bounds, tracks * 4 );
+    output->write64BitIntegers( output, counts, tracks );
+
+    for ( track = 0; AND2( output->ok( output ), track < tracks ); ++track ) {
+      const Real* const trackBounds = bounds + track * 4;
+      const Integer hour = track * HOURS / tracks;
+      Integer point = 0;
+
+      for ( point = 0; point < trackPoints; ++point ) {
+        Real* const values = data + point * VARIABLES;
+        values[ 0 ] = timestamp( hour, point * 60 / trackPoints );
+        values[ 1 ] = trackBounds[ 0 ] + point * longitudeStep;
+        values[ 2 ] = trackBounds[ 2 ] + point * latitudeStep;
+        values[ 3 ] = 100.0 + point * 12000.0 / trackPoints;
+        values[ 4 ] = uniform( 0.02, 0.08 );
+      }
+
+      output->write64BitReals( output, data, trackPoints * VARIABLES );
+    }
+
+    result = tracks * trackPoints;
+  }
+
+  FREE( data );
+  FREE( bounds );
+  FREE( counts );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeCALIPSO - Write synthetic CALIPSO input with one 50-level
+         profile fly-over per hour.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeCALIPSO( Stream* output, Integer points ) {
+  enum { LEVELS = 50 };
+  const Integer groundPoints = points / ( HOURS * LEVELS ) + 1;
+  const Integer profileSize = groundPoints * ( 3 + 2 * LEVELS );
+  Integer result = 0;
+  Real* data = NEW( Real, profileSize );
+
+  if ( data ) {
+    const Real longitudeStep = 0.01;
+    const Real latitudeStep  = 0.02;
+    Integer timestamps[ HOURS ];
+    Integer dimensions[ HOURS ][ 2 ];
+    Real bounds[ HOURS ][ 2 ][ 2 ];
+    Integer profile = 0;
+
+    for ( profile = 0; profile < HOURS; ++profile ) {
+      const Real longitudeRange = groundPoints * longitudeStep;
+      const Real latitudeRange  = groundPoints * latitudeStep;
+      timestamps[ profile ] = 20081850030LL + profile * 100; /* yyyydddhhmm */
+      dimensions[ profile ][ 0 ] = groundPoints;
+      dimensions[ profile ][ 1 ] = LEVELS;
+      bounds[ profile ][ 0 ][ 0 ] =
+        uniform( LONGITUDE_MINIMUM,
+                 LONGITUDE_MAXIMUM - longitudeRange > LONGITUDE_MINIMUM ?
+                   LONGITUDE_MAXIMUM - longitudeRange : LONGITUDE_MINIMUM );
+      bounds[ profile ][ 0 ][ 1 ] = bounds[ profile ][ 0 ][ 0 ] +
+        ( groundPoints - 1 ) * longitudeStep;
+      bounds[ profile ][ 1 ][ 0 ] =
+        uniform( LATITUDE_MINIMUM,
+                 LATITUDE_MAXIMUM - latitudeRange > LATITUDE_MINIMUM ?
+                   LATITUDE_MAXIMUM - latitudeRange : LATITUDE_MINIMUM );
+      bounds[ profile ][ 1 ][ 1 ] = bounds[ profile ][ 1 ][ 0 ] +
+        ( groundPoints - 1 ) * latitudeStep;
+    }
+
+    output->writeString( output,
+                         "CALIPSO 1.0\n" DESCRIPTION "\n" STARTING_TIMESTAMP
+                         "\n"
+                         "# Dimensions: variables timesteps profiles:\n"
+                         "5 %d %d\n"
+                         "# Variable names:\n"
+                         "Profile_UTC_Time Longitude Latitude Elevation"
+                         " Total_Attenuated_Backscatter_532\n"
+                         "# Variable units:\n"
+                         "yyyymmdd.f deg deg m per_kilometer_per_steradian\n"
+                         "# Domain: <min_lon> <min_lat> <max_lon> <max_lat>\n"
+                         DOMAIN "\n"
+                         "# MSB 64-bit integers (yyyydddhhmm)"
+                         " profile_timestamps[profiles] and\n"
+                         "# IEEE-754 64-bit reals profile_bounds[profiles]"
+                         "[2=<lon,lat>][2=<min,max>] and\n"
+                         "# MSB 64-bit integers profile_dimensions[profiles]"
+                         "[2=<points,levels>] and\n"
+                         "# IEEE-754 64-bit reals profile_data_1[variables]"
+                         "[points_1][levels] ... profile_data_S[variables]"
+                         "[points_S][levels]:\n",
+                         HOURS, HOURS );
+    output->write64BitIntegers( output, timestamps, HOURS );
+    output->write64BitReals( output, &bounds[ 0 ][ 0 ][ 0 ], HOURS * 4 );
+    output->write64BitIntegers( output, &dimensions[ 0 ][ 0 ], HOURS * 2 );
+
+    for ( profile = 0; AND2( output->ok( output ), profile < HOURS );
+          ++profile ) {
+      Real* const times       = data;
+      Real* const longitudes  = times + groundPoints;
+      Real* const latitudes   = longitudes + groundPoints;
+      Real* const elevations  = latitudes + groundPoints;
+      Real* const backscatter = elevations + groundPoints * LEVELS;
+      Integer point = 0;
+
+      for ( point = 0; point < groundPoints; ++point ) {
+        Integer level = 0;
+        times[ point ] = 20080703.0 + ( profile + 0.5 ) / HOURS;
+        longitudes[ point ] = bounds[ profile ][ 0 ][ 0 ] + point*longitudeStep;
+        latitudes[  point ] = bounds[ profile ][ 1 ][ 0 ] + point*latitudeStep;
+
+        for ( level = 0; level < LEVELS; ++level ) {
+          elevations[  point * LEVELS + level ] = -100.0 + level * 400.0;
+          backscatter[ point * LEVELS + level ] = uniform( 1e-4, 1e-2 );
+        }
+      }
+
+      output->write64BitReals( output, data, profileSize );
+    }
+
+    result = HOURS * groundPoints * LEVELS;
+    FREE( data );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeGrid - Write synthetic hourly Grid input on a lon-lat mesh.
+INPUTS:  Stream* output  Stream to write to.
+         Integer points  Approximate number of points to write.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeGrid( Stream* output, Integer points ) {
+  const Integer rows = (Integer) sqrt( points / HOURS ) + 1;
+  const Integer columns = points / HOURS / rows + 1;
+  const Integer cells = rows * columns;
+  Integer result = 0;
+  Real* data = NEW( Real, cells * 2 );
+
+  if ( data ) {
+    Real* const longitudes = data;
+    Real* const latitudes  = data + cells;
+    const Real longitudeStep =
+      ( LONGITUDE_MAXIMUM - LONGITUDE_MINIMUM ) / columns;
+    const Real latitudeStep = ( LATITUDE_MAXIMUM - LATITUDE_MINIMUM ) / rows;
+    Integer hour = 0;
+    Integer cell = 0;
+
+    for ( cell = 0; cell < cells; ++cell ) {
+      longitudes[ cell ] =
+        LONGITUDE_MINIMUM + ( cell % columns + 0.5 ) * longitudeStep;
+      latitudes[ cell ] =
+        LATITUDE_MINIMUM + ( cell / columns + 0.5 ) * latitudeStep;
+    }
+
+    output->writeString( output,
+                         "Grid 1.0\n" DESCRIPTION "\n" STARTING_TIMESTAMP "\n"
+                         "# Dimensions: timesteps variables rows columns:\n"
+                         "%d 1 %"INTEGER_FORMAT" %"INTEGER_FORMAT"\n"
+                         "# Variable names:\n"
+                         "temperature\n"
+                         "# Variable units:\n"
+                         "K\n"
+                         "# IEEE-754 64-bit reals longitudes[rows][columns]"
+                         " and\n"
+                         "# IEEE-754 64-bit reals latitudes[rows][columns]"
+                         " and\n"
+                         "# IEEE-754 64-bit reals data[timesteps][variables]"
+                         "[rows][columns]:\n",
+                         HOURS, rows, columns );
+    output->write64BitReals( output, data, cells * 2 );
+
+    for ( hour = 0; AND2( output->ok( output ), hour < HOURS ); ++hour ) {
+
+      for ( cell = 0; cell < cells; ++cell ) {
+        data[ cell ] = uniform( 270.0, 310.0 );
+      }
+
+      output->write64BitReals( output, data, cells );
+    }
+
+    result = HOURS * cells;
+    FREE( data );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeCMAQ - Write synthetic hourly CMAQ XDR-format data on the
+         regrid grid.
+INPUTS:  Stream* output  Stream to write to.
+         Integer layers  1 or CMAQ_LAYERS.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeCMAQ( Stream* output, Integer layers ) {
+  const Integer cells = CMAQ_ROWS * CMAQ_COLUMNS;
+  const Integer count = HOURS * layers * cells;
+  Integer result = 0;
+  Real* data = NEW( Real, count );
+
+  if ( data ) {
+    const char* const levels =
+      layers == 1 ? "1 0.995"
+      : "1.0 0.995 0.988 0.979 0.97 0.96 0.938 0.914 0.889 0.862 0.834 0.804"
+        " 0.774 0.743 0.694 0.644 0.592 0.502 0.408 0.311 0.21 0.106 0.0";
+    Integer variable = 0;
+
+    output->writeString( output,
+                         "SUBSET 9.0 CMAQ\n"
+                         "CMAQ\n" DESCRIPTION "\n" STARTING_TIMESTAMP "\n"
+                         "# data dimensions: timesteps variables layers rows"
+                         " columns:\n"
+                         "%d 4 %"INTEGER_FORMAT" %d %d\n"
+                         "# subset indices (0-based time, 1-based layer/row/"
+                         "column): first-timestep last-timestep first-layer"
+                         " last-layer first-row last-row first-column"
+                         " last-column:\n"
+                         "0 %d 1 %"INTEGER_FORMAT" 1 %d 1 %d\n"
+                         "# Variable names:\n"
+                         "LONGITUDE LATITUDE ELEVATION O3\n"
+                         "# Variable units:\n"
+                         "deg deg m ppmV\n"
+                         "# lcc projection: lat_1 lat_2 lat_0 lon_0"
+                         " major_semiaxis minor_semiaxis\n"
+                         "33 45 40 -97 6370000 6370000\n"
+                         "# Grid: ncols nrows xorig yorig xcell ycell vgtyp"
+                         " vgtop vglvls[%"INTEGER_FORMAT"]:\n"
+                         "%d %d -1800000 -1400000 36000 36000 2 10000 %s\n"
+                         "# IEEE-754 32-bit reals data[variables][timesteps]"
+                         "[layers][rows][columns]:\n",
+                         HOURS, layers, CMAQ_ROWS, CMAQ_COLUMNS,
+                         HOURS - 1, layers, CMAQ_ROWS, CMAQ_COLUMNS,
+                         layers + 1, CMAQ_COLUMNS, CMAQ_ROWS, levels );
+
+    for ( variable = 0; AND2( output->ok( output ), variable < 4 );
+          ++variable ) {
+      Integer index = 0;
+
+      for ( index = 0; index < count; ++index ) {
+        const Integer cell = index % cells;
+        const Integer layer = index / cells % layers;
+        data[ index ] =
+            variable == 0 ?
+              LONGITUDE_MINIMUM + cell % CMAQ_COLUMNS *
+                ( LONGITUDE_MAXIMUM - LONGITUDE_MINIMUM ) / CMAQ_COLUMNS
+          : variable == 1 ?
+              LATITUDE_MINIMUM + cell / CMAQ_COLUMNS *
+                ( LATITUDE_MAXIMUM - LATITUDE_MINIMUM ) / CMAQ_ROWS
+          : variable == 2 ? 20.0 + layer * 800.0
+          : uniform( 0.02, 0.08 );
+      }
+
+      output->write32BitReals( output, data, count );
+    }
+
+    result = count;
+    FREE( data );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeSurfaceCMAQ - Write synthetic single-layer CMAQ data.
+INPUTS:  Stream* output  Stream to write to.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeSurfaceCMAQ( Stream* output, Integer unused ) {
+  return writeCMAQ( output, 1 );
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeLayeredCMAQ - Write synthetic multi-layer CMAQ data.
+INPUTS:  Stream* output  Stream to write to.
+RETURNS: Integer number of points written or 0 if failed.
+******************************************************************************/
+
+static Integer writeLayeredCMAQ( Stream* output, Integer unused ) {
+  return writeCMAQ( output, CMAQ_LAYERS );
+}
+
+
+
@@ -184,14 +184,20 @@ void translateAircraft( Parameters* parameters ) {
   ZERO_OBJECT( &aircraft );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &aircraft ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( aircraft.totalPoints );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridAircraft( parameters->regrid, parameters->grid, &aircraft );
 
+      timingPoints( aircraft.totalRegriddedPoints );
+
       if ( aircraft.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -229,9 +235,11 @@ void translateAircraft( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &aircraft, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &aircraft, parameters );
     }
   }
@@ -255,7 +263,7 @@ void compareRegriddedAircraft( Parameters* parameters ) {
          parameters->ok, parameters->input->ok( parameters->input ) );
 
   if ( ! AND2( parameters->compareFunction,
-               parameters->data ) ) {
+               parameters->cmaqInput ) ) {
     failureMessage( "Invalid input for comparing." );
     parameters->ok = 0;
   } else {
@@ -263,7 +271,10 @@ void compareRegriddedAircraft( Parameters* parameters ) {
     ZERO_OBJECT( &aircraft );
     parameters->ok = 0;
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &aircraft ) ) {
+      timingPoints( aircraft.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 aircraft.variable[ 0 ],
@@ -271,13 +282,17 @@ void compareRegriddedAircraft( Parameters* parameters ) {
                                 parameters->variable,
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &aircraft ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( aircraft.totalRegriddedPoints );
 
         if ( aircraft.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &aircraft, parameters );
         }
       }
@@ -854,7 +869,7 @@ static Integer readRegriddedXDRData( Stream* input, Aircraft* aircraft ) {
 
 /******************************************************************************
 PURPOSE: compareRegriddedXDR - Compare Regridded data with CMAQ data.
-INPUTS:  const Parameters* parameters  CMAQ data to compare to.
+INPUTS:  const Parameters* parameters  CMAQ data stream to compare to.
 OUTPUTS: Aircraft* aircraft            Updated aircraft->data.
 RETURNS: Integer 1 if comparable, else 0 and failureMessage() called.
 ******************************************************************************/
@@ -880,7 +895,6 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
     const Integer* const aircraftRows    = aircraft->rows;
     const Integer* const aircraftColumns = aircraft->columns;
     const Integer* const aircraftPoints  = aircraft->outputPoints;
-    const Real* const cmaqData = parameters->data;
     CompareFunction comparer   = parameters->compareFunction;
     const Integer timesteps    = parameters->timesteps;
     const Integer firstLayer   = parameters->firstLayer;
@@ -894,6 +908,8 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
     const Integer columns      = lastColumn - firstColumn + 1;
     const Integer rowsTimesColumns = rows * columns;
     const Integer layersTimesRowsTimesColumns = layers * rowsTimesColumns;
+    Real* cmaqData = NEW_ZERO( Real, layersTimesRowsTimesColumns );
+    Integer ok = cmaqData != 0;
     Integer timestep = 0;
     Integer aircraftIndex = 0;
 
@@ -904,15 +920,20 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
 
     DEBUG( fprintf( stderr, "timesteps = %lld\n", timesteps ); )
 
-    for ( timestep = 0; timestep < timesteps; ++timestep ) {
+    /* Read CMAQ data one timestep at a time, only when needed: */
+
+    for ( timestep = 0; AND2( ok, timestep < timesteps ); ++timestep ) {
       const Integer points = aircraftPoints[ timestep ];
-      const Integer timestepOffset = timestep * layersTimesRowsTimesColumns;
       Integer point = 0;
 
       DEBUG( fprintf( stderr, "timestep = %lld, points = %lld\n",
                       timestep, points ); )
 
-      for ( point = 0; point < points; ++point, ++aircraftIndex ) {
+      if ( points ) {
+        ok = readCMAQTimestep( parameters, timestep, cmaqData );
+      }
+
+      for ( point = 0; AND2( ok, point < points ); ++point, ++aircraftIndex ) {
         const Integer aircraftLayer  = aircraftLayers[  aircraftIndex ];
         const Integer aircraftRow    = aircraftRows[    aircraftIndex ];
         const Integer aircraftColumn = aircraftColumns[ aircraftIndex ];
@@ -926,13 +947,12 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
           const Integer aircraftRow0    = aircraftRow    - firstRow;
           const Integer aircraftColumn0 = aircraftColumn - firstColumn;
           const Integer dataIndex =
-            timestepOffset + aircraftLayer0 * rowsTimesColumns +
+            aircraftLayer0 * rowsTimesColumns +
             aircraftRow0 * columns + aircraftColumn0;
           CHECK4( IN_RANGE( aircraftLayer0, 0, layers - 1 ),
                   IN_RANGE( aircraftRow0, 0, rows - 1 ),
                   IN_RANGE( aircraftColumn0, 0, columns - 1 ),
-                  IN_RANGE( dataIndex, 0,
-                            timesteps * layers * rows * columns - 1 ) );
+                  IN_RANGE( dataIndex, 0, layersTimesRowsTimesColumns - 1 ) );
           const Real aircraftDatum = aircraftData[ aircraftIndex ];
           const Real cmaqDatum = cmaqData[ dataIndex ];
           const Real comparedDatum = comparer( aircraftDatum, cmaqDatum );
@@ -946,6 +966,12 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
         }
       }
     }
+
+    FREE( cmaqData );
+
+    if ( ! ok ) {
+      result = 0;
+    }
   }
 
   if ( AND2( ! result, failureCount() == 0 ) ) {
@@ -166,15 +166,21 @@ void translateCALIPSO( Parameters* parameters ) {
   ZERO_OBJECT( &calipso );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDRHeader( parameters->input, &calipso ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( calipso.points );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridCALIPSO( parameters->input, parameters->regrid, parameters->grid,
                      &calipso );
 
+      timingPoints( calipso.totalRegriddedPoints );
+
       if ( calipso.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -212,9 +218,11 @@ void translateCALIPSO( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &calipso, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &calipso, parameters );
     }
   }
@@ -245,7 +253,10 @@ void compareRegriddedCALIPSO( Parameters* parameters ) {
     ZERO_OBJECT( &calipso );
     parameters->ok = 0;
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &calipso ) ) {
+      timingPoints( calipso.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 calipso.variable[ 0 ],
@@ -253,13 +264,17 @@ void compareRegriddedCALIPSO( Parameters* parameters ) {
                                 parameters->variable,
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &calipso ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( calipso.totalRegriddedPoints );
 
         if ( calipso.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &calipso, parameters );
         }
       }
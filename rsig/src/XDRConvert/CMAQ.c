@@ -110,12 +110,16 @@ void translateCMAQ( Parameters* parameters ) {
   ZERO_OBJECT( &cmaq );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters, &cmaq ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( cmaq.timesteps * cmaq.layers * cmaq.rows * cmaq.columns );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &cmaq, parameters );
     }
   }
@@ -608,7 +612,8 @@ static Integer writeASCII( CMAQ* cmaq, const Parameters* parameters ) {
   PRE02( isValidCMAQ( cmaq ), isValidParameters( parameters ) );
 
   Integer result = 0;
-  const char* const dataFormat = "\t%28.18"REAL_E_FORMAT;
+  const Integer dataWidth = 28; /* Same as "\t%28.18"REAL_E_FORMAT. */
+  const Integer dataPrecision = 18;
   const Integer dataFormatLength = 30;
   const Integer variables    = cmaq->variables;
   const Integer timesteps    = cmaq->timesteps;
@@ -683,7 +688,6 @@ static Integer writeASCII( CMAQ* cmaq, const Parameters* parameters ) {
                     AND2( output->ok( output ), layer < layers ); ++layer ) {
                 Integer row = 0;
                 char* outputBuffer = buffer;
-                memset( buffer, 0, bufferSize );
 
                 for ( row = 0; row < rows; ++row ) {
                   Integer column = 0;
@@ -703,37 +707,33 @@ static Integer writeASCII( CMAQ* cmaq, const Parameters* parameters ) {
                         grid->westEdge( grid ) +
                         ( parameters->firstColumn + column - 1 ) *
                         grid->cellWidth( grid );
-                      char word[ 40 ] = "";
-                      Integer count = 0;
-                      count = sprintf( word, dataFormat, longitude );
-                      CHECK( count < sizeof word / sizeof *word );
-                      CHECK( strlen( word ) == count );
-                      strncpy( outputBuffer, word, count );
-                      outputBuffer += count;
-                      count = sprintf( word, dataFormat, latitude );
-                      CHECK( count < sizeof word / sizeof *word );
-                      CHECK( strlen( word ) == count );
-                      strncpy( outputBuffer, word, count );
-                      outputBuffer += count;
-                      count = sprintf( word, dataFormat, elevation );
-                      CHECK( count < sizeof word / sizeof *word );
-                      CHECK( strlen( word ) == count );
-                      strncpy( outputBuffer, word, count );
-                      outputBuffer += count;
+                      *outputBuffer++ = '\t';
+                      outputBuffer =
+                        formatExponentialReal( longitude,
+                                               dataWidth, dataPrecision,
+                                               outputBuffer );
+                      *outputBuffer++ = '\t';
+                      outputBuffer =
+                        formatExponentialReal( latitude,
+                                               dataWidth, dataPrecision,
+                                               outputBuffer );
+                      *outputBuffer++ = '\t';
+                      outputBuffer =
+                        formatExponentialReal( elevation,
+                                               dataWidth, dataPrecision,
+                                               outputBuffer );
                     }
 
                     for ( variable = 0; variable < variables; ++variable ) {
                       Integer dataIndex =
                         variable * variableSize + timestep * timestepSize +
                         layer * layerSize + row * columns + column;
-                      char word[ 40 ] = "";
-                      Integer count = 0;
                       CHECK( IN_RANGE( dataIndex, 0, dataSize - 1 ) );
-                      count = sprintf( word, dataFormat, data[ dataIndex ] );
-                      CHECK( count < sizeof word / sizeof *word );
-                      CHECK( strlen( word ) == count );
-                      strncpy( outputBuffer, word, count );
-                      outputBuffer += count;
+                      *outputBuffer++ = '\t';
+                      outputBuffer =
+                        formatExponentialReal( data[ dataIndex ],
+                                               dataWidth, dataPrecision,
+                                               outputBuffer );
                     }
 
                     strcpy( outputBuffer, "\n" ); /* End of spreadsheet row. */
@@ -743,8 +743,8 @@ static Integer writeASCII( CMAQ* cmaq, const Parameters* parameters ) {
 
                 /* Write buffered output to stream: */
 
-                CHECK( strlen( buffer ) < bufferSize );
-                output->writeString( output, buffer );
+                CHECK( outputBuffer - buffer < bufferSize );
+                output->writeBytes( output, buffer, outputBuffer - buffer );
               }
             }
 
@@ -175,14 +175,20 @@ void translateGrid( Parameters* parameters ) {
   ZERO_OBJECT( &data );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &data ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( data.timesteps * data.rows * data.columns );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridData( parameters->regrid, parameters->grid, &data );
 
+      timingPoints( data.totalRegriddedPoints );
+
       if ( data.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -226,9 +232,11 @@ void translateGrid( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &data, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &data, parameters );
     }
   }
@@ -262,20 +270,27 @@ void compareRegriddedGrid( Parameters* parameters ) {
 
     DEBUG( fprintf( stderr, "compareRegriddedData()\n" ); )
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &data ) ) {
+      timingPoints( data.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 data.variable[ 3 ], data.units[ 3 ],
                                 parameters->variable,
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &data ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( data.totalRegriddedPoints );
 
         if ( data.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &data, parameters );
         }
       }
@@ -35,6 +35,15 @@ STATUS:  unreviewed, tested.
 
 enum { TWO_GB = 2147483647, BYTES_PER_NETCDF_FLOAT = 4 };
 
+/* Limits of format*() number formatting used by ASCII output: */
+
+enum {
+  MAXIMUM_FORMAT_WIDTH = 40,
+  MAXIMUM_FORMAT_PRECISION = 20,
+  FORMATTED_NUMBER_SIZE = 400, /* E.g., "%40.20f" of -DBL_MAX and '\0'. */
+  ASCII_ROWS_PER_BUFFER = 64    /* Formatted rows buffered per write. */
+};
+
 /*================================== TYPES ==================================*/
 
 typedef char Name[ 80 ];  /* Ozone, ppb. */
@@ -70,6 +79,11 @@ extern Integer readMatchedLine2( Stream* input,
 
 extern Integer skipInputLines( Stream* input, Integer count );
 
+extern Integer readRealSize( Stream* input, Integer* size );
+
+extern void readReals( Stream* input, Integer size, Integer count,
+                       Real reals[] );
+
 extern const char* skipWords( const char* string, Integer count );
 
 extern void aggregateName( const char* const inputVariableName,
@@ -119,6 +133,18 @@ extern void expandString( char* copy, const char* source, Integer length );
 
 extern Integer wordsInString( const char* const string );
 
+extern char* formatExponentialReal( Real value, Integer width,
+                                    Integer precision, char* output );
+
+extern char* formatFixedReal( Real value, Integer width, Integer precision,
+                              char* output );
+
+extern char* formatInteger( Integer value, Integer width, char* output );
+
+extern char* appendString( const char* string, char* output );
+
+extern char* flushBuffer( Stream* output, char* buffer, char* end );
+
 extern void timeData( Integer timesteps,
                       Integer hoursPerTimestep,
                       Integer totalPoints,
@@ -53,12 +53,17 @@ typedef struct {
   Real minimumValidValue; /* Or BADVAL3 for default. */
   Real* data;             /* data[ timesteps ][ rows ][ columns ]. */
   Real* data2;            /* data2[ timesteps ][ rows ][ columns ]. */
+  Stream* cmaqInput;      /* Or 0 if not streaming CMAQ data by timestep. */
+  Integer cmaqDataOffset; /* Byte offset of CMAQ data in cmaqInput. */
 } Parameters;
 
 /*================================ FUNCTIONS ================================*/
 
 extern Integer isValidParameters( const Parameters* parameters );
 
+extern Integer readCMAQTimestep( const Parameters* parameters,
+                                 Integer timestep, Real data[] );
+
 
 #ifdef __cplusplus
 }
@@ -248,14 +248,20 @@ void translatePoint( Parameters* parameters ) {
   ZERO_OBJECT( &data );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &data ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( data.points );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridData( parameters->regrid, parameters->grid, &data );
 
+      timingPoints( data.totalRegriddedPoints );
+
       if ( data.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -299,9 +305,11 @@ void translatePoint( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &data, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &data, parameters );
     }
   }
@@ -325,7 +333,7 @@ void compareRegriddedPoint( Parameters* parameters ) {
          parameters->ok, parameters->input->ok( parameters->input ) );
 
   if ( ! AND3( ! parameters->regrid, parameters->compareFunction,
-               parameters->data ) ) {
+               parameters->cmaqInput ) ) {
     failureMessage( "Invalid input for comparing." );
     parameters->ok = 0;
   } else {
@@ -335,20 +343,27 @@ void compareRegriddedPoint( Parameters* parameters ) {
 
     DEBUG( fprintf( stderr, "compareRegriddedData()\n" ); )
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &data ) ) {
+      timingPoints( data.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 data.variable[ 3 ], data.units[ 3 ],
                                 parameters->variable,
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &data ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( data.totalRegriddedPoints );
 
         if ( data.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &data, parameters );
         }
       }
@@ -880,7 +895,7 @@ static Integer readVariablesAndUnits2( Stream* input, Data* data ) {
 
 /******************************************************************************
 PURPOSE: compareRegriddedXDR - Compare Regridded data with CMAQ data.
-INPUTS:  const Parameters* parameters  CMAQ data to compare to.
+INPUTS:  const Parameters* parameters  CMAQ data stream to compare to.
 OUTPUTS: Data* data                    Updated data->data.
 RETURNS: Integer 1 if comparable, else 0 and failureMessage() called.
 ******************************************************************************/
@@ -905,7 +920,6 @@ static Integer compareRegriddedXDR( const Parameters* parameters, Data* data) {
     const Integer* const pointRows    = data->rows;
     const Integer* const pointColumns = data->columns;
     const Integer* const pointsPerTimestep = data->outputPoints;
-    const Real* const cmaqData = parameters->data;
     CompareFunction comparer   = parameters->compareFunction;
     const Integer timesteps    = parameters->timesteps;
     const Integer firstRow     = parameters->firstRow;
@@ -919,20 +933,27 @@ static Integer compareRegriddedXDR( const Parameters* parameters, Data* data) {
     const Integer columns      = lastColumn - firstColumn + 1;
     const Integer rowsTimesColumns = rows * columns;
     const Integer layersTimesRowsTimesColumns = layers * rowsTimesColumns;
+    Real* cmaqData = NEW_ZERO( Real, layersTimesRowsTimesColumns );
+    Integer ok = cmaqData != 0;
     Integer timestep = 0;
     Integer pointIndex = 0;
 
     DEBUG( fprintf( stderr, "timesteps = %lld\n", timesteps ); )
 
-    for ( timestep = 0; timestep < timesteps; ++timestep ) {
+    /* Read CMAQ data one timestep at a time, only when needed: */
+
+    for ( timestep = 0; AND2( ok, timestep < timesteps ); ++timestep ) {
       const Integer points = pointsPerTimestep[ timestep ];
-      const Integer timestepOffset = timestep * layersTimesRowsTimesColumns;
       Integer point = 0;
 
       DEBUG( fprintf( stderr, "timestep = %lld, points = %lld\n",
                       timestep, points ); )
 
-      for ( point = 0; point < points; ++point, ++pointIndex ) {
+      if ( points ) {
+        ok = readCMAQTimestep( parameters, timestep, cmaqData );
+      }
+
+      for ( point = 0; AND2( ok, point < points ); ++point, ++pointIndex ) {
         const Integer pointLayer  = pointLayers ? pointLayers[ pointIndex ] : 1;
         const Integer pointRow    = pointRows[    pointIndex ];
         const Integer pointColumn = pointColumns[ pointIndex ];
@@ -946,13 +967,12 @@ static Integer compareRegriddedXDR( const Parameters* parameters, Data* data) {
           const Integer pointRow0    = pointRow    - firstRow;
           const Integer pointColumn0 = pointColumn - firstColumn;
           const Integer dataIndex =
-            timestepOffset + pointLayer0 * rowsTimesColumns +
+            pointLayer0 * rowsTimesColumns +
             pointRow0 * columns + pointColumn0;
           CHECK4( IN_RANGE( pointLayer0,  0, layers  - 1 ),
                   IN_RANGE( pointRow0,    0, rows    - 1 ),
                   IN_RANGE( pointColumn0, 0, columns - 1 ),
-                  IN_RANGE( dataIndex, 0,
-                            timesteps * layers * rows * columns - 1 ) );
+                  IN_RANGE( dataIndex, 0, layersTimesRowsTimesColumns - 1 ) );
           const Real pointDatum = pointData[ pointIndex ];
           const Real cmaqDatum = cmaqData[ dataIndex ];
           const Real comparedDatum = comparer( pointDatum, cmaqDatum );
@@ -966,6 +986,12 @@ static Integer compareRegriddedXDR( const Parameters* parameters, Data* data) {
         }
       }
     }
+
+    FREE( cmaqData );
+
+    if ( ! ok ) {
+      result = 0;
+    }
   }
 
   POST02( IS_BOOL( result ), isValidData( data ) );
@@ -986,7 +1012,10 @@ static Integer writeASCII( const Data* data, const Parameters* unused ) {
   PRE0( isValidData( data ) );
 
   Integer result = 0;
-  Stream* output = newFileStream( "-stdout", "wb" );
+  const Integer rowSize = ( data->variables + 2 ) * FORMATTED_NUMBER_SIZE;
+  const Integer bufferSize = ASCII_ROWS_PER_BUFFER * rowSize;
+  char* buffer = NEW( char, bufferSize );
+  Stream* output = buffer ? newFileStream( "-stdout", "wb" ) : 0;
 
   if ( output ) {
     const Integer hasElevation =
@@ -1027,8 +1056,13 @@ static Integer writeASCII( const Data* data, const Parameters* unused ) {
         const Real* const longitudes = timestamps + pointCount;
         const Real* const latitudes  = longitudes + pointCount;
         const Real* const elevations = hasElevation ? latitudes + pointCount :0;
+        const Integer width = 10; /* Same as "\t%10.5lf". */
+        const Integer precision = 5;
+        char* end = buffer;
         Integer pointIndex = 0;
 
+        /* Format rows into buffer and write it when nearly full: */
+
         for ( pointIndex = 0;
               AND2( output->ok( output ), pointIndex < pointCount );
               ++pointIndex ) {
@@ -1039,34 +1073,39 @@ static Integer writeASCII( const Data* data, const Parameters* unused ) {
           UTCTimestamp timestamp;
           toUTCTimestamp2( yyyymmddhhmmss, timestamp );
 
-          output->writeString( output, "%s\t%10.5lf\t%10.5lf",
-                              timestamp, longitude, latitude );
+          end = appendString( timestamp, end );
+          *end++ = '\t';
+          end = formatFixedReal( longitude, width, precision, end );
+          *end++ = '\t';
+          end = formatFixedReal( latitude, width, precision, end );
 
-          if ( output->ok( output ) ) {
-
-            if ( hasElevation ) {
-              output->writeString( output, "\t%10.5lf", elevation );
-            }
+          if ( hasElevation ) {
+            *end++ = '\t';
+            end = formatFixedReal( elevation, width, precision, end );
+          }
 
-            for ( variable = 3 + hasElevation;
-                 AND2( output->ok( output ), variable < data->variables );
-                 ++variable ) {
-              const Integer index = variable * pointCount + pointIndex;
-              const Real value = data->data[ index ];
-              output->writeString( output, "\t%10.5lf", value );
-            }
+          for ( variable = 3 + hasElevation; variable < data->variables;
+                ++variable ) {
+            const Integer index = variable * pointCount + pointIndex;
+            const Real value = data->data[ index ];
+            *end++ = '\t';
+            end = formatFixedReal( value, width, precision, end );
+          }
 
-            if ( output->ok( output ) ) {
+          if ( data->notes ) {
+            end += sprintf( end, "\t%-80s\n", data->notes[ pointIndex ] );
+          } else {
+            *end++ = '\n';
+          }
 
-              if ( data->notes ) {
-                output->writeString( output, "\t%-80s\n",
-                                     data->notes[ pointIndex ] );
-              } else {
-                output->writeString( output, "\n" );
-              }
-            }
+          if ( end - buffer > bufferSize - rowSize ) {
+            end = flushBuffer( output, buffer, end );
           }
         }
+
+        if ( output->ok( output ) ) {
+          end = flushBuffer( output, buffer, end );
+        }
       }
     }
 
@@ -1074,6 +1113,8 @@ static Integer writeASCII( const Data* data, const Parameters* unused ) {
     FREE_OBJECT( output );
   }
 
+  FREE( buffer );
+
   POST0( IS_BOOL( result ) );
   return result;
 }
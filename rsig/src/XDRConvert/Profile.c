@@ -173,14 +173,20 @@ void translateProfile( Parameters* parameters ) {
   ZERO_OBJECT( &profile );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &profile ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( profile.totalPoints );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridProfile( parameters->regrid, parameters->grid, &profile );
 
+      timingPoints( profile.totalRegriddedPoints );
+
       if ( profile.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -218,9 +224,11 @@ void translateProfile( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &profile, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &profile, parameters );
     }
   }
@@ -243,7 +251,7 @@ void compareRegriddedProfile( Parameters* parameters ) {
   PRE03( isValidParameters( parameters ),
          parameters->ok, parameters->input->ok( parameters->input ) );
 
-  if ( ! AND2( parameters->compareFunction, parameters->data ) ) {
+  if ( ! AND2( parameters->compareFunction, parameters->cmaqInput ) ) {
     failureMessage( "Invalid input for comparing." );
     parameters->ok = 0;
   } else {
@@ -251,19 +259,26 @@ void compareRegriddedProfile( Parameters* parameters ) {
     ZERO_OBJECT( &profile );
     parameters->ok = 0;
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &profile ) ) {
+      timingPoints( profile.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 profile.variable[ 0 ], profile.units[ 0 ],
                                 parameters->variable, parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &profile ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( profile.totalRegriddedPoints );
 
         if ( profile.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &profile, parameters );
         }
       }
@@ -736,7 +751,7 @@ static Integer readRegriddedXDRData( Stream* input, Profile* profile ) {
 
 /******************************************************************************
 PURPOSE: compareRegriddedXDR - Compare Regridded data with CMAQ data.
-INPUTS:  const Parameters* parameters  CMAQ data to compare to.
+INPUTS:  const Parameters* parameters  CMAQ data stream to compare to.
 OUTPUTS: Profile* profile            Updated profile->data.
 RETURNS: Integer 1 if comparable, else 0 and failureMessage() called.
 ******************************************************************************/
@@ -762,7 +777,6 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
     const Integer* const profileRows    = profile->rows;
     const Integer* const profileColumns = profile->columns;
     const Integer* const profilePoints  = profile->outputPoints;
-    const Real* const cmaqData = parameters->data;
     CompareFunction comparer   = parameters->compareFunction;
     const Integer timesteps    = parameters->timesteps;
     const Integer firstLayer   = parameters->firstLayer;
@@ -776,6 +790,8 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
     const Integer columns      = lastColumn - firstColumn + 1;
     const Integer rowsTimesColumns = rows * columns;
     const Integer layersTimesRowsTimesColumns = layers * rowsTimesColumns;
+    Real* cmaqData = NEW_ZERO( Real, layersTimesRowsTimesColumns );
+    Integer ok = cmaqData != 0;
     Integer timestep = 0;
     Integer profileIndex = 0;
 
@@ -786,15 +802,20 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
 
     DEBUG( fprintf( stderr, "timesteps = %lld\n", timesteps ); )
 
-    for ( timestep = 0; timestep < timesteps; ++timestep ) {
+    /* Read CMAQ data one timestep at a time, only when needed: */
+
+    for ( timestep = 0; AND2( ok, timestep < timesteps ); ++timestep ) {
       const Integer points = profilePoints[ timestep ];
-      const Integer timestepOffset = timestep * layersTimesRowsTimesColumns;
       Integer point = 0;
 
       DEBUG( fprintf( stderr, "timestep = %lld, points = %lld\n",
                       timestep, points ); )
 
-      for ( point = 0; point < points; ++point, ++profileIndex ) {
+      if ( points ) {
+        ok = readCMAQTimestep( parameters, timestep, cmaqData );
+      }
+
+      for ( point = 0; AND2( ok, point < points ); ++point, ++profileIndex ) {
         const Integer profileLayer  = profileLayers[  profileIndex ];
         const Integer profileRow    = profileRows[    profileIndex ];
         const Integer profileColumn = profileColumns[ profileIndex ];
@@ -808,7 +829,7 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
           const Integer profileRow0    = profileRow    - firstRow;
           const Integer profileColumn0 = profileColumn - firstColumn;
           const Integer dataIndex =
-            timestepOffset + profileLayer0 * rowsTimesColumns +
+            profileLayer0 * rowsTimesColumns +
             profileRow0 * columns + profileColumn0;
           const Real profileDatum = profileData[ profileIndex ];
           const Real cmaqDatum = cmaqData[ dataIndex ];
@@ -816,8 +837,7 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
           CHECK4( IN_RANGE( profileLayer0, 0, layers - 1 ),
                  IN_RANGE( profileRow0, 0, rows - 1 ),
                  IN_RANGE( profileColumn0, 0, columns - 1 ),
-                 IN_RANGE( dataIndex, 0,
-                          timesteps * layers * rows * columns - 1 ) );
+                 IN_RANGE( dataIndex, 0, layersTimesRowsTimesColumns - 1 ) );
           profileData[ profileIndex ] = comparedDatum;
           result = 1;
           DEBUG( fprintf( stderr, "f(%lf, %lf) -> %lf\n",
@@ -828,6 +848,12 @@ static Integer compareRegriddedXDR( const Parameters* parameters,
         }
       }
     }
+
+    FREE( cmaqData );
+
+    if ( ! ok ) {
+      result = 0;
+    }
   }
 
   if ( AND2( ! result, failureCount() == 0 ) ) {
@@ -926,16 +952,22 @@ static Integer writeASCIIData( Profile* profile, Stream* output ) {
   PRE03( isValidProfile( profile ), output, output->isWritable( output ) );
 
   Integer result = 0;
-  const char* const dataFormat = "\t%28.6"REAL_F_FORMAT;
+  const Integer dataWidth = 28; /* Same as "\t%28.6"REAL_F_FORMAT. */
+  const Integer dataPrecision = 6;
+  const Integer idWidth = 10;
   const Integer variables = profile->variables;
   const Integer profiles  = profile->profiles;
   const Real* profileData = profile->data;
+  const Integer rowSize = ( variables + 1 ) * FORMATTED_NUMBER_SIZE;
+  const Integer bufferSize = ASCII_ROWS_PER_BUFFER * rowSize;
+  char* buffer = NEW( char, bufferSize );
+  char* end = buffer;
   Integer p = 0;
   Integer theProfile = 0;
 
-  /* Write data rows: */
+  /* Write data rows, formatted into buffer: */
 
-  for ( theProfile = 0; theProfile < profiles; ++theProfile ) {
+  for ( theProfile = 0; AND2( buffer, theProfile < profiles ); ++theProfile ) {
     const Integer profilePoints = profile->points[ theProfile ];
     Integer point = 0;
 
@@ -946,22 +978,22 @@ static Integer writeASCIIData( Profile* profile, Stream* output ) {
       UTCTimestamp timestampString = "";
       CHECK( isValidYYYYMMDDHHMMSS( timestamp ) );
       toUTCTimestamp2( timestamp, timestampString );
-      output->writeString( output, timestampString ); /* Begin row. */
+      end = appendString( timestampString, end ); /* Begin row. */
+      *end++ = '\t';
+      end = formatInteger( (Integer)
+                           profileData[ offset + DATA_ID * profilePoints ],
+                           idWidth, end );
+
+      for ( variable = 2; variable < variables; ++variable ) {
+        const Real datum = profileData[ offset + variable * profilePoints ];
+        *end++ = '\t';
+        end = formatFixedReal( datum, dataWidth, dataPrecision, end );
+      }
 
-      if ( output->ok( output ) ) {
-        output->writeString( output, "\t%10lld", (Integer)
-                             profileData[ offset + DATA_ID * profilePoints ] );
-
-        for ( variable = 2;
-              AND2( output->ok( output ), variable < variables );
-              ++variable ) {
-          const Real datum = profileData[ offset + variable * profilePoints ];
-          output->writeString( output, dataFormat, datum );
-        }
+      *end++ = '\n'; /* End row. */
 
-        if ( output->ok( output ) ) {
-          output->writeString( output, "\n" ); /* End row. */
-        }
+      if ( end - buffer > bufferSize - rowSize ) {
+        end = flushBuffer( output, buffer, end );
 
         if ( ! output->ok( output ) ) {
           point = profilePoints;
@@ -973,8 +1005,18 @@ static Integer writeASCIIData( Profile* profile, Stream* output ) {
     p += variables * profilePoints;
   }
 
-  CHECK( p == profile->variables * profile->totalPoints );
-  result = output->ok( output );
+  if ( buffer ) {
+
+    if ( output->ok( output ) ) {
+      end = flushBuffer( output, buffer, end );
+    }
+
+    CHECK( IMPLIES( output->ok( output ),
+                    p == profile->variables * profile->totalPoints ) );
+    result = output->ok( output );
+    FREE( buffer );
+  }
+
   POST0( IS_BOOL( result ) );
   return result;
 }
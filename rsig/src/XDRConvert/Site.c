@@ -37,6 +37,7 @@ typedef struct {
   Note*    notes;                /* notes[ stations ]. */
   Real*    sites;           /* sites[ stations * 2 = LONGITUDE, LATITUDE ]. */
   Real*    data;            /* data[ variables * timesteps * stations ]. */
+  Integer  realSize;        /* 8 or 4 bytes per input data real. */
   /* Regrid data: */
   Integer  totalRegriddedPoints; /* Total number of aggregated points. */
   Real*    stationLongitudes;    /* stationLongitudes[ station ]. */
@@ -157,14 +158,20 @@ void translateSite( Parameters* parameters ) {
   site.scale = 1.0;
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &site ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( site.timesteps * site.stations );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
+      timingStage( "regrid" );
       regridSite( parameters->regrid, parameters->grid, &site );
 
+      timingPoints( site.totalRegriddedPoints );
+
       if ( site.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -208,9 +215,11 @@ void translateSite( Parameters* parameters ) {
           }
         }
 
+        timingStage( "write" );
         parameters->ok = writer( &site, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &site, parameters );
     }
   }
@@ -245,20 +254,27 @@ void compareRegriddedSite( Parameters* parameters ) {
 
     DEBUG( fprintf( stderr, "compareRegriddedSite()\n" ); )
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &site ) ) {
+      timingPoints( site.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 site.variable[ 0 ], site.units[ 0 ], 
                                 parameters->variable,
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &site ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( site.totalRegriddedPoints );
 
         if ( site.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &site, parameters );
         }
       }
@@ -448,6 +464,8 @@ ppb
 # MSB 64-bit integers ids[stations] and
 # IEEE-754 64-bit reals sites[stations][2=<longitude,latitude>] and
 # IEEE-754 64-bit reals data[timesteps][stations]:
+         or the float32 variant whose last line is:
+# IEEE-754 32-bit reals data[timesteps][stations]:
 ******************************************************************************/
 
 static Integer readXDR( Stream* input, Site* site ) {
@@ -470,7 +488,8 @@ static Integer readXDR( Stream* input, Site* site ) {
 
         if ( readVariablesAndUnits2( input, site ) ) {
 
-          if ( skipInputLines( input, 4 ) ) {
+          if ( AND2( skipInputLines( input, 3 ),
+                     readRealSize( input, &site->realSize ) ) ) {
             result = readXDRData( input, site );
           }
         }
@@ -498,9 +517,9 @@ RETURNS: Integer 1 if successful, else 0 and failureMessage is called.
 
 static Integer readXDRData( Stream* input, Site* site ) {
 
-  PRE08( input, input->ok( input ), input->isReadable( input ),
+  PRE09( input, input->ok( input ), input->isReadable( input ),
          site, site->sites == 0, site->units[ 0 ],
-         site->ids == 0, site->data == 0 );
+         site->ids == 0, site->data == 0, IN3( site->realSize, 4, 8 ) );
 
   Integer result = 0;
   site->ids = NEW_ZERO( Integer, site->stations );
@@ -522,10 +541,14 @@ static Integer readXDRData( Stream* input, Site* site ) {
 
           if ( input->ok( input ) ) {
             site->data = site->sites + siteCount;
-            input->read64BitReals( input, site->sites, count );
+            input->read64BitReals( input, site->sites, siteCount );
 
             if ( input->ok( input ) ) {
-              result = isValidSite( site );
+              readReals( input, site->realSize, dataCount, site->data );
+
+              if ( input->ok( input ) ) {
+                result = isValidSite( site );
+              }
             }
           }
         }
@@ -872,7 +895,10 @@ static Integer writeASCII( const Site* site, const Parameters* unused ) {
   PRE0( isValidSite( site ) );
 
   Integer result = 0;
-  Stream* output = newFileStream( "-stdout", "wb" );
+  const Integer rowSize = 8 * FORMATTED_NUMBER_SIZE;
+  const Integer bufferSize = ASCII_ROWS_PER_BUFFER * rowSize;
+  char* buffer = NEW( char, bufferSize );
+  Stream* output = buffer ? newFileStream( "-stdout", "wb" ) : 0;
 
   if ( output ) {
     const Integer isVector = isVectorVariable( site );
@@ -903,8 +929,12 @@ static Integer writeASCII( const Site* site, const Parameters* unused ) {
         Integer timestep = 0;
         Integer yyyydddhhmm = fromUTCTimestamp( site->timestamp );
         UTCTimestamp timestamp;
+        const Integer width = 10; /* Same as "%10.5f". */
+        const Integer precision = 5;
+        const Integer idWidth = 20;
+        char* end = buffer;
 
-        /* Write data rows: */
+        /* Write data rows, formatted into buffer: */
 
         do {
           Integer station = 0;
@@ -918,24 +948,32 @@ static Integer writeASCII( const Site* site, const Parameters* unused ) {
             const Integer index  = timestep * stations + station;
             const Real data      = site->data[ index ];
 
+            end = appendString( timestamp, end );
+            *end++ = '\t';
+            end = formatFixedReal( longitude, width, precision, end );
+            *end++ = '\t';
+            end = formatFixedReal( latitude, width, precision, end );
+            *end++ = '\t';
+            end = formatInteger( id, idWidth, end );
+            *end++ = '\t';
+            end = formatFixedReal( data, width, precision, end );
+
             if ( isVector ) {
-              const char* const dataFormat =
-                "%s\t%10.5f\t%10.5f\t%20"INTEGER_FORMAT"\t%10.5f\t%10.5f\n";
               const Integer index2 = index + totalPoints;
               const Real data2 = site->data[ index2 ];
-              output->writeString( output, dataFormat,
-                                   timestamp, longitude, latitude, id,
-                                   data, data2 );
-           } else {
-              const char* const dataFormat =
-                "%s\t%10.5f\t%10.5f\t%20"INTEGER_FORMAT"\t%10.5f\n";
-              output->writeString( output, dataFormat,
-                                   timestamp, longitude, latitude, id, data );
+              *end++ = '\t';
+              end = formatFixedReal( data2, width, precision, end );
             }
 
-            if ( ! output->ok( output ) ) {
-              station  = stations;
-              timestep = timesteps;
+            *end++ = '\n';
+
+            if ( end - buffer > bufferSize - rowSize ) {
+              end = flushBuffer( output, buffer, end );
+
+              if ( ! output->ok( output ) ) {
+                station  = stations;
+                timestep = timesteps;
+              }
             }
 
             ++station;
@@ -944,6 +982,10 @@ static Integer writeASCII( const Site* site, const Parameters* unused ) {
           incrementTimestamp( &yyyydddhhmm );
           ++timestep;
         } while ( timestep < timesteps );
+
+        if ( output->ok( output ) ) {
+          end = flushBuffer( output, buffer, end );
+        }
       }
     }
 
@@ -951,6 +993,8 @@ static Integer writeASCII( const Site* site, const Parameters* unused ) {
     FREE_OBJECT( output );
   }
 
+  FREE( buffer );
+
   POST0( IS_BOOL( result ) );
   return result;
 }
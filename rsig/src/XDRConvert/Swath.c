@@ -39,6 +39,7 @@ typedef struct {
   Integer      scans;           /* E.g., 35 half-hour daylight scans. */
   Integer      totalPoints;     /* Sum of points[ scan ]. */
   Integer      maximumPoints;   /* Number of scan points in a hour. */
+  Integer      realSize;        /* 8 or 4 bytes per input data real. */
   Real         domain[ 2 ][ 2]; /*domain[LONGITUDE LATITUDE][MINIMUM MAXIMUM]*/
   UTCTimestamp timestamp;
   Line         note;            /* File note/description. */
@@ -176,7 +177,8 @@ static Integer readScanDataForTimestamp( Integer yyyydddhh00,
                                          Real latitudesNE[],
                                          Integer* points );
 
-static Integer readScanData( Stream* input, Integer variables, Integer points,
+static Integer readScanData( Stream* input, Integer variables,
+                             Integer realSize, Integer points,
                              Real longitudes[], Real latitudes[],
                              Real data[],
                              Real longitudesSW[],
@@ -208,13 +210,17 @@ void translateSwath( Parameters* parameters ) {
   ZERO_OBJECT( &data );
   parameters->ok = 0;
 
+  timingStage( "read" );
+
   if ( readXDR( parameters->input, &data ) ) {
     Writer writer = dispatcher( parameters->format, parameters->regrid );
+    timingPoints( data.totalPoints );
 
     if ( ! writer ) {
       failureMessage( "Invalid/unsupported format/regrid specification." );
     } else if ( parameters->regrid ) {
       const Integer hasCorners = IN3( data.variables, 11, 12 );
+      timingStage( "regrid" );
       DEBUG( { time_t s = time(0);
                fprintf( stderr, "%sregridData()...\n", ctime(&s) ); } )
       if ( hasCorners ) { /* Has corners so regrid and aggregate. */
@@ -224,6 +230,8 @@ void translateSwath( Parameters* parameters ) {
                     &data );
       }
 
+      timingPoints( data.totalRegriddedPoints );
+
       if ( data.totalRegriddedPoints == 0 ) {
         failureMessage( "No points projected onto the grid." );
       } else {
@@ -275,9 +283,11 @@ void translateSwath( Parameters* parameters ) {
         }
 
         DEBUG( {time_t s=time(0);fprintf(stderr,"%swriter()...\n",ctime(&s));})
+        timingStage( "write" );
         parameters->ok = writer( &data, parameters );
       }
     } else {
+      timingStage( "write" );
       parameters->ok = writer( &data, parameters );
     }
   }
@@ -311,20 +321,27 @@ void compareRegriddedSwath( Parameters* parameters ) {
     ZERO_OBJECT( &data );
     parameters->ok = 0;
 
+    timingStage( "read" );
+
     if ( readRegriddedXDR( parameters->input, &data ) ) {
+      timingPoints( data.totalRegriddedPoints );
       compareFunctionNameUnits( parameters->compareFunction,
                                 parameters->convertFunction,
                                 data.variable[ 0 ], data.units[ 0 ], 
                                 parameters->variable, 
                                 parameters->units );
 
+      timingStage( "compare" );
+
       if ( compareRegriddedXDR( parameters, &data ) ) {
         Writer writer = dispatcher( parameters->format, 1 );
         CHECK( writer );
+        timingPoints( data.totalRegriddedPoints );
 
         if ( data.totalRegriddedPoints == 0 ) {
           failureMessage( "No points projected onto the grid." );
         } else {
+          timingStage( "write" );
           parameters->ok = writer( &data, parameters );
         }
       }
@@ -493,7 +510,8 @@ static Integer readXDR( Stream* input, Data* data ) {
 
             if ( readDomain( input, data->domain ) ) {
 
-              if ( skipInputLines( input, 3 ) ) {
+              if ( AND2( skipInputLines( input, 2 ),
+                         readRealSize( input, &data->realSize ) ) ) {
                 result = readXDRData( input, data );
               }
             }
@@ -974,60 +992,71 @@ static Integer writeASCIIData( Data* data, Stream* input, Stream* output ) {
 
   Integer result = 0;
   const Integer variables = data->variables;
-  const char* const dataFormat = "\t%28.12e";
+  const Integer dataWidth = 28; /* Same as "\t%28.12e". */
+  const Integer dataPrecision = 12;
+  const Integer rowSize = ( variables + 1 ) * FORMATTED_NUMBER_SIZE;
+  const Integer bufferSize = ASCII_ROWS_PER_BUFFER * rowSize;
+  char* buffer = NEW( char, bufferSize );
   const Integer scans = data->scans;
   Integer scan = 0;
 
-  /* Write data rows: */
+  /* Write data rows, formatted and buffered, to output: */
 
-  do {
-    const Integer scanPoints = data->points[ scan ];
-    const Integer scanSize = variables * scanPoints;
+  if ( buffer ) {
+    char* end = buffer;
 
-    input->read64BitReals( input, data->data, scanSize );
+    do {
+      const Integer scanPoints = data->points[ scan ];
+      const Integer scanSize = variables * scanPoints;
 
-    if ( ! input->ok( input ) ) {
-      scan = scans;
-    } else {
-      Real* scanData = data->data;
-      Integer point = 0;
-      const Integer timestamp = data->timestamps[ scan ];
-      UTCTimestamp timestampString;
-      toUTCTimestamp( timestamp, timestampString );
+      readReals( input, data->realSize, scanSize, data->data );
 
-      do {
-        output->writeString( output, timestampString ); /* Begin row. */
+      if ( ! input->ok( input ) ) {
+        scan = scans;
+      } else {
+        Real* scanData = data->data;
+        Integer point = 0;
+        const Integer timestamp = data->timestamps[ scan ];
+        UTCTimestamp timestampString;
+        toUTCTimestamp( timestamp, timestampString );
 
-        if ( output->ok( output ) ) {
+        do {
           Integer variable = 0;
+          end = appendString( timestampString, end ); /* Begin row. */
 
-          do {
+          for ( variable = 0; variable < variables; ++variable ) {
             const Real datum = *( scanData + variable * scanPoints );
-            output->writeString( output, dataFormat, datum );
+            *end++ = '\t';
+            end = formatExponentialReal( datum, dataWidth, dataPrecision, end );
+          }
+
+          *end++ = '\n'; /* End of row. */
+
+          if ( end - buffer > bufferSize - rowSize ) {
+            end = flushBuffer( output, buffer, end );
 
             if ( ! output->ok( output ) ) {
-              variable = variables;
               point = scanPoints;
               scan = scans;
             }
+          }
 
-            ++variable;
-          } while ( variable < variables );
+          ++scanData;
+          ++point;
+        } while ( point < scanPoints );
+      }
 
-          if ( output->ok( output ) ) {
-            output->writeString( output, "\n" ); /* End of row. */
-          }
-        }
+      ++scan;
+    } while ( scan < scans );
 
-        ++scanData;
-        ++point;
-      } while ( point < scanPoints );
+    if ( output->ok( output ) ) {
+      end = flushBuffer( output, buffer, end );
     }
 
-    ++scan;
-  } while ( scan < scans );
+    FREE( buffer );
+    result = AND2( input->ok( input ), output->ok( output ) );
+  }
 
-  result = AND2( input->ok( input ), output->ok( output ) );
   POST0( IS_BOOL( result ) );
   return result;
 }
@@ -1162,7 +1191,7 @@ static Integer writeCOARDSData(Integer file, Stream* input, const Data* data) {
         variable == 1 ? "latitude" :
         data->variable[ variable ];
 
-      input->read64BitReals( input, data->data, count );
+      readReals( input, data->realSize, count, data->data );
 
       if ( ! AND2( input->ok( input ),
                    writeSomeData( file, variableName, start,
@@ -2891,7 +2920,7 @@ static Integer readScanDataForTimestamp( Integer yyyydddhh00, Stream* input,
       if ( hasCorners ) {
         DEBUG( fprintf( stderr, "  %lld reading %lld values of data into offset = %lld\n",
                        yyyydddhh00, count, offset ); )
-        ok = readScanData( input, data->variables, count,
+        ok = readScanData( input, data->variables, data->realSize, count,
                            data->longitudes + offset,
                            data->latitudes  + offset,
                            data->data       + offset,
@@ -2905,7 +2934,7 @@ static Integer readScanDataForTimestamp( Integer yyyydddhh00, Stream* input,
                            latitudesNE      + offset );
 
       } else {
-        ok = readScanData( input, data->variables, count,
+        ok = readScanData( input, data->variables, data->realSize, count,
                            data->longitudes + offset,
                            data->latitudes  + offset,
                            data->data       + offset,
@@ -2941,6 +2970,7 @@ static Integer readScanDataForTimestamp( Integer yyyydddhh00, Stream* input,
 PURPOSE: readScanData - Read all variables for a given scan for regridding.
 INPUTS:  Stream* input               Stream to read data from.
          Integer variables           Number of scan variables.
+         Integer realSize            8 or 4 bytes per real in input.
          Integer points              Number of scan points to read.
 OUTPUTS: Real longitudes[ points ]  Longitude data.
          Real latitudes[ points ]   Latitude data.
@@ -2956,7 +2986,8 @@ OUTPUTS: Real longitudes[ points ]  Longitude data.
 RETURNS: Integer 1 if successful, else 0 and failureMessage is called.
 ******************************************************************************/
 
-static Integer readScanData( Stream* input, Integer variables, Integer points,
+static Integer readScanData( Stream* input, Integer variables,
+                             Integer realSize, Integer points,
                              Real longitudes[], Real latitudes[],
                              Real data[],
                              Real longitudesSW[], Real longitudesSE[],
@@ -2964,8 +2995,8 @@ static Integer readScanData( Stream* input, Integer variables, Integer points,
                              Real latitudesSW[],  Real latitudesSE[],
                              Real latitudesNW[],  Real latitudesNE[] ) {
 
-  PRE08( input, input->isReadable( input ), IN5( variables, 3, 4, 11, 12 ),
-         points > 0,
+  PRE09( input, input->isReadable( input ), IN5( variables, 3, 4, 11, 12 ),
+         IN3( realSize, 4, 8 ), points > 0,
          longitudes, latitudes, data,
          IMPLIES_ELSE( IN3( variables, 11, 12 ),
                        NON_ZERO8( longitudesSW, longitudesSE,
@@ -2991,7 +3022,7 @@ static Integer readScanData( Stream* input, Integer variables, Integer points,
       variable == 1 ? latitudes  :
       data; /* Read Scan_Start_Time into data then overwrite it with AOD. */
 
-    input->read64BitReals( input, output, points );
+    readReals( input, realSize, points, output );
     DEBUG( fprintf( stderr, "    v = %lld, read [%f ... %f]\n",
                     variable, output[ 0 ], output[ points - 1 ] ); )
     ++variable;
@@ -3013,7 +3044,7 @@ static Integer readScanData( Stream* input, Integer variables, Integer points,
 
     do {
       Real* const output = cornerCoordinates[ variable ];
-      input->read64BitReals( input, output, points );
+      readReals( input, realSize, points, output );
       DEBUG( fprintf( stderr, "    v = %lld, readlonlat [%f ... %f]\n",
                       variable, output[ 0 ], output[ points - 1 ] ); )
       ++variable;
@@ -18,6 +18,19 @@ HISTORY: 2001/04 Created.
 #include <Assertions.h>    /* For PRE0*(), POST0*().  */
 #include <BasicNumerics.h> /* For public definitions. */
 
+/*
+ * On x86_64, array byte-rotation and 32-bit to 64-bit expansion use SIMD
+ * instructions: SSE2 (always available on x86_64) or, if the CPU supports it
+ * (checked at runtime), AVX2. Results are bit-identical to the scalar loops.
+ */
+
+#if defined( __x86_64__ ) && defined( __GNUC__ ) && IS_LITTLE_ENDIAN
+#define USE_SIMD 1
+#include <immintrin.h> /* For __m128i, __m256i, _mm*_shuffle_epi8(). */
+#else
+#define USE_SIMD 0
+#endif
+
 /*================================= MACROS ==================================*/
 
 #ifdef MIN
@@ -25,6 +38,42 @@ HISTORY: 2001/04 Created.
 #endif
 #define MIN(a,b) ((a)<(b)?(a):(b))
 
+/* Number of array items rotated per (possibly parallel) loop iteration: */
+
+#define ROTATE_BLOCK_SIZE 65536
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static void rotate4Bytes( void* array, Integer count );
+
+static void rotate8Bytes( void* array, Integer count );
+
+#if USE_SIMD
+
+static Integer hasAVX2( void );
+
+static Integer rotate4BytesSSE2( void* array, Integer count );
+
+static Integer rotate8BytesSSE2( void* array, Integer count );
+
+static Integer rotateAndExpandSSE2( Real* array, Integer count );
+
+static Integer expandSSE2( Real* array, Integer count );
+
+static Integer rotate4BytesAVX2( void* array, Integer count )
+  __attribute__(( target( "avx2" ) ));
+
+static Integer rotate8BytesAVX2( void* array, Integer count )
+  __attribute__(( target( "avx2" ) ));
+
+static Integer rotateAndExpandAVX2( Real* array, Integer count )
+  __attribute__(( target( "avx2" ) ));
+
+static Integer expandAVX2( Real* array, Integer count )
+  __attribute__(( target( "avx2" ) ));
+
+#endif
+
 /*============================ PUBLIC FUNCTIONS =============================*/
 
 
@@ -1552,18 +1601,14 @@ void rotate4ByteArrayIfLittleEndian( void* array, Integer count ) {
   PRE02( array, count > 0 );
   assert_static( sizeof (int) == 4 );
   int* const array4 = array;
-  Integer index = 0;
+  const Integer blocks = ( count + ROTATE_BLOCK_SIZE - 1 ) / ROTATE_BLOCK_SIZE;
+  Integer block = 0;
 
 #pragma omp parallel for
 
-  for ( index = 0; index < count; ++index ) {
-    const int value = array4[ index ];
-    const int newValue =
-      ( value & 0xff000000 ) >> 24 |
-      ( value & 0x00ff0000 ) >>  8 |
-      ( value & 0x0000ff00 ) <<  8 |
-      ( value & 0x000000ff ) << 24;
-    array4[ index ] = newValue;
+  for ( block = 0; block < blocks; ++block ) {
+    const Integer first = block * ROTATE_BLOCK_SIZE;
+    rotate4Bytes( array4 + first, MIN( count - first, ROTATE_BLOCK_SIZE ) );
   }
 
 #endif /* IS_LITTLE_ENDIAN */
@@ -1619,22 +1664,14 @@ void rotate8ByteArrayIfLittleEndian( void* array, Integer count ) {
   PRE02( array, count > 0 );
   assert_static( sizeof (Integer) == 8 );
   Integer* const array8 = array;
-  Integer index = 0;
+  const Integer blocks = ( count + ROTATE_BLOCK_SIZE - 1 ) / ROTATE_BLOCK_SIZE;
+  Integer block = 0;
 
 #pragma omp parallel for
 
-  for ( index = 0; index < count; ++index ) {
-    const Integer value = array8[ index ];
-    const Integer newValue =
-    ( value & INTEGER_CONSTANT( 0xff00000000000000 ) ) >> 56 |
-    ( value & INTEGER_CONSTANT( 0x00ff000000000000 ) ) >> 40 |
-    ( value & INTEGER_CONSTANT( 0x0000ff0000000000 ) ) >> 24 |
-    ( value & INTEGER_CONSTANT( 0x000000ff00000000 ) ) >>  8 |
-    ( value & INTEGER_CONSTANT( 0x00000000ff000000 ) ) <<  8 |
-    ( value & INTEGER_CONSTANT( 0x0000000000ff0000 ) ) << 24 |
-    ( value & INTEGER_CONSTANT( 0x000000000000ff00 ) ) << 40 |
-    ( value & INTEGER_CONSTANT( 0x00000000000000ff ) ) << 56;
-    array8[ index ] = newValue;
+  for ( block = 0; block < blocks; ++block ) {
+    const Integer first = block * ROTATE_BLOCK_SIZE;
+    rotate8Bytes( array8 + first, MIN( count - first, ROTATE_BLOCK_SIZE ) );
   }
 
 #endif /* IS_LITTLE_ENDIAN */
@@ -1657,9 +1694,89 @@ void expand32BitValues( Real* array, Integer count ) {
   const float* source = farray + count; /* 1 past last element. */
   Real* destination   = array  + count; /* 1 past last element. */
 
+#if USE_SIMD
+
+  /*
+   * Expand the trailing values that don't fill a SIMD register then let the
+   * SIMD routine expand the leading values, also from back to front:
+   */
+
+  const Integer simdCount = count - count % 8;
+
+  while ( destination != array + simdCount ) {
+    *--destination = *--source; /* Expand 32-bits to 64-bits. */
+  }
+
+  if ( simdCount ) {
+    if ( hasAVX2() ) {
+      expandAVX2( array, simdCount );
+    } else {
+      expandSSE2( array, simdCount );
+    }
+  }
+
+#else
+
   do {
     *--destination = *--source; /* Expand 32-bits to 64-bits. */
   } while ( destination != array );
+
+#endif
+
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotateAndExpand32BitValues - Rotate 4-bytes of each 32-bit
+         floating-point value if on a little-endian platform and copy/expand
+         them to 64-bit values.
+INPUTS:  Real* array    Array of (big-endian) 32-bit values to expand in-place.
+         Integer count  Number of values in array.
+OUTPUTS: Real* array    Expanded array of (native) 64-bit values.
+NOTES:   Equivalent to rotate4ByteArrayIfLittleEndian() followed by
+         expand32BitValues() but makes just one pass over the array.
+******************************************************************************/
+
+void rotateAndExpand32BitValues( Real* array, Integer count ) {
+  PRE02( array, count > 0 );
+
+#if IS_LITTLE_ENDIAN
+
+  int* const iarray = (int*) array;
+  const int* source = iarray + count; /* 1 past last element. */
+  Real* destination = array  + count; /* 1 past last element. */
+  Integer simdCount = 0;
+
+#if USE_SIMD
+  simdCount = count - count % 8;
+#endif
+
+  while ( destination != array + simdCount ) {
+    union { int i; float f; } value;
+    value.i = *--source;
+    rotate4ByteWordIfLittleEndian( &value.i );
+    *--destination = value.f; /* Expand 32-bits to 64-bits. */
+  }
+
+#if USE_SIMD
+
+  if ( simdCount ) {
+    if ( hasAVX2() ) {
+      rotateAndExpandAVX2( array, simdCount );
+    } else {
+      rotateAndExpandSSE2( array, simdCount );
+    }
+  }
+
+#endif
+
+#else
+
+  expand32BitValues( array, count );
+
+#endif /* IS_LITTLE_ENDIAN */
+
 }
 
 
@@ -1740,3 +1857,354 @@ void windUV( const Real windDirection, const Real windSpeed,
 
 
 
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: rotate4Bytes - Rotate 4-bytes of each array item.
+INPUTS:  void* array    Array of 4-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array of rotated values.
+******************************************************************************/
+
+static void rotate4Bytes( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  int* const array4 = array;
+  Integer index = 0;
+
+#if USE_SIMD
+  index = hasAVX2() ? rotate4BytesAVX2( array, count )
+          : rotate4BytesSSE2( array, count );
+#endif
+
+  for ( ; index < count; ++index ) {
+    const int value = array4[ index ];
+    const int newValue =
+      ( value & 0xff000000 ) >> 24 |
+      ( value & 0x00ff0000 ) >>  8 |
+      ( value & 0x0000ff00 ) <<  8 |
+      ( value & 0x000000ff ) << 24;
+    array4[ index ] = newValue;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotate8Bytes - Rotate 8-bytes of each array item.
+INPUTS:  void* array    Array of 8-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array of rotated values.
+******************************************************************************/
+
+static void rotate8Bytes( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  Integer* const array8 = array;
+  Integer index = 0;
+
+#if USE_SIMD
+  index = hasAVX2() ? rotate8BytesAVX2( array, count )
+          : rotate8BytesSSE2( array, count );
+#endif
+
+  for ( ; index < count; ++index ) {
+    const Integer value = array8[ index ];
+    const Integer newValue =
+    ( value & INTEGER_CONSTANT( 0xff00000000000000 ) ) >> 56 |
+    ( value & INTEGER_CONSTANT( 0x00ff000000000000 ) ) >> 40 |
+    ( value & INTEGER_CONSTANT( 0x0000ff0000000000 ) ) >> 24 |
+    ( value & INTEGER_CONSTANT( 0x000000ff00000000 ) ) >>  8 |
+    ( value & INTEGER_CONSTANT( 0x00000000ff000000 ) ) <<  8 |
+    ( value & INTEGER_CONSTANT( 0x0000000000ff0000 ) ) << 24 |
+    ( value & INTEGER_CONSTANT( 0x000000000000ff00 ) ) << 40 |
+    ( value & INTEGER_CONSTANT( 0x00000000000000ff ) ) << 56;
+    array8[ index ] = newValue;
+  }
+}
+
+
+
+#if USE_SIMD
+
+/******************************************************************************
+PURPOSE: hasAVX2 - Does the CPU support AVX2 instructions?
+RETURNS: Integer 1 if so, else 0.
+******************************************************************************/
+
+static Integer hasAVX2( void ) {
+  static int result = -1; /* Not yet checked. Benign race if threaded. */
+
+  if ( result == -1 ) {
+    __builtin_cpu_init();
+    result = __builtin_cpu_supports( "avx2" ) != 0;
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotate4BytesSSE2 - Rotate 4-bytes of each leading array item using
+         SSE2 instructions.
+INPUTS:  void* array    Array of 4-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array with leading values rotated.
+RETURNS: Integer number of leading items rotated (a multiple of 4).
+******************************************************************************/
+
+static Integer rotate4BytesSSE2( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  __m128i* const words = array;
+  const Integer result = count - count % 4;
+  const Integer vectors = result / 4;
+  Integer index = 0;
+
+  for ( index = 0; index < vectors; ++index ) {
+    const __m128i value = _mm_loadu_si128( words + index );
+    const __m128i swapped =
+      _mm_shufflehi_epi16( _mm_shufflelo_epi16( value, 0xb1 ), 0xb1 );
+    _mm_storeu_si128( words + index,
+                      _mm_or_si128( _mm_slli_epi16( swapped, 8 ),
+                                    _mm_srli_epi16( swapped, 8 ) ) );
+  }
+
+  POST0( IN_RANGE( result, 0, count ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotate8BytesSSE2 - Rotate 8-bytes of each leading array item using
+         SSE2 instructions.
+INPUTS:  void* array    Array of 8-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array with leading values rotated.
+RETURNS: Integer number of leading items rotated (a multiple of 2).
+******************************************************************************/
+
+static Integer rotate8BytesSSE2( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  __m128i* const words = array;
+  const Integer result = count - count % 2;
+  const Integer vectors = result / 2;
+  Integer index = 0;
+
+  for ( index = 0; index < vectors; ++index ) {
+    const __m128i value = _mm_loadu_si128( words + index );
+    const __m128i swapped =
+      _mm_shufflehi_epi16( _mm_shufflelo_epi16( value, 0x1b ), 0x1b );
+    _mm_storeu_si128( words + index,
+                      _mm_or_si128( _mm_slli_epi16( swapped, 8 ),
+                                    _mm_srli_epi16( swapped, 8 ) ) );
+  }
+
+  POST0( IN_RANGE( result, 0, count ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotateAndExpandSSE2 - Rotate and expand 32-bit values to 64-bit
+         values in-place using SSE2 instructions.
+INPUTS:  Real* array    Array of big-endian 32-bit values to expand.
+         Integer count  Number of values in array. Multiple of 4.
+OUTPUTS: Real* array    Expanded array of 64-bit values.
+RETURNS: Integer count.
+NOTES:   Loops from back to front so the 64-bit results never overwrite
+         32-bit values that have not yet been loaded.
+******************************************************************************/
+
+static Integer rotateAndExpandSSE2( Real* array, Integer count ) {
+  PRE03( array, count > 0, count % 4 == 0 );
+  const float* const source = (const float*) array;
+  Integer index = count;
+
+  do {
+    index -= 4;
+    {
+      const __m128i value = _mm_loadu_si128( (const __m128i*)(source + index));
+      const __m128i swapped0 =
+        _mm_shufflehi_epi16( _mm_shufflelo_epi16( value, 0xb1 ), 0xb1 );
+      const __m128i swapped =
+        _mm_or_si128( _mm_slli_epi16( swapped0, 8 ),
+                      _mm_srli_epi16( swapped0, 8 ) );
+      const __m128 values = _mm_castsi128_ps( swapped );
+      _mm_storeu_pd( array + index + 2,
+                     _mm_cvtps_pd( _mm_movehl_ps( values, values ) ) );
+      _mm_storeu_pd( array + index, _mm_cvtps_pd( values ) );
+    }
+  } while ( index );
+
+  return count;
+}
+
+
+
+/******************************************************************************
+PURPOSE: expandSSE2 - Expand 32-bit values to 64-bit values in-place using
+         SSE2 instructions.
+INPUTS:  Real* array    Array of 32-bit values to expand.
+         Integer count  Number of values in array. Multiple of 4.
+OUTPUTS: Real* array    Expanded array of 64-bit values.
+RETURNS: Integer count.
+NOTES:   Loops from back to front so the 64-bit results never overwrite
+         32-bit values that have not yet been loaded.
+******************************************************************************/
+
+static Integer expandSSE2( Real* array, Integer count ) {
+  PRE03( array, count > 0, count % 4 == 0 );
+  const float* const source = (const float*) array;
+  Integer index = count;
+
+  do {
+    index -= 4;
+    {
+      const __m128 values = _mm_loadu_ps( source + index );
+      _mm_storeu_pd( array + index + 2,
+                     _mm_cvtps_pd( _mm_movehl_ps( values, values ) ) );
+      _mm_storeu_pd( array + index, _mm_cvtps_pd( values ) );
+    }
+  } while ( index );
+
+  return count;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotate4BytesAVX2 - Rotate 4-bytes of each leading array item using
+         AVX2 instructions.
+INPUTS:  void* array    Array of 4-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array with leading values rotated.
+RETURNS: Integer number of leading items rotated (a multiple of 8).
+******************************************************************************/
+
+static Integer rotate4BytesAVX2( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  __m256i* const words = array;
+  const Integer result = count - count % 8;
+  const Integer vectors = result / 8;
+  const __m256i mask =
+    _mm256_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+  Integer index = 0;
+
+  for ( index = 0; index < vectors; ++index ) {
+    const __m256i value = _mm256_loadu_si256( words + index );
+    _mm256_storeu_si256( words + index, _mm256_shuffle_epi8( value, mask ) );
+  }
+
+  POST0( IN_RANGE( result, 0, count ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotate8BytesAVX2 - Rotate 8-bytes of each leading array item using
+         AVX2 instructions.
+INPUTS:  void* array    Array of 8-byte values to rotate.
+         Integer count  Number of items in array.
+OUTPUTS: void* array    Array with leading values rotated.
+RETURNS: Integer number of leading items rotated (a multiple of 4).
+******************************************************************************/
+
+static Integer rotate8BytesAVX2( void* array, Integer count ) {
+  PRE02( array, count > 0 );
+  __m256i* const words = array;
+  const Integer result = count - count % 4;
+  const Integer vectors = result / 4;
+  const __m256i mask =
+    _mm256_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+  Integer index = 0;
+
+  for ( index = 0; index < vectors; ++index ) {
+    const __m256i value = _mm256_loadu_si256( words + index );
+    _mm256_storeu_si256( words + index, _mm256_shuffle_epi8( value, mask ) );
+  }
+
+  POST0( IN_RANGE( result, 0, count ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: rotateAndExpandAVX2 - Rotate and expand 32-bit values to 64-bit
+         values in-place using AVX2 instructions.
+INPUTS:  Real* array    Array of big-endian 32-bit values to expand.
+         Integer count  Number of values in array. Multiple of 8.
+OUTPUTS: Real* array    Expanded array of 64-bit values.
+RETURNS: Integer count.
+NOTES:   Loops from back to front so the 64-bit results never overwrite
+         32-bit values that have not yet been loaded.
+******************************************************************************/
+
+static Integer rotateAndExpandAVX2( Real* array, Integer count ) {
+  PRE03( array, count > 0, count % 8 == 0 );
+  const float* const source = (const float*) array;
+  const __m256i mask =
+    _mm256_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+  Integer index = count;
+
+  do {
+    index -= 8;
+    {
+      const __m256i value =
+        _mm256_loadu_si256( (const __m256i*) ( source + index ) );
+      const __m256 values =
+        _mm256_castsi256_ps( _mm256_shuffle_epi8( value, mask ) );
+      _mm256_storeu_pd( array + index + 4,
+                        _mm256_cvtps_pd( _mm256_extractf128_ps( values, 1 )));
+      _mm256_storeu_pd( array + index,
+                        _mm256_cvtps_pd( _mm256_castps256_ps128( values ) ) );
+    }
+  } while ( index );
+
+  return count;
+}
+
+
+
+/******************************************************************************
+PURPOSE: expandAVX2 - Expand 32-bit values to 64-bit values in-place using
+         AVX2 instructions.
+INPUTS:  Real* array    Array of 32-bit values to expand.
+         Integer count  Number of values in array. Multiple of 8.
+OUTPUTS: Real* array    Expanded array of 64-bit values.
+RETURNS: Integer count.
+NOTES:   Loops from back to front so the 64-bit results never overwrite
+         32-bit values that have not yet been loaded.
+******************************************************************************/
+
+static Integer expandAVX2( Real* array, Integer count ) {
+  PRE03( array, count > 0, count % 8 == 0 );
+  const float* const source = (const float*) array;
+  Integer index = count;
+
+  do {
+    index -= 8;
+    {
+      const __m256 values = _mm256_loadu_ps( source + index );
+      _mm256_storeu_pd( array + index + 4,
+                        _mm256_cvtps_pd( _mm256_extractf128_ps( values, 1 )));
+      _mm256_storeu_pd( array + index,
+                        _mm256_cvtps_pd( _mm256_castps256_ps128( values ) ) );
+    }
+  } while ( index );
+
+  return count;
+}
+
+#endif /* USE_SIMD */
+
+
+
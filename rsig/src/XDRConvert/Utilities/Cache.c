@@ -0,0 +1,532 @@
+
+/******************************************************************************
+PURPOSE: Cache.c - Defines routines for a private on-disk cache of derived
+         binary data.
+NOTES:   See Cache.h. Uses only the standard C and POSIX libraries so it can
+         be compiled into the subsetters that have their own Utilities.
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stdio.h>     /* For stderr, fprintf(), snprintf(), rename().      */
+#include <stdlib.h>    /* For getenv(), atoll(), malloc(), free(), qsort(). */
+#include <string.h>    /* For memset(), memcmp(), strncpy(), strstr().      */
+
+#ifndef _WIN32
+#include <unistd.h>    /* For read(), write(), close(), unlink(), geteuid().*/
+#include <fcntl.h>     /* For open(), O_RDONLY, O_NOFOLLOW.                 */
+#include <dirent.h>    /* For DIR, opendir(), readdir(), closedir().        */
+#include <sys/stat.h>  /* For struct stat, mkdir(), lstat(), futimens().    */
+#endif
+
+#include <Assertions.h> /* For PRE0*(), POST0*(), AND*(), IN_RANGE().        */
+#include <Cache.h>      /* For public interface.                            */
+
+/*================================== TYPES ==================================*/
+
+#define CACHE_TAG "RSIG cache 1.0"
+
+/* Each cache file is a Header followed by the key then the payload: */
+
+typedef struct {
+  char tag[ 16 ];                 /* CACHE_TAG. */
+  unsigned long long keySize;     /* Bytes of key after header. */
+  unsigned long long payloadSize; /* Bytes of payload after key. */
+  unsigned long long checksum;    /* FNV-1a 64-bit hash of key and payload. */
+} Header;
+
+enum {
+  NAME_SIZE = 256,           /* Maximum length of path names plus 1. */
+  HASH_DIGITS = 16,          /* Hex digits of hash in file names. */
+  DEFAULT_MEGABYTES = 1024,  /* If RSIG_CACHE_MEGABYTES is not set. */
+  PRUNE_INTERVAL = 64        /* Check the cache size every this many writes.*/
+};
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+#ifndef _WIN32
+
+/* Cache file found when pruning: */
+
+typedef struct {
+  time_t    used;              /* st_mtime, updated on each read. */
+  long long size;              /* st_size. */
+  char      name[ NAME_SIZE ]; /* Path name of file. */
+} Entry;
+
+/*============================ PRIVATE VARIABLES ============================*/
+
+static int writes = 0; /* Number of files written, to prune periodically. */
+
+#endif /* ! defined( _WIN32 ) */
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static unsigned long long hash( unsigned long long result,
+                                const void* data, size_t size );
+
+#ifndef _WIN32
+
+static int cacheDirectory( char directory[ NAME_SIZE ] );
+
+static int cacheFileName( const char* kind, const void* key, size_t keySize,
+                          char directory[ NAME_SIZE ],
+                          char name[ NAME_SIZE ] );
+
+static int isCacheFileName( const char* name );
+
+static int readBytes( int file, void* data, size_t size );
+
+static int writeBytes( int file, const void* data, size_t size );
+
+static void pruneCache( const char* directory );
+
+static int compareEntries( const void* entry1, const void* entry2 );
+
+#endif /* ! defined( _WIN32 ) */
+
+/*============================= PUBLIC FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: readCache - Read a cached payload, if present and valid.
+INPUTS:  const char* kind    Kind of data cached. E.g., "grid_cell_coordinates".
+         const void* key     Bytes that identify the source data.
+         size_t keySize      Number of bytes in key.
+OUTPUTS: size_t* payloadSize Number of bytes returned or 0 if none.
+RETURNS: void* payload allocated by malloc() for the caller to free(),
+         or 0 if there is no cache file for the key or it is invalid.
+NOTES:   A hit marks the file as recently used.
+******************************************************************************/
+
+void* readCache( const char* kind, const void* key, size_t keySize,
+                 size_t* payloadSize ) {
+
+  PRE05( kind, *kind, key, keySize, payloadSize );
+
+  void* result = 0;
+  *payloadSize = 0;
+
+#ifndef _WIN32
+  {
+    char directory[ NAME_SIZE ] = "";
+    char name[ NAME_SIZE ] = "";
+
+    if ( cacheFileName( kind, key, keySize, directory, name ) ) {
+      const int file = open( name, O_RDONLY | O_NOFOLLOW );
+
+      if ( file != -1 ) {
+        struct stat info;
+        Header header;
+        memset( &header, 0, sizeof header );
+
+        if ( AND7( fstat( file, &info ) == 0,
+                   S_ISREG( info.st_mode ),
+                   info.st_uid == geteuid(),
+                   readBytes( file, &header, sizeof header ),
+                   ! strncmp( header.tag, CACHE_TAG, sizeof header.tag ),
+                   header.keySize == keySize,
+                   (unsigned long long) info.st_size ==
+                     sizeof header + keySize + header.payloadSize ) ) {
+          const size_t size = header.payloadSize;
+          void* const fileKey = malloc( keySize );
+          void* const payload = fileKey ? malloc( size ? size : 1 ) : 0;
+
+          if ( AND5( payload,
+                     readBytes( file, fileKey, keySize ),
+                     ! memcmp( fileKey, key, keySize ),
+                     readBytes( file, payload, size ),
+                     hash( hash( FNV_OFFSET_BASIS, fileKey, keySize ),
+                           payload, size ) == header.checksum ) ) {
+            result = payload;
+            *payloadSize = size;
+            futimens( file, 0 ); /* Mark as recently used for pruning. */
+          } else {
+            free( payload );
+          }
+
+          free( fileKey );
+        }
+
+        close( file );
+      }
+    }
+
+    DEBUG( fprintf( stderr, "readCache( %s ) = %p, %lu\n",
+                    name, result, (unsigned long) *payloadSize ); )
+  }
+#endif /* ! defined( _WIN32 ) */
+
+  POST0( IMPLIES( ! result, *payloadSize == 0 ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeCache - Write a payload to the cache.
+INPUTS:  const char* kind    Kind of data cached. E.g., "grid_cell_coordinates".
+         const void* key     Bytes that identify the source data.
+         size_t keySize      Number of bytes in key.
+         int count           Number of payload parts.
+         const void* const payloads[ count ]  Parts to write in order.
+         const size_t sizes[ count ]          Bytes in each part.
+NOTES:   Replaces any existing file for the key. Not thread-safe.
+******************************************************************************/
+
+void writeCache( const char* kind, const void* key, size_t keySize,
+                 int count, const void* const payloads[],
+                 const size_t sizes[] ) {
+
+  PRE07( kind, *kind, key, keySize, count > 0, payloads, sizes );
+
+#ifndef _WIN32
+  char directory[ NAME_SIZE ] = "";
+  char name[ NAME_SIZE ] = "";
+
+  if ( cacheFileName( kind, key, keySize, directory, name ) ) {
+    char temporaryName[ NAME_SIZE + 8 ] = "";
+    const int length =
+      snprintf( temporaryName, sizeof temporaryName, "%s.XXXXXX", name );
+
+    if ( IN_RANGE( length, 1, (int) sizeof temporaryName - 1 ) ) {
+      const int file = mkstemp( temporaryName ); /* Mode 0600, O_EXCL. */
+
+      if ( file != -1 ) {
+        Header header;
+        int ok = 0;
+        int index = 0;
+        memset( &header, 0, sizeof header );
+        strncpy( header.tag, CACHE_TAG, sizeof header.tag - 1 );
+        header.keySize = keySize;
+        header.checksum = hash( FNV_OFFSET_BASIS, key, keySize );
+
+        for ( index = 0; index < count; ++index ) {
+          CHECK( IMPLIES( sizes[ index ], payloads[ index ] ) );
+          header.payloadSize += sizes[ index ];
+          header.checksum =
+            hash( header.checksum, payloads[ index ], sizes[ index ] );
+        }
+
+        ok = AND2( writeBytes( file, &header, sizeof header ),
+                   writeBytes( file, key, keySize ) );
+
+        for ( index = 0; AND2( ok, index < count ); ++index ) {
+          ok = writeBytes( file, payloads[ index ], sizes[ index ] );
+        }
+
+        ok = AND2( close( file ) == 0, ok );
+        ok = AND2( ok, rename( temporaryName, name ) == 0 );
+
+        if ( ! ok ) {
+          unlink( temporaryName );
+        } else if ( writes++ % PRUNE_INTERVAL == 0 ) {
+          pruneCache( directory );
+        }
+
+        DEBUG( fprintf( stderr, "writeCache( %s ) = %d\n", name, ok ); )
+      }
+    }
+  }
+#endif /* ! defined( _WIN32 ) */
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: hash - Continue an FNV-1a 64-bit hash over bytes.
+INPUTS:  unsigned long long result  FNV_OFFSET_BASIS or hash so far.
+         const void* data           Bytes to hash.
+         size_t size                Number of bytes to hash.
+RETURNS: unsigned long long hash of all bytes so far.
+******************************************************************************/
+
+static unsigned long long hash( unsigned long long result,
+                                const void* data, size_t size ) {
+  const unsigned char* c = data;
+  const unsigned char* const end = c + size;
+
+  for ( ; c != end; ++c ) {
+    result ^= *c;
+    result *= FNV_PRIME;
+  }
+
+  return result;
+}
+
+
+
+#ifndef _WIN32
+
+/******************************************************************************
+PURPOSE: cacheDirectory - Name of the private cache directory, created if
+         needed.
+OUTPUTS: char directory[ NAME_SIZE ]  $RSIG_CACHE_DIRECTORY or
+                                      $HOME/.rsig_cache or "" if none.
+RETURNS: int 1 if the directory is a real directory owned by the user with no
+         group or other access, else 0.
+******************************************************************************/
+
+static int cacheDirectory( char directory[ NAME_SIZE ] ) {
+
+  PRE0( directory );
+
+  const char* const configured = getenv( "RSIG_CACHE_DIRECTORY" );
+  const char* const home = getenv( "HOME" );
+  int result = 0;
+  int length = 0;
+  memset( directory, 0, NAME_SIZE );
+
+  if ( AND2( configured, *configured ) ) {
+    length = snprintf( directory, NAME_SIZE, "%s", configured );
+  } else if ( AND2( home, *home ) ) {
+    length = snprintf( directory, NAME_SIZE, "%s/.rsig_cache", home );
+  }
+
+  if ( IN_RANGE( length, 1, NAME_SIZE - 1 ) ) {
+    struct stat info;
+    mkdir( directory, 0700 ); /* Fails harmlessly if it already exists. */
+    result =
+      AND4( lstat( directory, &info ) == 0,
+            S_ISDIR( info.st_mode ),
+            info.st_uid == geteuid(),
+            ( info.st_mode & 077 ) == 0 );
+  }
+
+  if ( ! result ) {
+    memset( directory, 0, NAME_SIZE );
+  }
+
+  POST02( IS_BOOL( result ), IMPLIES( result, *directory ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: cacheFileName - Name of the cache file for a key.
+INPUTS:  const char* kind   Kind of data cached.
+         const void* key    Bytes that identify the source data.
+         size_t keySize     Number of bytes in key.
+OUTPUTS: char directory[ NAME_SIZE ]  Cache directory.
+         char name[ NAME_SIZE ]       directory/kind_hash.bin.
+RETURNS: int 1 if there is a usable cache directory and the name fits, else 0.
+******************************************************************************/
+
+static int cacheFileName( const char* kind, const void* key, size_t keySize,
+                          char directory[ NAME_SIZE ],
+                          char name[ NAME_SIZE ] ) {
+
+  PRE06( kind, *kind, key, keySize, directory, name );
+
+  int result = 0;
+  memset( name, 0, NAME_SIZE );
+
+  if ( cacheDirectory( directory ) ) {
+    const int length =
+      snprintf( name, NAME_SIZE, "%s/%s_%016llx.bin", directory, kind,
+                hash( FNV_OFFSET_BASIS, key, keySize ) );
+    result = IN_RANGE( length, 1, NAME_SIZE - 1 );
+
+    if ( ! result ) {
+      memset( name, 0, NAME_SIZE );
+    }
+  }
+
+  POST02( IS_BOOL( result ), IMPLIES( result, isCacheFileName( name ) ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: isCacheFileName - Is name that of a (possibly temporary) cache file?
+INPUTS:  const char* name  Name of file to check.
+RETURNS: int 1 if name ends with _<16 hex digits>.bin or
+         _<16 hex digits>.bin.XXXXXX, else 0.
+NOTES:   Pruning only removes files with such names.
+******************************************************************************/
+
+static int isCacheFileName( const char* name ) {
+  PRE0( name );
+  const char* const bin = strstr( name, ".bin" );
+  int result = 0;
+
+  if ( AND2( bin, bin - name > HASH_DIGITS ) ) {
+    const char* const suffix = bin + 4;
+    const char* digit = bin - HASH_DIGITS;
+    result =
+      AND2( digit[ -1 ] == '_',
+            OR2( *suffix == '\0',
+                 AND2( *suffix == '.', strlen( suffix ) == 7 ) ) );
+
+    for ( ; AND2( result, digit != bin ); ++digit ) {
+      result = OR2( IN_RANGE( *digit, '0', '9' ), IN_RANGE( *digit, 'a', 'f'));
+    }
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readBytes - Read bytes from a file.
+INPUTS:  int file     File descriptor to read.
+         size_t size  Number of bytes to read.
+OUTPUTS: void* data   Bytes read.
+RETURNS: int 1 if all bytes were read, else 0.
+******************************************************************************/
+
+static int readBytes( int file, void* data, size_t size ) {
+  PRE02( file >= 0, IMPLIES( size, data ) );
+  char* bytes = data;
+  ssize_t count = 1;
+
+  while ( AND2( size, count > 0 ) ) {
+    count = read( file, bytes, size );
+
+    if ( count > 0 ) {
+      bytes += count;
+      size -= count;
+    }
+  }
+
+  return size == 0;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeBytes - Write bytes to a file.
+INPUTS:  int file          File descriptor to write.
+         const void* data  Bytes to write.
+         size_t size       Number of bytes to write.
+RETURNS: int 1 if all bytes were written, else 0.
+******************************************************************************/
+
+static int writeBytes( int file, const void* data, size_t size ) {
+  PRE02( file >= 0, IMPLIES( size, data ) );
+  const char* bytes = data;
+  ssize_t count = 1;
+
+  while ( AND2( size, count > 0 ) ) {
+    count = write( file, bytes, size );
+
+    if ( count > 0 ) {
+      bytes += count;
+      size -= count;
+    }
+  }
+
+  return size == 0;
+}
+
+
+
+/******************************************************************************
+PURPOSE: pruneCache - Remove least-recently used cache files until the cache
+         directory holds at most $RSIG_CACHE_MEGABYTES megabytes of them.
+INPUTS:  const char* directory  Cache directory.
+******************************************************************************/
+
+static void pruneCache( const char* directory ) {
+
+  PRE02( directory, *directory );
+
+  DIR* files = opendir( directory );
+
+  if ( files ) {
+    const char* const megabytes = getenv( "RSIG_CACHE_MEGABYTES" );
+    const long long limit =
+      ( AND2( megabytes, atoll( megabytes ) > 0 ) ? atoll( megabytes )
+        : DEFAULT_MEGABYTES ) * 1024LL * 1024LL;
+    long long total = 0;
+    size_t capacity = 0;
+    size_t count = 0;
+    Entry* entries = 0;
+    const struct dirent* file = 0;
+    int ok = 1;
+
+    while ( AND2( ok, ( file = readdir( files ) ) != 0 ) ) {
+
+      if ( isCacheFileName( file->d_name ) ) {
+
+        if ( count == capacity ) { /* Grow entries: */
+          const size_t newCapacity = capacity ? capacity + capacity : 256;
+          Entry* const newEntries =
+            realloc( entries, newCapacity * sizeof *entries );
+          ok = newEntries != 0;
+
+          if ( ok ) {
+            entries = newEntries;
+            capacity = newCapacity;
+          }
+        }
+
+        if ( ok ) {
+          Entry* const entry = entries + count;
+          struct stat info;
+          const int length =
+            snprintf( entry->name, sizeof entry->name, "%s/%s",
+                      directory, file->d_name );
+
+          if ( AND3( IN_RANGE( length, 1, (int) sizeof entry->name - 1 ),
+                     lstat( entry->name, &info ) == 0,
+                     S_ISREG( info.st_mode ) ) ) {
+            entry->used = info.st_mtime;
+            entry->size = info.st_size;
+            total += entry->size;
+            ++count;
+          }
+        }
+      }
+    }
+
+    closedir( files ), files = 0;
+
+    if ( AND2( total > limit, entries ) ) {
+      size_t index = 0;
+      qsort( entries, count, sizeof *entries, compareEntries );
+
+      for ( ; AND2( total > limit, index < count ); ++index ) {
+
+        if ( unlink( entries[ index ].name ) == 0 ) {
+          total -= entries[ index ].size;
+        }
+      }
+    }
+
+    DEBUG( fprintf( stderr, "pruneCache( %s ) total = %lld\n",
+                    directory, total ); )
+    free( entries ), entries = 0;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: compareEntries - qsort() comparison to order least-recently used first.
+INPUTS:  const void* entry1  First Entry to compare.
+         const void* entry2  Second Entry to compare.
+RETURNS: int -1 if entry1 was used before entry2, 1 if after, else 0.
+******************************************************************************/
+
+static int compareEntries( const void* entry1, const void* entry2 ) {
+  const time_t used1 = ( (const Entry*) entry1 )->used;
+  const time_t used2 = ( (const Entry*) entry2 )->used;
+  const int result = used1 < used2 ? -1 : used1 > used2 ? 1 : 0;
+  return result;
+}
+
+#endif /* ! defined( _WIN32 ) */
+
+
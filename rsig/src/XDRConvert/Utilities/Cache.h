@@ -0,0 +1,74 @@
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+PURPOSE: Cache.h - Declares routines for a private on-disk cache of derived
+         binary data, e.g., unprojected grid cell or decoded file coordinates.
+NOTES:   Cache files are in directory $RSIG_CACHE_DIRECTORY if set,
+         else $HOME/.rsig_cache. The directory is created with mode 0700 if
+         needed and is only used if it is a real directory owned by the user
+         with no group or other access. If neither variable is set then
+         nothing is cached.
+         Each entry is identified by a kind (e.g., "grid_cell_coordinates")
+         and a key (bytes that identify the source data, e.g., projection
+         and grid parameters or a file name, size and modification time).
+         The file name is the kind and a hash of the key. The file holds a
+         header, the key itself and the payload. The header holds the sizes
+         and a checksum of the key and payload, which a read verifies before
+         it returns the payload.
+         Files are created with mkstemp() (O_CREAT | O_EXCL, mode 0600)
+         then renamed so symbolic links are never followed on write and
+         concurrent runs never read a partially written file. Reads do not
+         follow symbolic links either.
+         Least-recently used files are removed when the directory exceeds
+         $RSIG_CACHE_MEGABYTES (default 1024) megabytes.
+         Failures are not reported: callers recompute the data instead.
+         readCache() may be called in parallel but writeCache() may not.
+         On Windows the cache is disabled.
+
+         Example usage:
+
+           const Key key = { ... };
+           size_t size = 0;
+           double* values = readCache( "values", &key, sizeof key, &size );
+
+           if ( ! AND2( values, size == count * sizeof *values ) ) {
+             free( values );
+             values = computeValues( count );
+
+             if ( values ) {
+               const void* const payloads[ 1 ] = { values };
+               const size_t sizes[ 1 ] = { count * sizeof *values };
+               writeCache( "values", &key, sizeof key, 1, payloads, sizes );
+             }
+           }
+
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+STATUS:  unreviewed, tested.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stddef.h> /* For size_t. */
+
+/*================================ FUNCTIONS ================================*/
+
+extern void* readCache( const char* kind, const void* key, size_t keySize,
+                        size_t* payloadSize );
+
+extern void writeCache( const char* kind, const void* key, size_t keySize,
+                        int count, const void* const payloads[],
+                        const size_t sizes[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACHE_H */
+
+
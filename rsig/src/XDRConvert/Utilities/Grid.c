@@ -8,7 +8,8 @@ HISTORY: 2007/12 plessel.todd@epa.gov, Created.
 
 /*================================ INCLUDES =================================*/
 
-#include <string.h> /* For memset(), memcpy(). */
+#include <stdlib.h> /* For free(). */
+#include <string.h> /* For memset(), memcpy(), strcmp(). */
 #include <math.h>   /* For log(), exp(), fabs(). */
 
 #ifdef DEBUGGING
@@ -16,15 +17,10 @@ HISTORY: 2007/12 plessel.todd@epa.gov, Created.
 #endif
 
 #if defined( _OPENMP ) && ! defined( SERIAL_REGRID )
-#include <omp.h> /* For omp_*_lock(). */
+#include <omp.h> /* For omp_get_max_threads(), omp_get_thread_num(). */
 #else
-typedef long long omp_lock_t;
 #define omp_get_max_threads() 1
 #define omp_get_thread_num() 0
-#define omp_init_lock(unused)
-#define omp_set_lock(unused)
-#define omp_unset_lock(unused)
-#define omp_destroy_lock(unused)
 #endif
 
 #include <Assertions.h>    /* For PRE*(), etc. */
@@ -37,6 +33,7 @@ typedef long long omp_lock_t;
 #include <Stereographic.h> /* For Stereographic. */
 #include <Utilities.h>     /* For appendNote(). */
 #include <RegridQuadrilaterals.h> /* For binQuadrilateralData(). */
+#include <Cache.h>         /* For readCache(), writeCache(). */
 #include <Grid.h>          /* For public interface. */
 
 #ifndef MIN
@@ -47,8 +44,55 @@ typedef long long omp_lock_t;
 #define MAX( a, b ) ( (a) > (b) ? (a) : (b) )
 #endif
 
+/* Number of points projected per projectPoints() call: */
+
+enum { PROJECT_POINTS = 1024 };
+
+/*
+ * Surface elevations (in meters above mean sea level) at which sigma-pressure
+ * grid cell elevations are tabulated. Between table entries elevations are
+ * linearly interpolated, which is well within 1mm of the MM5 formula.
+ * Surface elevations outside the table are computed directly.
+ */
+
+#define SIGMA_ELEVATION_MINIMUM (-500.0)
+#define SIGMA_ELEVATION_MAXIMUM 9000.0
+#define SIGMA_ELEVATION_STEP 1.0
+
 /*================================== TYPES ==================================*/
 
+/*
+ * Unprojected grid cell coordinates are cached (see Cache.h) so later runs
+ * on the same grid need not unproject each cell. The key is a
+ * GridCellCacheKey which holds the kind of points ("centers" here,
+ * "corners" in CMAQSubset), projection and grid parameters.
+ * The payload is native longitudes[ rows * columns ] then
+ * latitudes[ rows * columns ].
+ */
+
+#define GRID_CELL_CACHE_KIND "grid_cell_coordinates"
+#define GRID_CELL_CACHE_TAG "grid cell coordinates cache 1.0"
+
+typedef struct {
+  char    tag[ 40 ];         /* GRID_CELL_CACHE_TAG. */
+  char    kind[ 16 ];        /* "centers" or "corners". */
+  char    projection[ 16 ];  /* Projector name. E.g., "Lambert". */
+  Real    majorSemiaxis;     /* Of ellipsoid, in meters. */
+  Real    minorSemiaxis;     /* Of ellipsoid, in meters. */
+  Real    lowerLatitude;     /* Lambert/Albers lower or Stereographic secant.*/
+  Real    upperLatitude;     /* Lambert/Albers upper secant latitude. */
+  Real    centralLongitude;  /* Projection center longitude. */
+  Real    centralLatitude;   /* Projection center latitude. */
+  Real    falseEasting;      /* Projected x offset, in meters. */
+  Real    falseNorthing;     /* Projected y offset, in meters. */
+  Real    xOrigin;           /* Projected west  edge of grid, in meters. */
+  Real    yOrigin;           /* Projected south edge of grid, in meters. */
+  Real    xCell;             /* Width  of each grid cell,     in meters. */
+  Real    yCell;             /* Height of each grid cell,     in meters. */
+  Integer columns;           /* Number of points per row. */
+  Integer rows;              /* Number of points per column. */
+} GridCellCacheKey;
+
 /* Grid cell used for aggregate: */
 
 typedef struct {
@@ -66,12 +110,8 @@ typedef struct {
   Real    weights;           /* Data weight sum. */
   Real    minimumValidValue; /* Minimum value of valid data. */
   RegriddedNote regriddedNote; /* Optional: appended notes. */
-  omp_lock_t lock;           /* Lock to prevent race-condition on updates. */
 } Cell;
 
-static void lockCell(   Cell* cell ) { omp_set_lock(   &cell->lock ); }
-static void unlockCell( Cell* cell ) { omp_unset_lock( &cell->lock ); }
-
 struct GridPrivate {
   Projector* projector;  /* Projector for (lon, lat) -> (x, y).    */
 
@@ -109,6 +149,7 @@ struct GridPrivate {
 
   Real*   z;           /* z[thread][layers + 1] meters above mean sea-level.*/
   Cell*   cells;       /* cells[ rows ][ columns ][ layers ].           */
+  Real*   sigmaElevations; /* 0 or [surfaceElevations][1 + layers + 1]. */
 };
 
 typedef void (*PreAggregator)( Integer column, Integer row,
@@ -233,12 +274,26 @@ static Integer hasMembers( const Grid* self );
 
 static void computeLongitudesAndLatitudes( GridPrivate* data );
 
+static Integer gridCellCacheKey( const GridPrivate* data,
+                                 GridCellCacheKey* key );
+
+static Integer readGridCellCache( GridPrivate* data );
+
+static void writeGridCellCache( const GridPrivate* data );
+
 static void computeZ( Real g, Real R, Real A, Real T0s, Real P00,
                       Integer layers, Integer type, Real topPressure,
                       const Real levels[], Real z[] );
 
 static Real pressureAtSigmaLevel( Real sigmaLevel, Real pressureAtTop );
 
+static void cellElevationsAtSigmaPressures( GridPrivate* data,
+                                            Real surfaceElevation,
+                                            Real elevations[] );
+
+static const Real* tabulatedSigmaElevations( GridPrivate* data,
+                                             Integer entry );
+
 static Real heightAtPressure( Real pressure );
 
 static void parseLambert( int argc, char* argv[],
@@ -268,9 +323,30 @@ static Real* parseLayers( int argc, char* argv[], Integer* argument,
                           Real* g, Real* R, Real* A, Real* T0s, Real* P00,
                           Integer* layers, Integer* type, Real* topPressure );
 
+static void projectPoints( const Projector* projector,
+                           Real (*latitudeAdjuster)( Real ),
+                           Integer count,
+                           const Real longitudes[], const Real latitudes[],
+                           Real x[], Real y[] );
+
 static void initializeCells(Integer count, Real minimumValidValue, Cell* cell);
 
-static void finalizeCells( Integer count, Cell cells[] );
+static Integer locatePoint( const GridPrivate* data, Real x, Real y,
+                            Integer* column, Integer* row,
+                            Real* xCenterOffset, Real* yCenterOffset );
+
+static void binPoints( const GridPrivate* data, Integer points,
+                       const Real longitudes[], const Real latitudes[],
+                       Integer pointCells[], Real pointOffsets[],
+                       Integer pointOrder[], Integer cellStarts[] );
+
+static void regridPoint( Grid* self,
+                         PreAggregator preAggregator, Aggregator aggregator,
+                         Integer column, Integer row,
+                         Real xCenterOffset, Real yCenterOffset,
+                         Integer point, Integer levels,
+                         const Real inputData[], const Real inputData2[],
+                         const Real elevations[], const Note notes[] );
 
 static void zeroUnused( Integer index, Integer count,
                         Integer columns[], Integer rows[],
@@ -450,7 +526,11 @@ Grid* newGrid( Projector* projector,
     data->longitudes    = longitudes;
     data->latitudes     = latitudes;
     longitudes = latitudes = 0; /* Transfered ownership. */
-    computeLongitudesAndLatitudes( data );
+
+    if ( ! readGridCellCache( data ) ) {
+      computeLongitudesAndLatitudes( data );
+      writeGridCellCache( data );
+    }
 
     /* Initialize input 3D grid attributes: */
 
@@ -607,7 +687,7 @@ static void projectXY( Grid* self, Integer count,
   const Real* const gridCellCenterLatitudes  = data->latitudes;
   Projector* const projector = data->projector;
   Real (*latitudeAdjuster)( Real ) = 0;
-  Integer index = 0;
+  Integer first = 0;
   Integer griddedPointCount = 0;
 
   /*
@@ -636,70 +716,75 @@ static void projectXY( Grid* self, Integer count,
     memset( gridLatitudes,  0, count * sizeof *gridLatitudes );
   }
 
-#pragma omp parallel for reduction( + : griddedPointCount )
+  /* Project blocks of points then locate each projected point on the grid:*/
 
-  for ( index = 0; index < count; ++index ) {
-    const Real longitude = longitudes[ index ];
-    const Real latitudeOnWGS84Spheroid = latitudes[ index ];
-    const Real latitude =
-      latitudeAdjuster ? latitudeAdjuster( latitudeOnWGS84Spheroid )
-      : latitudeOnWGS84Spheroid;
-    Real x = longitude;
-    Real y = latitude;
+#pragma omp parallel for reduction( + : griddedPointCount )
 
-    if ( projector ) {
-      projector->project( projector, longitude, latitude, &x, &y );
-    }
+  for ( first = 0; first < count; first += PROJECT_POINTS ) {
+    const Integer points = MIN( PROJECT_POINTS, count - first );
+    Real xs[ PROJECT_POINTS ];
+    Real ys[ PROJECT_POINTS ];
+    Integer point = 0;
+
+    projectPoints( projector, latitudeAdjuster, points,
+                   longitudes + first, latitudes + first, xs, ys );
+
+    for ( point = 0; point < points; ++point ) {
+      const Integer index = first + point;
+      const Real x = xs[ point ];
+      const Real y = ys[ point ];
+
+      DEBUG( fprintf( stderr, "(%lf %lf)->(%lf, %lf)\n",
+                      longitudes[ index ], latitudes[ index ], x, y ); )
+
+      if ( AND2( IN_RANGE( x, xMinimum, xMaximum ),
+                 IN_RANGE( y, yMinimum, yMaximum ) ) ) {
+        const Real fractionalColumn = (x - xMinimum) * oneOverWidth  + 1.0;
+        const Real fractionalRow    = (y - yMinimum) * oneOverHeight + 1.0;
+        Integer column     = fractionalColumn; /* Truncate fraction. */
+        Integer row        = fractionalRow;
+        Real xCenterOffset = fractionalColumn - column - 0.5;
+        Real yCenterOffset = fractionalRow    - row    - 0.5;
+        xCenterOffset += xCenterOffset;
+        yCenterOffset += yCenterOffset;
+
+        if ( column > gridColumns ) {
+          column = gridColumns;
+          xCenterOffset = 1.0;
+        }
 
-    DEBUG( fprintf( stderr, "(%lf %lf)->(%lf, %lf)\n",
-                    longitude, latitude, x, y ); )
-
-    if ( AND2( IN_RANGE( x, xMinimum, xMaximum ),
-               IN_RANGE( y, yMinimum, yMaximum ) ) ) {
-      const Real fractionalColumn = (x - xMinimum) * oneOverWidth  + 1.0;
-      const Real fractionalRow    = (y - yMinimum) * oneOverHeight + 1.0;
-      Integer column     = fractionalColumn; /* Truncate fraction. */
-      Integer row        = fractionalRow;
-      Real xCenterOffset = fractionalColumn - column - 0.5;
-      Real yCenterOffset = fractionalRow    - row    - 0.5;
-      xCenterOffset += xCenterOffset;
-      yCenterOffset += yCenterOffset;
-
-      if ( column > gridColumns ) {
-        column = gridColumns;
-        xCenterOffset = 1.0;
-      }
+        if ( row > gridRows ) {
+          row = gridRows;
+          yCenterOffset = 1.0;
+        }
 
-      if ( row > gridRows ) {
-        row = gridRows;
-        yCenterOffset = 1.0;
-      }
+        CHECK4( IN_RANGE( column, 1, data->columns ),
+                IN_RANGE( row,    1, data->rows ),
+                IN_RANGE( xCenterOffset, -1.0, 1.0 ),
+                IN_RANGE( yCenterOffset, -1.0, 1.0 ) );
+        DEBUG( fprintf( stderr, "  %lf %lf\n",
+                        fractionalColumn, fractionalRow ); )
+        DEBUG( fprintf( stderr, "  %"INTEGER_FORMAT" %"INTEGER_FORMAT
+                        " %25.16lf %25.16lf\n",
+                column, row, xCenterOffset, yCenterOffset ); )
+
+        columns[ index ]        = column;
+        rows[ index ]           = row;
+        xCenterOffsets[ index ] = xCenterOffset;
+        yCenterOffsets[ index ] = yCenterOffset;
+
+        if ( gridLongitudes ) { /* Store unprojected grid cell center: */
+          const Integer offset = ( row - 1 ) * gridColumns + ( column - 1 );
+          CHECK( IN_RANGE( offset, 0, data->rows * data->columns - 1 ) );
+          gridLongitudes[ index ] = gridCellCenterLongitudes[ offset ];
+          gridLatitudes[  index ] = gridCellCenterLatitudes[  offset ];
+
+          DEBUG( fprintf( stderr, " @ (%lf %lf)\n",
+                          gridLongitudes[ index ], gridLatitudes[ index ] ); )
+        }
 
-      CHECK4( IN_RANGE( column, 1, data->columns ),
-              IN_RANGE( row,    1, data->rows ),
-              IN_RANGE( xCenterOffset, -1.0, 1.0 ),
-              IN_RANGE( yCenterOffset, -1.0, 1.0 ) );
-      DEBUG( fprintf(stderr, "  %lf %lf\n", fractionalColumn, fractionalRow);)
-      DEBUG( fprintf( stderr, "  %"INTEGER_FORMAT" %"INTEGER_FORMAT
-                      " %25.16lf %25.16lf\n",
-              column, row, xCenterOffset, yCenterOffset ); )
-
-      columns[ index ]        = column;
-      rows[ index ]           = row;
-      xCenterOffsets[ index ] = xCenterOffset;
-      yCenterOffsets[ index ] = yCenterOffset;
-
-      if ( gridLongitudes ) { /* Store unprojected grid cell center: */
-        const Integer offset = ( row - 1 ) * gridColumns + ( column - 1 );
-        CHECK( IN_RANGE( offset, 0, data->rows * data->columns - 1 ) );
-        gridLongitudes[ index ] = gridCellCenterLongitudes[ offset ];
-        gridLatitudes[  index ] = gridCellCenterLatitudes[  offset ];
-
-        DEBUG( fprintf( stderr, " @ (%lf %lf)\n",
-                        gridLongitudes[ index ], gridLatitudes[ index ] ); )
+        ++griddedPointCount;
       }
-
-      ++griddedPointCount;
     }
   }
 
@@ -1126,28 +1211,22 @@ static void regrid( Grid* self,
   PostAggregator  postAggregator  = aggregatorEntry.postAggregator;
   const GridPrivate* const data = self->data;
   Projector* const projector = data->projector;
-  const Real xMinimum        = data->xMinimum;
-  const Real xMaximum        = data->xMaximum;
-  const Real yMinimum        = data->yMinimum;
-  const Real yMaximum        = data->yMaximum;
-  const Real oneOverWidth    = data->oneOverWidth;
-  const Real oneOverHeight   = data->oneOverHeight;
   const Integer gridColumns  = data->columns;
   const Integer gridRows     = data->rows;
   const Integer gridLayers   = elevations ? data->layers : 1;
   const Integer gridRowsTimesGridColumns = gridRows * gridColumns;
-  const Integer gridColumnsTimesGridLayers = gridColumns * gridLayers;
   Cell* const gridCells = data->cells;
-  const Real* const gridCellCenterLongitudes = data->longitudes;
-  const Real* const gridCellCenterLatitudes  = data->latitudes;
-  Integer index = 0;
+  Integer* pointCells = 0;
+  Real* pointOffsets = 0;
+  Integer first = 0;
   Integer gridCell = 0;
   Integer outputPoints = 0;
 
   DEBUG( fprintf( stderr, "regrid(): levels = %lld elevation = %lf, "
                   "gridLayers = %lld, [%f %f][%f %f]\n",
                   levels, elevations ? elevations[ 0 ] : 0.0, gridLayers,
-                 xMinimum, xMaximum, yMinimum, yMaximum ); )
+                  data->xMinimum, data->xMaximum,
+                  data->yMinimum, data->yMaximum ); )
 
   *regriddedPoints = 0;
 
@@ -1156,77 +1235,75 @@ static void regrid( Grid* self,
 
   DEBUG( fprintf( stderr, "  loop on %lld points\n", points ); )
 
-/* #pragma omp parallel for */
+  /*
+   * With multiple OpenMP threads, surface points are binned by grid cell so
+   * that each cell is aggregated by a single thread, in input point order,
+   * without locking. Binning uses 4 words per point so otherwise (e.g.,
+   * when compiled with -DSERIAL_REGRID as in makeit) points are aggregated
+   * serially in input point order as before. Points with elevations are
+   * always aggregated serially since aggregateCellData() reuses the cell
+   * elevations computed for the previous point.
+   */
 
-  for ( index = 0; index < points; ++index ) {
-    const Real longitude = longitudes[ index ];
-    const Real latitude  = latitudes[ index ];
-    Real x = longitude;
-    Real y = latitude;
+  if ( AND2( ! elevations, omp_get_max_threads() > 1 ) ) {
+    pointCells =
+      NEW_ZERO( Integer, points + points + gridRowsTimesGridColumns + 1 );
+    pointOffsets = pointCells ? NEW_ZERO( Real, points + points ) : 0;
+  }
 
-    if ( projector ) {
-      projector->project( projector, longitude, latitude, &x, &y );
-    }
+  if ( pointOffsets ) {
+    Integer* const pointOrder = pointCells + points;
+    Integer* const cellStarts   = pointOrder + points;
 
-    DEBUG( fprintf( stderr, "(%lf %lf)->(%lf, %lf)\n",
-                    longitude, latitude, x, y ); )
-
-    if ( AND2( IN_RANGE( x, xMinimum, xMaximum ),
-               IN_RANGE( y, yMinimum, yMaximum ) ) ) {
-      const Real fractionalColumn = ( x - xMinimum ) * oneOverWidth  + 1.0;
-      const Real fractionalRow    = ( y - yMinimum ) * oneOverHeight + 1.0;
-      Integer column     = fractionalColumn; /* Truncate fraction. */
-      Integer row        = fractionalRow;
-      Real xCenterOffset = fractionalColumn - column - 0.5;
-      Real yCenterOffset = fractionalRow    - row    - 0.5;
-      xCenterOffset += xCenterOffset;
-      yCenterOffset += yCenterOffset;
-
-      if ( column > gridColumns ) {
-        column = gridColumns;
-        xCenterOffset = 1.0;
-      }
+    binPoints( data, points, longitudes, latitudes,
+               pointCells, pointOffsets, pointOrder, cellStarts );
+
+#pragma omp parallel for schedule( dynamic, 64 )
 
-      if ( row > gridRows ) {
-        row = gridRows;
-        yCenterOffset = 1.0;
+    for ( gridCell = 0; gridCell < gridRowsTimesGridColumns; ++gridCell ) {
+      const Integer row    = gridCell / gridColumns + 1;
+      const Integer column = gridCell % gridColumns + 1;
+      const Integer end    = cellStarts[ gridCell + 1 ];
+      Integer order = cellStarts[ gridCell ];
+
+      for ( ; order < end; ++order ) {
+        const Integer point = pointOrder[ order ];
+        regridPoint( self, preAggregator, aggregator, column, row,
+                     pointOffsets[ point + point ],
+                     pointOffsets[ point + point + 1 ],
+                     point, levels, inputData, inputData2, 0, notes );
       }
+    }
+  } else {
 
-      CHECK4( IN_RANGE( column, 1, data->columns ),
-              IN_RANGE( row,    1, data->rows ),
-              IN_RANGE( xCenterOffset, -1.0, 1.0 ),
-              IN_RANGE( yCenterOffset, -1.0, 1.0 ) );
-      DEBUG( fprintf(stderr, "  %lf %lf\n", fractionalColumn, fractionalRow);)
-      DEBUG( fprintf( stderr, "  %"INTEGER_FORMAT" %"INTEGER_FORMAT
-                      " %25.16lf %25.16lf\n",
-                      column, row, xCenterOffset, yCenterOffset ); )
-
-      {
-        const Integer row1    = row    - 1;
-        const Integer column1 = column - 1;
-        const Integer offset2 = row1 * gridColumns + column1;
-        const Integer offset3 =
-          row1 * gridColumnsTimesGridLayers + column1 * gridLayers;
-        const Real gridLongitude = gridCellCenterLongitudes[ offset2 ];
-        const Real gridLatitude  = gridCellCenterLatitudes[  offset2 ];
-        Cell* const cells = gridCells + offset3;
-        CHECK( IN_RANGE( offset2, 0, data->rows * data->columns - 1 ) );
-        CHECK( IN_RANGE( offset3, 0,
-                         data->rows * data->columns * data->layers - 1 ) );
-        lockCell( cells );
-        CHECK( IMPLIES_ELSE( cells[ 0 ].count > 0,
-                             GT_ZERO2( cells[ 0 ].column, cells[ 0 ].row ),
-                             IS_ZERO2( cells[ 0 ].column, cells[ 0 ].row ) ) );
-
-        aggregateCellData( self, preAggregator, aggregator,
-                           column, row, gridLongitude, gridLatitude,
-                           xCenterOffset, yCenterOffset,
-                           index, inputData, inputData2, levels, elevations,
-                           notes ? notes[ index ] : 0, cells );
-        unlockCell( cells );
+    for ( first = 0; first < points; first += PROJECT_POINTS ) {
+      const Integer count = MIN( PROJECT_POINTS, points - first );
+      Real xs[ PROJECT_POINTS ];
+      Real ys[ PROJECT_POINTS ];
+      Integer point = 0;
+
+      projectPoints( projector, 0, count,
+                     longitudes + first, latitudes + first, xs, ys );
+
+      for ( point = 0; point < count; ++point ) {
+        Integer column = 0;
+        Integer row    = 0;
+        Real xCenterOffset = 0.0;
+        Real yCenterOffset = 0.0;
+
+        if ( locatePoint( data, xs[ point ], ys[ point ], &column, &row,
+                          &xCenterOffset, &yCenterOffset ) ) {
+          regridPoint( self, preAggregator, aggregator, column, row,
+                       xCenterOffset, yCenterOffset,
+                       first + point, levels, inputData, inputData2,
+                       elevations, notes );
+        }
       }
     }
-  } /* End loop on input points. */
+  } /* End if binned input points. */
+
+  FREE( pointCells );
+  FREE( pointOffsets );
 
   DEBUG( fprintf( stderr, "  loop on %lld 2D grid cells\n",
                   gridRowsTimesGridColumns ); )
@@ -1316,7 +1393,6 @@ static void regrid( Grid* self,
     } /* End if aggregated cell. */
   } /* End loop on grid cells. */
 
-  finalizeCells( gridRows * gridColumns * gridLayers, gridCells );
   *regriddedPoints = outputPoints;
 
   DEBUG( fprintf( stderr, "Regridded to %lld points.\n", *regriddedPoints ); )
@@ -1560,6 +1636,7 @@ static void free__( Grid* self ) {
     FREE_ZERO( self->data->longitudes );
     FREE_ZERO( self->data->z );
     FREE_ZERO( self->data->cells );
+    FREE_ZERO( self->data->sigmaElevations );
     FREE_ZERO( self->data );
   }
 
@@ -2481,6 +2558,118 @@ static void computeLongitudesAndLatitudes( GridPrivate* data ) {
 
 
 
+/******************************************************************************
+PURPOSE: gridCellCacheKey - Cache key for grid cell centers.
+INPUTS:  const GridPrivate* data  Projector and grid parameters.
+OUTPUTS: GridCellCacheKey* key    Key of cached grid cell centers.
+RETURNS: Integer 1 if the grid is projected, else 0.
+NOTES:   Unprojected (lon-lat) grids are cheap to compute so are not cached.
+******************************************************************************/
+
+static Integer gridCellCacheKey( const GridPrivate* data,
+                                 GridCellCacheKey* key ) {
+
+  PRE02( data, key );
+
+  const Projector* const projector = data->projector;
+  const Integer result = projector != 0;
+  memset( key, 0, sizeof *key );
+
+  if ( projector ) {
+    const char* const name = projector->name( projector );
+    strncpy( key->tag, GRID_CELL_CACHE_TAG, sizeof key->tag - 1 );
+    strncpy( key->kind, "centers", sizeof key->kind - 1 );
+    strncpy( key->projection, name, sizeof key->projection - 1 );
+    projector->ellipsoid( projector,
+                          &key->majorSemiaxis, &key->minorSemiaxis );
+
+    if ( ! strcmp( name, "Lambert" ) ) {
+      const Lambert* const lambert = (const Lambert*) projector;
+      key->lowerLatitude = lambert->lowerLatitude( lambert );
+      key->upperLatitude = lambert->upperLatitude( lambert );
+    } else if ( ! strcmp( name, "Stereographic" ) ) {
+      const Stereographic* const stereographic =
+        (const Stereographic*) projector;
+      key->lowerLatitude = stereographic->secantLatitude( stereographic );
+    }
+
+    key->centralLongitude = projector->centralLongitude( projector );
+    key->centralLatitude  = projector->centralLatitude( projector );
+    key->falseEasting     = projector->falseEasting( projector );
+    key->falseNorthing    = projector->falseNorthing( projector );
+    key->xOrigin          = data->xMinimum;
+    key->yOrigin          = data->yMinimum;
+    key->xCell            = data->cellWidth;
+    key->yCell            = data->cellHeight;
+    key->columns          = data->columns;
+    key->rows             = data->rows;
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: readGridCellCache - Read cached grid cell center lon-lats, if present.
+INPUTS:  GridPrivate* data  Projector and grid parameters.
+OUTPUTS: GridPrivate* data  data->longitudes, data->latitudes.
+RETURNS: Integer 1 if read, else 0 if there is no valid cache.
+******************************************************************************/
+
+static Integer readGridCellCache( GridPrivate* data ) {
+
+  PRE03( data, data->longitudes, data->latitudes );
+
+  Integer result = 0;
+  GridCellCacheKey key;
+
+  if ( gridCellCacheKey( data, &key ) ) {
+    const Integer count = data->columns * data->rows;
+    size_t size = 0;
+    Real* coordinates =
+      readCache( GRID_CELL_CACHE_KIND, &key, sizeof key, &size );
+    result = AND2( coordinates, size == 2 * count * sizeof (Real) );
+
+    if ( result ) {
+      memcpy( data->longitudes, coordinates, count * sizeof (Real) );
+      memcpy( data->latitudes, coordinates + count, count * sizeof (Real) );
+      result =
+        validLongitudesAndLatitudes( count, data->longitudes, data->latitudes);
+    }
+
+    free( coordinates ), coordinates = 0;
+  }
+
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeGridCellCache - Write grid cell center lon-lats to the cache.
+INPUTS:  const GridPrivate* data  Projector, grid parameters, data->longitudes,
+                                  data->latitudes.
+******************************************************************************/
+
+static void writeGridCellCache( const GridPrivate* data ) {
+
+  PRE03( data, data->longitudes, data->latitudes );
+
+  GridCellCacheKey key;
+
+  if ( gridCellCacheKey( data, &key ) ) {
+    const size_t bytes = data->columns * data->rows * sizeof (Real);
+    const void* const payloads[ 2 ] = { data->longitudes, data->latitudes };
+    const size_t sizes[ 2 ] = { bytes, bytes };
+    writeCache( GRID_CELL_CACHE_KIND, &key, sizeof key, 2, payloads, sizes );
+  }
+}
+
+
+
 /******************************************************************************
 PURPOSE: computeZ - Compute elevation in meters above mean sea level from
          CMAQ/IOAPI vertical grid parameters.
@@ -2593,6 +2782,111 @@ static Real pressureAtSigmaLevel( Real sigmaLevel, Real pressureAtTop ) {
 
 
 
+/******************************************************************************
+PURPOSE: cellElevationsAtSigmaPressures - Compute elevations in meters above
+         mean sea-level of the grid's sigma-pressure levels over a surface.
+INPUTS:  GridPrivate* data      Grid with sigma-pressure vertical parameters.
+         Real surfaceElevation  Elevation of surface in meters AMSL.
+OUTPUTS: GridPrivate* data      data->sigmaElevations updated.
+         Real elevations[ data->layers + 1 ]  Elevation in meters above MSL.
+NOTES:   Interpolates between the two nearest tabulated surface elevations
+         (exact if surfaceElevation is a whole number of meters) or calls
+         elevationsAtSigmaPressures() if outside the table.
+         Not thread-safe since it fills data->sigmaElevations on demand.
+******************************************************************************/
+
+static void cellElevationsAtSigmaPressures( GridPrivate* data,
+                                            Real surfaceElevation,
+                                            Real elevations[] ) {
+
+  PRE05( data, data->layers > 0, ! isNan( surfaceElevation ),
+         surfaceElevation > -1000.0, elevations );
+
+  const Integer levels = data->layers + 1;
+  const Real* lower = 0;
+  const Real* upper = 0;
+  Real fraction = 0.0;
+
+  if ( IN_RANGE( surfaceElevation,
+                 SIGMA_ELEVATION_MINIMUM, SIGMA_ELEVATION_MAXIMUM ) ) {
+    const Real entries =
+      ( surfaceElevation - SIGMA_ELEVATION_MINIMUM ) / SIGMA_ELEVATION_STEP;
+    const Integer entry = entries; /* Truncate fraction. */
+    fraction = entries - entry;
+    lower = tabulatedSigmaElevations( data, entry );
+    upper = AND2( lower, fraction > 0.0 ) ?
+      tabulatedSigmaElevations( data, entry + 1 ) : lower;
+  }
+
+  if ( upper ) {
+    Integer level = 0;
+
+    for ( level = 0; level < levels; ++level ) {
+      elevations[ level ] =
+        lower[ level ] + fraction * ( upper[ level ] - lower[ level ] );
+    }
+  } else {
+    elevationsAtSigmaPressures( data->g, data->R, data->A, data->T0s,
+                                data->P00, surfaceElevation, levels,
+                                data->topPressure, data->levels, elevations );
+  }
+
+  POST02( isNanFree( elevations, levels ),
+          increasing( elevations, levels ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: tabulatedSigmaElevations - Elevations of the grid's sigma-pressure
+         levels over a tabulated surface elevation, computing them if needed.
+INPUTS:  GridPrivate* data  Grid with sigma-pressure vertical parameters.
+         Integer entry      0-based index of surface elevation
+                            SIGMA_ELEVATION_MINIMUM +
+                            entry * SIGMA_ELEVATION_STEP.
+OUTPUTS: GridPrivate* data  data->sigmaElevations allocated/updated.
+RETURNS: const Real* elevations[ data->layers + 1 ] or 0 if unallocated.
+NOTES:   Each table row starts with 1.0 once its elevations are computed.
+******************************************************************************/
+
+static const Real* tabulatedSigmaElevations( GridPrivate* data,
+                                             Integer entry ) {
+
+  const Integer entries = 1 +
+    (Integer) ( ( SIGMA_ELEVATION_MAXIMUM - SIGMA_ELEVATION_MINIMUM ) /
+                SIGMA_ELEVATION_STEP );
+
+  PRE03( data, data->layers > 0, IN_RANGE( entry, 0, entries - 1 ) );
+
+  const Integer levels = data->layers + 1;
+  const Integer rowSize = 1 + levels;
+  Real* row = 0;
+
+  if ( ! data->sigmaElevations ) {
+    data->sigmaElevations = NEW_ZERO( Real, entries * rowSize );
+  }
+
+  if ( data->sigmaElevations ) {
+    row = data->sigmaElevations + entry * rowSize;
+
+    if ( row[ 0 ] == 0.0 ) {
+      const Real surfaceElevation =
+        SIGMA_ELEVATION_MINIMUM + entry * SIGMA_ELEVATION_STEP;
+      elevationsAtSigmaPressures( data->g, data->R, data->A, data->T0s,
+                                  data->P00, surfaceElevation, levels,
+                                  data->topPressure, data->levels, row + 1 );
+      row[ 0 ] = 1.0;
+    }
+
+    ++row;
+  }
+
+  POST0( IMPLIES( row, isNanFree( row, levels ) ) );
+  return row;
+}
+
+
+
 /******************************************************************************
 PURPOSE: heightAtPressure - Compute the height (in meters) at a given
          pressure (in millibars).
@@ -3031,6 +3325,46 @@ static Real* parseLayers( int argc, char* argv[], Integer* argument,
 
 
 
+/******************************************************************************
+PURPOSE: projectPoints - Project a block of longitude-latitude points.
+INPUTS:  const Projector* projector       Projector or 0 if lon-lat grid.
+         Real (*latitudeAdjuster)( Real ) 0 or latitudeSphere().
+         Integer count                    Number of points to project.
+         const Real longitudes[ count ]   Longitudes to project.
+         const Real latitudes[  count ]   Latitudes  to project.
+OUTPUTS: Real x[ count ]                  Projected (or adjusted) longitudes.
+         Real y[ count ]                  Projected (or adjusted) latitudes.
+******************************************************************************/
+
+static void projectPoints( const Projector* projector,
+                           Real (*latitudeAdjuster)( Real ),
+                           Integer count,
+                           const Real longitudes[], const Real latitudes[],
+                           Real x[], Real y[] ) {
+
+  PRE06( IMPLIES( projector, projector->invariant( projector ) ),
+         IN_RANGE( count, 1, PROJECT_POINTS ),
+         validLongitudesAndLatitudes( count, longitudes, latitudes ),
+         x, y, x != y );
+
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    x[ index ] = longitudes[ index ];
+    y[ index ] =
+      latitudeAdjuster ? latitudeAdjuster( latitudes[ index ] )
+      : latitudes[ index ];
+  }
+
+  if ( projector ) {
+    projector->projectArray( projector, count, x, y, x, y );
+  }
+
+  POST02( isNanFree( x, count ), isNanFree( y, count ) );
+}
+
+
+
 /******************************************************************************
 PURPOSE: initializeCells - Zero-out and reinitialize array of cells.
 INPUTS:  Integer count           Number of cells.
@@ -3049,9 +3383,7 @@ static void initializeCells( Integer count, Real minimumValidValue,
 #pragma omp parallel for
 
   for ( index = 0; index < count; ++index ) {
-    Cell* cell = cells + index;
-    cell->minimumValidValue = minimumValidValue;
-    omp_init_lock( &cell->lock );
+    cells[ index ].minimumValidValue = minimumValidValue;
   }
 
   POST02( IS_ZERO3( cells[ 0 ].column, cells[ 0 ].row, cells[ 0 ].count ),
@@ -3061,29 +3393,218 @@ static void initializeCells( Integer count, Real minimumValidValue,
 
 
 /******************************************************************************
-PURPOSE: finalizeCells - Finalize array of cells.
-INPUTS:  Integer count           Number of cells.
-OUTPUTS: Cell cells[]            The zeroed/initialized cells.
+PURPOSE: locatePoint - Locate a projected point on the grid.
+INPUTS:  const GridPrivate* data  Grid parameters.
+         Real x                   Projected x-coordinate of point.
+         Real y                   Projected y-coordinate of point.
+OUTPUTS: Integer* column          1-based grid column of point.
+         Integer* row             1-based grid row    of point.
+         Real* xCenterOffset      [-1, 1] x-offset from center of grid cell.
+         Real* yCenterOffset      [-1, 1] y-offset from center of grid cell.
+RETURNS: Integer 1 if the point is within the grid, else 0 and outputs are
+         unchanged.
 ******************************************************************************/
 
-static void finalizeCells( Integer count, Cell cells[] ) {
+static Integer locatePoint( const GridPrivate* data, Real x, Real y,
+                            Integer* column, Integer* row,
+                            Real* xCenterOffset, Real* yCenterOffset ) {
+
+  PRE07( data, ! isNan( x ), ! isNan( y ),
+         column, row, xCenterOffset, yCenterOffset );
+
+  const Integer result =
+    AND2( IN_RANGE( x, data->xMinimum, data->xMaximum ),
+          IN_RANGE( y, data->yMinimum, data->yMaximum ) );
+
+  if ( result ) {
+    const Real fractionalColumn =
+      ( x - data->xMinimum ) * data->oneOverWidth  + 1.0;
+    const Real fractionalRow    =
+      ( y - data->yMinimum ) * data->oneOverHeight + 1.0;
+    *column        = fractionalColumn; /* Truncate fraction. */
+    *row           = fractionalRow;
+    *xCenterOffset = fractionalColumn - *column - 0.5;
+    *yCenterOffset = fractionalRow    - *row    - 0.5;
+    *xCenterOffset += *xCenterOffset;
+    *yCenterOffset += *yCenterOffset;
+
+    if ( *column > data->columns ) {
+      *column = data->columns;
+      *xCenterOffset = 1.0;
+    }
+
+    if ( *row > data->rows ) {
+      *row = data->rows;
+      *yCenterOffset = 1.0;
+    }
+
+    DEBUG( fprintf( stderr, "  %lf %lf\n", fractionalColumn, fractionalRow);)
+    DEBUG( fprintf( stderr, "  %"INTEGER_FORMAT" %"INTEGER_FORMAT
+                    " %25.16lf %25.16lf\n",
+                    *column, *row, *xCenterOffset, *yCenterOffset ); )
+  }
+
+  POST02( IS_BOOL( result ),
+          IMPLIES( result,
+                   AND4( IN_RANGE( *column, 1, data->columns ),
+                         IN_RANGE( *row,    1, data->rows ),
+                         IN_RANGE( *xCenterOffset, -1.0, 1.0 ),
+                         IN_RANGE( *yCenterOffset, -1.0, 1.0 ) ) ) );
+  return result;
+}
 
-  PRE02( count > 0, cells );
-  Integer index = 0;
 
 
+/******************************************************************************
+PURPOSE: binPoints - Project points and sort them by grid cell.
+INPUTS:  const GridPrivate* data             Grid to bin points onto.
+         Integer points                      Number of points.
+         const Real longitudes[ points ]     Longitudes of points.
+         const Real latitudes[  points ]     Latitudes  of points.
+OUTPUTS: Integer pointCells[ points ]        1 + 0-based 2D grid cell index
+                                             of each point or 0 if outside.
+         Real pointOffsets[ points * 2 ]     [-1, 1] x, y offsets from
+                                             center of grid cell.
+         Integer pointOrder[ points ]        Point indices sorted by cell.
+         Integer cellStarts[ rows * columns + 1 ]  Index into pointOrder[] of
+                                             first point of each grid cell.
+NOTES:   The sort is stable so each cell's points are in input point order
+         and aggregating them yields the same results as aggregating all
+         points in input order.
+******************************************************************************/
+
+static void binPoints( const GridPrivate* data, Integer points,
+                       const Real longitudes[], const Real latitudes[],
+                       Integer pointCells[], Real pointOffsets[],
+                       Integer pointOrder[], Integer cellStarts[] ) {
+
+  PRE08( data, points > 0, longitudes, latitudes,
+         pointCells, pointOffsets, pointOrder, cellStarts );
+
+  const Integer gridColumns = data->columns;
+  const Integer cells = data->rows * gridColumns;
+  Integer first = 0;
+  Integer point = 0;
+  Integer cell = 0;
+
+  memset( cellStarts, 0, ( cells + 1 ) * sizeof *cellStarts );
+
+  /* Project blocks of points then locate each projected point on the grid:*/
+
 #pragma omp parallel for
 
-  for ( index = 0; index < count; ++index ) {
-#if defined( _OPENMP ) && ! defined( SERIAL_REGRID )
-    Cell* cell = cells + index;
-#endif
-    omp_destroy_lock( &cell->lock );
+  for ( first = 0; first < points; first += PROJECT_POINTS ) {
+    const Integer count = MIN( PROJECT_POINTS, points - first );
+    Real xs[ PROJECT_POINTS ];
+    Real ys[ PROJECT_POINTS ];
+    Integer block = 0;
+
+    projectPoints( data->projector, 0, count,
+                   longitudes + first, latitudes + first, xs, ys );
+
+    for ( block = 0; block < count; ++block ) {
+      const Integer index = first + block;
+      Integer column = 0;
+      Integer row    = 0;
+      pointCells[ index ] = 0;
+
+      if ( locatePoint( data, xs[ block ], ys[ block ], &column, &row,
+                        pointOffsets + index + index,
+                        pointOffsets + index + index + 1 ) ) {
+        pointCells[ index ] = ( row - 1 ) * gridColumns + column;
+      }
+    }
   }
 
-  memset( cells, 0, count * sizeof (Cell) );
+  /* Counting sort of point indices by grid cell: */
+
+  for ( point = 0; point < points; ++point ) {
+    ++cellStarts[ pointCells[ point ] ];
+  }
+
+  cellStarts[ 0 ] = 0; /* Skip points outside the grid. */
+
+  for ( cell = 1; cell <= cells; ++cell ) {
+    cellStarts[ cell ] += cellStarts[ cell - 1 ];
+  }
+
+  for ( point = 0; point < points; ++point ) {
+    const Integer pointCell = pointCells[ point ];
+
+    if ( pointCell ) {
+      pointOrder[ cellStarts[ pointCell - 1 ]++ ] = point;
+    }
+  }
+
+  /* Shift starts back since each was advanced to the next cell's start: */
+
+  for ( cell = cells; cell > 0; --cell ) {
+    cellStarts[ cell ] = cellStarts[ cell - 1 ];
+  }
+
+  cellStarts[ 0 ] = 0;
+
+  POST02( cellStarts[ 0 ] == 0,
+          IN_RANGE( cellStarts[ cells ], 0, points ) );
+}
 
-  POST0( IS_ZERO3( cells[ 0 ].column, cells[ 0 ].row, cells[ 0 ].count ) );
+
+
+/******************************************************************************
+PURPOSE: regridPoint - Aggregate a located point into its grid cell(s).
+INPUTS:  Grid* self                     Grid to aggregate onto.
+         PreAggregator preAggregator    Called for first point of a cell.
+         Aggregator aggregator          Called for other points of a cell.
+         Integer column                 1-based grid column of point.
+         Integer row                    1-based grid row    of point.
+         Real xCenterOffset             [-1, 1] x-offset from cell center.
+         Real yCenterOffset             [-1, 1] y-offset from cell center.
+         Integer point                  0-based index of point.
+         Integer levels                 Number of vertical data points.
+         const Real inputData[ points * levels ]   Input data to regrid.
+         const Real inputData2[ points * levels ]  0 or vector 2nd component.
+         const Real elevations[ points * levels ]  Optional: m above MSL.
+         const Note notes[ points * levels ]       Optional: notes.
+NOTES:   Updates the cells of grid column, row only so calls for points in
+         different grid columns/rows may run concurrently.
+******************************************************************************/
+
+static void regridPoint( Grid* self,
+                         PreAggregator preAggregator, Aggregator aggregator,
+                         Integer column, Integer row,
+                         Real xCenterOffset, Real yCenterOffset,
+                         Integer point, Integer levels,
+                         const Real inputData[], const Real inputData2[],
+                         const Real elevations[], const Note notes[] ) {
+
+  PRE09( self, preAggregator, aggregator,
+         IN_RANGE( column, 1, self->columns( self ) ),
+         IN_RANGE( row,    1, self->rows( self ) ),
+         IN_RANGE( xCenterOffset, -1.0, 1.0 ),
+         IN_RANGE( yCenterOffset, -1.0, 1.0 ),
+         point >= 0,
+         inputData );
+
+  const GridPrivate* const data = self->data;
+  const Integer gridColumns = data->columns;
+  const Integer gridLayers  = elevations ? data->layers : 1;
+  const Integer row1        = row    - 1;
+  const Integer column1     = column - 1;
+  const Integer offset2     = row1 * gridColumns + column1;
+  const Integer offset3     = offset2 * gridLayers;
+  const Real gridLongitude  = data->longitudes[ offset2 ];
+  const Real gridLatitude   = data->latitudes[  offset2 ];
+  Cell* const cells = data->cells + offset3;
+  CHECK( IN_RANGE( offset3, 0, data->rows * data->columns * data->layers - 1));
+  CHECK( IMPLIES_ELSE( cells[ 0 ].count > 0,
+                       GT_ZERO2( cells[ 0 ].column, cells[ 0 ].row ),
+                       IS_ZERO2( cells[ 0 ].column, cells[ 0 ].row ) ) );
+
+  aggregateCellData( self, preAggregator, aggregator,
+                     column, row, gridLongitude, gridLatitude,
+                     xCenterOffset, yCenterOffset,
+                     point, inputData, inputData2, levels, elevations,
+                     notes ? notes[ point ] : 0, cells );
 }
 
 
@@ -3506,7 +4027,7 @@ static void aggregateCellData( Grid* self,
          IMPLIES( elevations, isNanFree( elevations, levels ) ),
          cells );
 
-  const GridPrivate* const selfData = self->data;
+  GridPrivate* const selfData = self->data;
   const Real minimumValidValue = cells[ 0 ].minimumValidValue;
 
   if ( ! elevations ) {
@@ -3544,7 +4065,6 @@ static void aggregateCellData( Grid* self,
     const Integer gridLevels          = gridLayers + 1;
     const Integer thread              = omp_get_thread_num();
     Real* const cellElevations        = selfData->z + thread * gridLevels;
-    const Real* const sigmaPressures  = selfData->levels;
     const Integer pointOffset         = point * levels;
     const Real* const pointElevations = elevations + pointOffset;
     const Real* const pointData       = data       + pointOffset;
@@ -3574,11 +4094,8 @@ static void aggregateCellData( Grid* self,
 
       if ( IN4( selfData->type, VGSGPH3, VGSGPN3, VGWRFEM ) ) {
         DEBUG( fprintf( stderr, "calling elevationAtSigmaPressues()...\n" ); )
-        elevationsAtSigmaPressures( selfData->g, selfData->R, selfData->A,
-                                    selfData->T0s, selfData->P00,
-                                    surfaceElevation, gridLevels,
-                                    selfData->topPressure,
-                                    sigmaPressures, cellElevations );
+        cellElevationsAtSigmaPressures( selfData, surfaceElevation,
+                                        cellElevations );
         DEBUG( fprintf( stderr, "selfData->g = %lf, selfData->R = %lf, "
                                 "selfData->A = %lf, selfData->T0s = %lf, "
                                 "selfData->P00 = %lf, "
@@ -3590,8 +4107,8 @@ static void aggregateCellData( Grid* self,
                                 selfData->T0s, selfData->P00,
                                 surfaceElevation, gridLevels,
                                 selfData->topPressure,
-                                sigmaPressures[ 0 ],
-                                sigmaPressures[ 1 ],
+                                selfData->levels[ 0 ],
+                                selfData->levels[ 1 ],
                                 cellElevations[ 0 ],
                                 cellElevations[ 1 ] ); )
       } else if ( selfData->type == VGZVAL3 ) {
@@ -48,6 +48,10 @@ static void setFalseNorthing( Lambert* self, Real falseNorthing );
 static void project( const Lambert* self, Real longitude, Real latitude,
                      Real* x, Real* y );
 
+static void projectArray( const Lambert* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] );
+
 static void unproject( const Lambert* self, Real x, Real y,
                        Real* longitude, Real* latitude );
 
@@ -273,6 +277,80 @@ static void project( const Lambert* self, Real longitude, Real latitude,
 
 
 
+/******************************************************************************
+PURPOSE: projectArray - Project an array of points.
+INPUTS:  const Lambert* self  Projector.
+         Integer count                  Number of points to project.
+         const Real longitudes[ count ] E.g., -78.7268.
+         const Real latitudes[  count ] E.g., 35.9611.
+OUTPUTS: Real x[ count ]                Projected longitudes.
+         Real y[ count ]                Projected latitudes.
+NOTES:   Same results as project() on each point, but with the projection terms
+         hoisted out of the loop and tsfn() reduced to tan() on a sphere.
+******************************************************************************/
+
+static void projectArray( const Lambert* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] ) {
+
+  PRE6( count > 0, longitudes, latitudes,
+        validLongitudesAndLatitudes( count, longitudes, latitudes ), x, y );
+
+  const LambertPrivate* const data = self->data;
+  const Real eccentricity  = data->eccentricity;
+  const Real lambda0       = data->lambda0;
+  const Real rho0          = data->rho0;
+  const Real n             = data->n;
+  const Real c             = data->c;
+  const Real majorSemiaxis = data->majorSemiaxis;
+  const Real falseEasting  = data->falseEasting;
+  const Real falseNorthing = data->falseNorthing;
+  const Real toRadians     = M_PI / 180.0; /* As in radians(). */
+  const Real nudge         = sqrt( PROJECTION_TOLERANCE );
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    Real lambda = longitudes[ index ] * toRadians;
+    Real phi    = latitudes[  index ] * toRadians;
+    Real lambdaDelta = 0.0;
+    Real nLambdaDelta = 0.0;
+    Real ts = 0.0;
+    Real rho = 0.0;
+
+    if ( ! IN_RANGE( phi, -PI_OVER_2 + PROJECTION_TOLERANCE,
+                           PI_OVER_2 - PROJECTION_TOLERANCE ) ) {
+      phi = phi + nudge * -SIGN( phi );
+    }
+
+    ts = eccentricity == 0.0 ? tan( ( PI_OVER_2 - phi ) * 0.5 )
+         : tsfn( phi, sin( phi ), eccentricity );
+    rho = c * pow( ts, n );
+
+    if ( ! IN_RANGE( lambda, -M_PI + PROJECTION_TOLERANCE,
+                              M_PI - PROJECTION_TOLERANCE ) ) {
+      lambda = lambda + nudge * -SIGN( lambda );
+    }
+
+    for ( lambdaDelta = lambda - lambda0; fabs( lambdaDelta ) > M_PI; ) {
+
+      if ( lambdaDelta < 0.0 ) {
+        lambdaDelta = lambdaDelta + M_PI + M_PI;
+      } else {
+        lambdaDelta = lambdaDelta - M_PI - M_PI;
+      }
+    }
+
+    nLambdaDelta = n * lambdaDelta;
+    x[ index ] = rho * sin( nLambdaDelta ) * majorSemiaxis + falseEasting;
+    y[ index ] = ( rho0 - rho * cos( nLambdaDelta ) ) * majorSemiaxis +
+                 falseNorthing;
+  }
+
+  POST2( isNanFree( x, count ), isNanFree( y, count ) );
+}
+
+
+
 /******************************************************************************
 PURPOSE: unproject - Unproject a point.
 INPUTS:  const Lambert* self    Projector.
@@ -591,6 +669,7 @@ static void assignMembers( Lambert* self ) {
   self->setFalseEasting  = setFalseEasting;
   self->setFalseNorthing = setFalseNorthing;
   self->project          = project;
+  self->projectArray     = projectArray;
   self->unproject        = unproject;
   self->invariant        = invariant;
   self->equal            = equal;
@@ -621,11 +700,12 @@ static Integer hasMembers( const Lambert* self ) {
   PRE0( self );
 
   const Integer result =
-    AND17( self->free             == free__,
+    AND18( self->free             == free__,
            self->setEllipsoid     == setEllipsoid,
            self->setFalseEasting  == setFalseEasting,
            self->setFalseNorthing == setFalseNorthing,
            self->project          == project,
+           self->projectArray     == projectArray,
            self->unproject        == unproject,
            self->invariant        == invariant,
            self->equal            == equal,
@@ -29,6 +29,10 @@ NOTES:   Commands:
            void project( const Lambert* self, Real longitude, Real latitude,
                          Real* x, Real* y );
 
+           void projectArray( const Lambert* self, Integer count,
+                              const Real longitudes[], const Real latitudes[],
+                              Real x[], Real y[] );
+
            void unproject( const Lambert* self, Real x, Real y,
                            Real* longitude, Real* latitude );
 
@@ -42,6 +42,10 @@ static void setFalseNorthing( Mercator* self, Real falseNorthing );
 static void project( const Mercator* self, Real longitude, Real latitude,
                      Real* x, Real* y );
 
+static void projectArray( const Mercator* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] );
+
 static void unproject( const Mercator* self, Real x, Real y,
                        Real* longitude, Real* latitude );
 
@@ -243,6 +247,68 @@ static void project( const Mercator* self, Real longitude, Real latitude,
 
 
 
+/******************************************************************************
+PURPOSE: projectArray - Project an array of points.
+INPUTS:  const Mercator* self  Projector.
+         Integer count                  Number of points to project.
+         const Real longitudes[ count ] E.g., -78.7268.
+         const Real latitudes[  count ] E.g., 35.9611.
+OUTPUTS: Real x[ count ]                Projected longitudes.
+         Real y[ count ]                Projected latitudes.
+NOTES:   Same results as project() on each point, but with the projection terms
+         hoisted out of the loop.
+******************************************************************************/
+
+static void projectArray( const Mercator* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] ) {
+
+  PRE6( count > 0, longitudes, latitudes,
+        validLongitudesAndLatitudes( count, longitudes, latitudes ), x, y );
+
+  const MercatorPrivate* const data = self->data;
+  const Real eccentricity  = data->eccentricity;
+  const Real lambda0       = data->lambda0;
+  const Real majorSemiaxis = data->majorSemiaxis;
+  const Real falseEasting  = data->falseEasting;
+  const Real falseNorthing = data->falseNorthing;
+  const Real toRadians     = M_PI / 180.0; /* As in radians(). */
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    Real lambda = longitudes[ index ] * toRadians;
+    Real phi    = latitudes[  index ] * toRadians;
+    Real lambdaDelta = 0.0;
+    Real yp = 0.0;
+
+    if ( ! IN_RANGE( phi, -PI_OVER_2 + TOLERANCE, PI_OVER_2 - TOLERANCE ) ) {
+      phi = phi + TOLERANCE * -SIGN( phi );
+    }
+
+    if ( ! IN_RANGE( lambda, -M_PI + TOLERANCE, M_PI - TOLERANCE ) ) {
+      lambda = lambda + TOLERANCE * -SIGN( lambda );
+    }
+
+    for ( lambdaDelta = lambda - lambda0; fabs( lambdaDelta ) > M_PI; ) {
+
+      if ( lambdaDelta < 0.0 ) {
+        lambdaDelta = lambdaDelta + M_PI + M_PI;
+      } else {
+        lambdaDelta = lambdaDelta - M_PI - M_PI;
+      }
+    }
+
+    yp = eccentricity == 0.0 ? log( tan( PI_OVER_4 + phi * 0.5 ) )
+         : -log( tsfn( phi, sin( phi ), eccentricity ) );
+    x[ index ] = lambdaDelta * majorSemiaxis + falseEasting;
+    y[ index ] = yp * majorSemiaxis + falseNorthing;
+  }
+
+  POST2( isNanFree( x, count ), isNanFree( y, count ) );
+}
+
+
+
 /******************************************************************************
 PURPOSE: unproject - Unproject a point.
 INPUTS:  const Mercator* self   Projector.
@@ -489,6 +555,7 @@ static void assignMembers( Mercator* self ) {
   self->setFalseEasting  = setFalseEasting;
   self->setFalseNorthing = setFalseNorthing;
   self->project          = project;
+  self->projectArray     = projectArray;
   self->unproject        = unproject;
   self->invariant        = invariant;
   self->equal            = equal;
@@ -516,11 +583,12 @@ static Integer hasMembers( const Mercator* self ) {
   PRE0( self );
 
   const Integer result =
-    AND15( self->free             == free__,
+    AND16( self->free             == free__,
            self->setEllipsoid     == setEllipsoid,
            self->setFalseEasting  == setFalseEasting,
            self->setFalseNorthing == setFalseNorthing,
            self->project          == project,
+           self->projectArray     == projectArray,
            self->unproject        == unproject,
            self->invariant        == invariant,
            self->equal            == equal,
@@ -27,6 +27,10 @@ NOTES:   Commands:
            void project( const Mercator* self, Real longitude, Real latitude,
                          Real* x, Real* y );
 
+           void projectArray( const Mercator* self, Integer count,
+                              const Real longitudes[], const Real latitudes[],
+                              Real x[], Real y[] );
+
            void unproject( const Mercator* self, Real x, Real y,
                            Real* longitude, Real* latitude );
 
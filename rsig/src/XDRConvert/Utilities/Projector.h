@@ -23,6 +23,10 @@ NOTES:   Commands:
            void project( const Projector* self, Real longitude, Real latitude,
                          Real* x, Real* y );
 
+           void projectArray( const Projector* self, Integer count,
+                              const Real longitudes[], const Real latitudes[],
+                              Real x[], Real y[] );
+
            void unproject( const Projector* self, Real x, Real y,
                            Real* longitude, Real* latitude );
 
@@ -47,6 +51,10 @@ NOTES:   Commands:
 
            const char* name( const Projector* self );
  
+         projectArray() projects count points with the same results as
+         calling project() on each. x and y may be the same arrays as
+         longitudes and latitudes.
+
          See Lambert.h for example usage.
 
 HISTORY: 2004/10 Todd Plessel EPA/LM Created.
@@ -170,6 +178,9 @@ typedef struct Projector Projector;
   void (*setFalseNorthing)( Type* self, Real falseNorthing ); \
   void (*project)( const Type* self, Real longitude, Real latitude, \
                    Real* x,Real* y ); \
+  void (*projectArray)( const Type* self, Integer count, \
+                        const Real longitudes[], const Real latitudes[], \
+                        Real x[], Real y[] ); \
   void (*unproject)( const Type* self, Real x, Real y, \
                      Real* longitude, Real* latitude ); \
   Integer (*invariant)( const Type* self ); \
@@ -59,6 +59,10 @@ static void setFalseNorthing( Stereographic* self, Real falseNorthing );
 static void project( const Stereographic* self, Real longitude, Real latitude,
                      Real* x, Real* y );
 
+static void projectArray( const Stereographic* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] );
+
 static void unproject( const Stereographic* self, Real x, Real y,
                        Real* longitude, Real* latitude );
 
@@ -290,6 +294,36 @@ static void project( const Stereographic* self, Real longitude, Real latitude,
 
 
 
+/******************************************************************************
+PURPOSE: projectArray - Project an array of points.
+INPUTS:  const Stereographic* self  Projector.
+         Integer count                  Number of points to project.
+         const Real longitudes[ count ] E.g., -78.7268.
+         const Real latitudes[  count ] E.g., 35.9611.
+OUTPUTS: Real x[ count ]                Projected longitudes.
+         Real y[ count ]                Projected latitudes.
+NOTES:   Calls project() directly rather than through the function pointer.
+******************************************************************************/
+
+static void projectArray( const Stereographic* self, Integer count,
+                          const Real longitudes[], const Real latitudes[],
+                          Real x[], Real y[] ) {
+
+  PRE6( count > 0, longitudes, latitudes,
+        validLongitudesAndLatitudes( count, longitudes, latitudes ), x, y );
+
+  Integer index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    project( self, longitudes[ index ], latitudes[ index ],
+             x + index, y + index );
+  }
+
+  POST2( isNanFree( x, count ), isNanFree( y, count ) );
+}
+
+
+
 /******************************************************************************
 PURPOSE: unproject - Unproject a point.
 INPUTS:  const Stereographic* self    Projector.
@@ -570,6 +604,7 @@ static void assignMembers( Stereographic* self ) {
   self->setFalseEasting  = setFalseEasting;
   self->setFalseNorthing = setFalseNorthing;
   self->project          = project;
+  self->projectArray     = projectArray;
   self->unproject        = unproject;
   self->invariant        = invariant;
   self->equal            = equal;
@@ -598,11 +633,12 @@ static Integer hasMembers( const Stereographic* self ) {
   PRE0( self );
 
   const Integer result =
-    AND16( self->free             == free__,
+    AND17( self->free             == free__,
            self->setEllipsoid     == setEllipsoid,
            self->setFalseEasting  == setFalseEasting,
            self->setFalseNorthing == setFalseNorthing,
            self->project          == project,
+           self->projectArray     == projectArray,
            self->unproject        == unproject,
            self->invariant        == invariant,
            self->equal            == equal,
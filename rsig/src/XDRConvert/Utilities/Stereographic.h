@@ -32,6 +32,10 @@ NOTES:   Commands:
                          Real longitude, Real latitude,
                          Real* x, Real* y );
 
+           void projectArray( const Stereographic* self, Integer count,
+                              const Real longitudes[], const Real latitudes[],
+                              Real x[], Real y[] );
+
            void unproject( const Stereographic* self, Real x, Real y,
                            Real* longitude, Real* latitude );
 
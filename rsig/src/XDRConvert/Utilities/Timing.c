@@ -0,0 +1,292 @@
+
+/******************************************************************************
+PURPOSE: Timing.c - Defines routines for an opt-in per-stage timing report.
+NOTES:   See Timing.h. Uses static 'global' variables so stages must be begun
+         by one thread (e.g., the main thread outside of parallel regions).
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stdio.h>        /* For stderr, fprintf(), sscanf().               */
+#include <stdlib.h>       /* For getenv().                                  */
+#include <string.h>       /* For strcmp(), strrchr(), strstr(), memset().   */
+#include <fcntl.h>        /* For open().                                    */
+#include <unistd.h>       /* For read(), close().                           */
+#include <sys/time.h>     /* For gettimeofday().                            */
+#include <sys/resource.h> /* For getrusage().                               */
+
+#include <Assertions.h>    /* For PRE0*(), POST0*().                        */
+#include <BasicNumerics.h> /* For Integer, INTEGER_FORMAT.                  */
+#include <Timing.h>        /* For public interface.                         */
+
+/*================================== TYPES ==================================*/
+
+enum { MAXIMUM_STAGES = 32 };
+
+typedef struct {
+  const char* name;     /* Name of stage. E.g., "read". */
+  double wall;          /* Accumulated wall-clock seconds. */
+  double cpu;           /* Accumulated user + system CPU seconds. */
+  Integer bytesRead;    /* Accumulated bytes read or -1 if unknown. */
+  Integer bytesWritten; /* Accumulated bytes written or -1 if unknown. */
+  Integer points;       /* Accumulated points kept. */
+} Stage;
+
+typedef struct {
+  double wall;          /* Wall-clock seconds since the epoch. */
+  double cpu;           /* User + system CPU seconds of process. */
+  Integer bytesRead;    /* Bytes read by process or -1 if unknown. */
+  Integer bytesWritten; /* Bytes written by process or -1 if unknown. */
+} Sample;
+
+/*============================ PRIVATE VARIABLES ============================*/
+
+static Integer enabled = 0;              /* Was RSIG_TIMING set to 1? */
+static const char* programName = "";     /* Name of program being timed. */
+static Stage stages[ MAXIMUM_STAGES ];   /* Stages in order first begun. */
+static Integer stageCount = 0;           /* Number of stages begun. */
+static Integer current = -1;             /* Index of current stage or -1. */
+static Sample last;                      /* Sample when current stage began.*/
+static Integer procBytes = 0;            /* Bytes read from /proc/self/io. */
+
+/*========================== FORWARD DECLARATIONS ===========================*/
+
+static void sample( Sample* result );
+
+static void accumulate( void );
+
+static void printStage( const Stage* stage );
+
+/*============================ PUBLIC FUNCTIONS =============================*/
+
+
+
+/******************************************************************************
+PURPOSE: timingEnabled - Is timing enabled?
+RETURNS: int 1 if timingBegin() found RSIG_TIMING=1 and timingReport()
+         has not yet been called, else 0.
+******************************************************************************/
+
+int timingEnabled( void ) {
+  const int result = enabled;
+  POST0( IS_BOOL( result ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: timingBegin - Enable timing if environment variable RSIG_TIMING is 1.
+INPUTS:  const char* name  Name of program. E.g., argv[ 0 ].
+NOTES:   Time before the first call to timingStage() is not reported.
+******************************************************************************/
+
+void timingBegin( const char* name ) {
+  PRE02( name, *name );
+  const char* const value = getenv( "RSIG_TIMING" );
+  enabled = AND2( value, ! strcmp( value, "1" ) );
+
+  if ( enabled ) {
+    const char* const slash = strrchr( name, '/' );
+    programName = slash ? slash + 1 : name;
+    memset( stages, 0, sizeof stages );
+    stageCount = 0;
+    current = -1;
+    sample( &last );
+  }
+
+  POST0( IMPLIES( timingEnabled(), stageCount == 0 ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: timingStage - End the current stage (if any) and begin a stage.
+INPUTS:  const char* name  Name of stage. E.g., "read". Must be a literal or
+                           otherwise persist until timingReport().
+******************************************************************************/
+
+void timingStage( const char* name ) {
+  PRE02( name, *name );
+
+  if ( enabled ) {
+    Integer index = 0;
+    accumulate();
+
+    while ( AND2( index < stageCount, strcmp( stages[ index ].name, name ) ) ) {
+      ++index;
+    }
+
+    if ( index == stageCount ) {
+
+      if ( stageCount < MAXIMUM_STAGES ) {
+        stages[ index ].name = name;
+        ++stageCount;
+      } else {
+        index = stageCount - 1; /* Charge excess stages to the last one. */
+      }
+    }
+
+    current = index;
+  }
+
+  POST0( IMPLIES( timingEnabled(), IN_RANGE( current, 0, stageCount - 1 ) ));
+}
+
+
+
+/******************************************************************************
+PURPOSE: timingPoints - Add to the points kept by the current stage.
+INPUTS:  size_t points  Number of points kept.
+******************************************************************************/
+
+void timingPoints( size_t points ) {
+
+  if ( AND2( enabled, current >= 0 ) ) {
+    stages[ current ].points += points;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: timingReport - End the current stage, write the report to stderr
+         and disable timing.
+NOTES:   The total line sums the stages except points, which is the points
+         kept by the last stage that kept any.
+******************************************************************************/
+
+void timingReport( void ) {
+
+  if ( enabled ) {
+    Stage total;
+    Integer index = 0;
+    memset( &total, 0, sizeof total );
+    total.name = "total";
+    accumulate();
+
+    for ( index = 0; index < stageCount; ++index ) {
+      const Stage* const stage = stages + index;
+      printStage( stage );
+      total.wall += stage->wall;
+      total.cpu  += stage->cpu;
+      total.bytesRead =
+        OR2( total.bytesRead < 0, stage->bytesRead < 0 ) ? -1
+        : total.bytesRead + stage->bytesRead;
+      total.bytesWritten =
+        OR2( total.bytesWritten < 0, stage->bytesWritten < 0 ) ? -1
+        : total.bytesWritten + stage->bytesWritten;
+
+      if ( stage->points ) {
+        total.points = stage->points;
+      }
+    }
+
+    printStage( &total );
+    enabled = 0;
+    current = -1;
+  }
+
+  POST0( ! timingEnabled() );
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: sample - Sample the current time, CPU time and I/O counters.
+OUTPUTS: Sample* result  Current time and counters.
+NOTES:   Bytes read from /proc/self/io itself are excluded.
+******************************************************************************/
+
+static void sample( Sample* result ) {
+  PRE0( result );
+  struct timeval now;
+  struct rusage usage;
+  const int file = open( "/proc/self/io", O_RDONLY );
+  memset( &usage, 0, sizeof usage );
+  gettimeofday( &now, 0 );
+  getrusage( RUSAGE_SELF, &usage );
+  result->wall = now.tv_sec + now.tv_usec * 1e-6;
+  result->cpu =
+    usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 +
+    usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+  result->bytesRead = result->bytesWritten = -1;
+
+  if ( file != -1 ) {
+    char buffer[ 512 ] = "";
+    const ssize_t bytes = read( file, buffer, sizeof buffer - 1 );
+    close( file );
+
+    if ( bytes > 0 ) {
+      const char* const rchar = strstr( buffer, "rchar:" );
+      const char* const wchar = strstr( buffer, "wchar:" );
+      Integer value = 0;
+
+      if ( AND2( rchar,
+                 sscanf( rchar + 6, "%"INTEGER_FORMAT, &value ) == 1 ) ) {
+        result->bytesRead = value - procBytes;
+      }
+
+      if ( AND2( wchar,
+                 sscanf( wchar + 6, "%"INTEGER_FORMAT, &value ) == 1 ) ) {
+        result->bytesWritten = value;
+      }
+
+      procBytes += bytes;
+    }
+  }
+
+  POST02( result->wall > 0.0, result->cpu >= 0.0 );
+}
+
+
+
+/******************************************************************************
+PURPOSE: accumulate - Add the time and I/O since the last sample to the
+         current stage (if any) and take a new sample.
+******************************************************************************/
+
+static void accumulate( void ) {
+  Sample now;
+  sample( &now );
+
+  if ( current >= 0 ) {
+    Stage* const stage = stages + current;
+    stage->wall += now.wall - last.wall;
+    stage->cpu  += now.cpu  - last.cpu;
+    stage->bytesRead =
+      OR3( stage->bytesRead < 0, now.bytesRead < 0, last.bytesRead < 0 ) ? -1
+      : stage->bytesRead + now.bytesRead - last.bytesRead;
+    stage->bytesWritten =
+      OR3( stage->bytesWritten < 0, now.bytesWritten < 0,
+           last.bytesWritten < 0 ) ? -1
+      : stage->bytesWritten + now.bytesWritten - last.bytesWritten;
+  }
+
+  last = now;
+}
+
+
+
+/******************************************************************************
+PURPOSE: printStage - Write one line of the timing report to stderr.
+INPUTS:  const Stage* stage  Stage to report.
+******************************************************************************/
+
+static void printStage( const Stage* stage ) {
+  PRE02( stage, stage->name );
+  fprintf( stderr,
+           "timing: program=%s stage=%s wall=%.3f cpu=%.3f "
+           "bytes_read=%"INTEGER_FORMAT" bytes_written=%"INTEGER_FORMAT" "
+           "points=%"INTEGER_FORMAT"\n",
+           programName, stage->name, stage->wall, stage->cpu,
+           stage->bytesRead, stage->bytesWritten, stage->points );
+}
+
+
+
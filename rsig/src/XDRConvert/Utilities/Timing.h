@@ -0,0 +1,68 @@
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+PURPOSE: Timing.h - Declares routines for an opt-in per-stage timing report.
+NOTES:   Enabled by setting environment variable RSIG_TIMING to 1.
+         Otherwise all routines are no-ops.
+         Each stage accumulates wall-clock seconds, CPU seconds (all threads),
+         bytes read, bytes written and points kept from the time it is begun
+         until the next stage is begun. Stages begun more than once (e.g.,
+         per input file) accumulate into one entry.
+         Bytes are from read/write system calls (/proc/self/io) so include
+         files, pipes, stdin and stdout. Where unavailable they are -1.
+         The report is written to stderr as one line per stage plus a total
+         line (wrapped here), e.g.:
+
+timing: program=XDRConvert stage=read wall=0.412 cpu=0.398
+        bytes_read=80000542 bytes_written=0 points=10000000
+timing: program=XDRConvert stage=write wall=1.950 cpu=1.917
+        bytes_read=0 bytes_written=512000330 points=10000000
+timing: program=XDRConvert stage=total wall=2.362 cpu=2.315
+        bytes_read=80000542 bytes_written=512000330 points=10000000
+
+         Subsetters outside of XDRConvert compile this same Timing.c by
+         adding ../../../rsig/src/XDRConvert/Utilities to their include path
+         (as with Cache.c) so the interface uses only standard C types.
+
+         Example usage:
+
+           int main( int argc, char* argv[] ) {
+             timingBegin( argv[ 0 ] );
+             timingStage( "read" );
+             ...
+             timingPoints( points );
+             timingStage( "write" );
+             ...
+             timingReport();
+             return 0;
+           }
+
+HISTORY: 2025/04 plessel.todd@epa.gov, Created.
+STATUS:  unreviewed, tested.
+******************************************************************************/
+
+/*================================ INCLUDES =================================*/
+
+#include <stddef.h> /* For size_t. */
+
+/*================================ FUNCTIONS ================================*/
+
+extern int timingEnabled( void );
+extern void timingBegin( const char* name );
+extern void timingStage( const char* name );
+extern void timingPoints( size_t points );
+extern void timingReport( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMING_H */
+
+
@@ -27,6 +27,8 @@ HISTORY: 2004/07 Todd Plessel EPA/LM Created.
 #include <Grid.h>
 #include <VoidList.h>
 #include <RegridQuadrilaterals.h>
+#include <Timing.h>
+#include <Cache.h>
 
 static const Real invalid = -9999.0; /* Invalid data value. */
 
@@ -146,6 +146,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   Integer ok = 0;
+  timingBegin( argv[ 0 ] );
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     failureMessage( "Invalid command-line arguments." );
@@ -164,6 +166,7 @@ int main( int argc, char* argv[] ) {
                    parameters.regrid == 0,
                    parameters.compareFunction == 0,
                    parameters.convertFunction == 0 ) ) {
+          timingStage( "copy" );
           ok = parameters.ok = copyToStdout( parameters.input );
         } else {
           char line[ 80 ] = ""; /* Read first line to determine input type. */
@@ -175,6 +178,19 @@ int main( int argc, char* argv[] ) {
             if ( translator ) {
               parameters.ok = 1;
 
+              /*
+               * Only the regridded Point, Aircraft and Profile comparers
+               * stream CMAQ data by timestep. Others need it all in memory:
+               */
+
+              if ( AND2( parameters.cmaqInput,
+                         ! IN4( translator, compareRegriddedPoint,
+                                compareRegriddedAircraft,
+                                compareRegriddedProfile ) ) ) {
+                readCMAQXDRData( parameters.cmaqInput, &parameters );
+                FREE_OBJECT( parameters.cmaqInput );
+              }
+
               if ( IN3( parameters.format, FORMAT_COARDS, FORMAT_IOAPI ) ) {
                 temporaryFileName( parameters.temporaryDirectory, "netcdf",
                                    parameters.netcdfFileName );
@@ -194,6 +210,7 @@ int main( int argc, char* argv[] ) {
                   /* Read and copy temporary NetCDF file to stdout: */
 
                   DEBUG( fprintf( stderr, "Streaming:\n" ); )
+                  timingStage( "stream" );
                   parameters.ok = streamFile( parameters.netcdfFileName );
                 }
               }
@@ -212,6 +229,7 @@ int main( int argc, char* argv[] ) {
     failureMessage( "No points in output." );
   }
 
+  timingReport();
   DEBUG( fprintf( stderr, "XDRConvert is returning %d\n", ! ok ); )
 
   return ! ok;
@@ -255,7 +273,7 @@ Integer isValidParameters( const Parameters* parameters ) {
                           parameters->lastRow >= parameters->firstRow,
                           parameters->firstColumn > 0,
                           parameters->lastColumn >= parameters->firstColumn,
-                          parameters->data,
+                          OR2( parameters->data, parameters->cmaqInput ),
                           IMPLIES_ELSE( parameters->compareFunction,
                                         IS_ZERO2( parameters->convertFunction,
                                                   parameters->data2 ),
@@ -268,6 +286,51 @@ Integer isValidParameters( const Parameters* parameters ) {
 
 
 
+/******************************************************************************
+PURPOSE: readCMAQTimestep - Read one timestep of CMAQ data for comparing.
+INPUTS:  const Parameters* parameters  parameters->cmaqInput to read.
+         Integer timestep              0-based timestep to read.
+OUTPUTS: Real data[ layers * rows * columns ]  CMAQ data for timestep.
+RETURNS: Integer 1 if successful, else 0 and failureMessage() called.
+NOTES:   Lets comparers hold one timestep of CMAQ data rather than all of
+         parameters->data.
+******************************************************************************/
+
+Integer readCMAQTimestep( const Parameters* parameters, Integer timestep,
+                          Real data[] ) {
+
+  PRE06( isValidParameters( parameters ),
+         parameters->cmaqInput,
+         parameters->cmaqInput->isSeekable( parameters->cmaqInput ),
+         parameters->cmaqDataOffset > 0,
+         IN_RANGE( timestep, 0, parameters->timesteps - 1 ),
+         data );
+
+  Stream* const input = parameters->cmaqInput;
+  const Integer layers  = parameters->lastLayer - parameters->firstLayer + 1;
+  const Integer rows    = parameters->lastRow - parameters->firstRow + 1;
+  const Integer columns = parameters->lastColumn - parameters->firstColumn + 1;
+  const Integer count   = layers * rows * columns;
+  Integer result = 0;
+
+  input->seekFromStart( input,
+                        parameters->cmaqDataOffset + timestep * count * 4 );
+
+  if ( input->ok( input ) ) {
+    input->read32BitReals( input, data, count );
+    result = AND2( input->ok( input ), isNanFree( data, count ) );
+  }
+
+  if ( AND2( ! result, input->ok( input ) ) ) {
+    failureMessage( "Invalid CMAQ XDR data at timestep %lld.", timestep );
+  }
+
+  POST02( IS_BOOL( result ), IMPLIES( result, isNanFree( data, count ) ) );
+  return result;
+}
+
+
+
 /*============================ PRIVATE FUNCTIONS ============================*/
 
 
@@ -283,6 +346,7 @@ static void deallocateParameters( Parameters* parameters ) {
 
   FREE_OBJECT( parameters->input );
   FREE_OBJECT( parameters->grid );
+  FREE_OBJECT( parameters->cmaqInput );
 
 #ifndef DEBUGGING
 
@@ -367,6 +431,8 @@ static void printUsage( const char* programName ) {
   fprintf( stderr, "A   = 50.0     Atmospheric lapse rate in K/kg.\n" );
   fprintf( stderr, "T0s = 290.0    Reference surface temperature in K.\n" );
   fprintf( stderr, "P00 = 100000.0 Reference surface pressure in Pa.\n" );
+  fprintf( stderr, "\nSet environment variable RSIG_TIMING=1 to write a " );
+  fprintf( stderr, "per-stage timing report to stderr.\n" );
   fprintf( stderr, "\nexamples:\n\n" );
   fprintf( stderr, "  cat airnow.xdr | %s -coards", programName );
   fprintf( stderr, " > airnow.nc ; ncdump airnow.nc | more\n\n" );
@@ -774,7 +840,7 @@ static void parseCompare( int argc, char* argv[], Integer* argument,
                          parameters->lastRow >= parameters->firstRow,
                          parameters->firstColumn > 0,
                          parameters->lastColumn >= parameters->firstColumn,
-                         parameters->data,
+                         OR2( parameters->data, parameters->cmaqInput ),
                          IMPLIES( parameters->convertFunction,
                            AND2( parameters->compareFunction == 0,
                                  parameters->data2 ) ) ) ) );
@@ -819,7 +885,11 @@ static Translator findTranslator( const char* line ) {
 /******************************************************************************
 PURPOSE: readCMAQXDR - Read CMAQ XDR-format file for comparing.
 INPUTS:  const Char* const fileName CMAQ XDR-format file to read.
-OUTPUTS: Parameters* parameters  Updated parameters->data.
+OUTPUTS: Parameters* parameters  Updated parameters->data or
+                                 parameters->cmaqInput, cmaqDataOffset.
+NOTES:   When comparing, the file is left open and its data is not read until
+         the translator is known since some translators stream the data
+         by timestep. See readCMAQTimestep().
 ******************************************************************************/
 
 static void readCMAQXDR( const char* fileName, Parameters* parameters ) {
@@ -834,7 +904,23 @@ static void readCMAQXDR( const char* fileName, Parameters* parameters ) {
     readCMAQXDRHeader( input, parameters );
 
     if ( parameters->ok ) {
-      readCMAQXDRData( input, parameters );
+
+      if ( parameters->compareFunction ) {
+        const Integer layers =
+          parameters->lastLayer - parameters->firstLayer + 1;
+        const Integer rows = parameters->lastRow - parameters->firstRow + 1;
+        const Integer columns =
+          parameters->lastColumn - parameters->firstColumn + 1;
+        const Integer count = parameters->timesteps * layers * rows * columns;
+
+        /* Data follows Longitudes, Latitudes, Elevations: */
+
+        parameters->cmaqDataOffset = input->offset( input ) + 3 * count * 4;
+        parameters->cmaqInput = input;
+        input = 0; /* Transfered ownership to parameters. */
+      } else {
+        readCMAQXDRData( input, parameters );
+      }
     }
 
     FREE_OBJECT( input );
@@ -850,7 +936,7 @@ static void readCMAQXDR( const char* fileName, Parameters* parameters ) {
                          parameters->lastRow >= parameters->firstRow,
                          parameters->firstColumn > 0,
                          parameters->lastColumn >= parameters->firstColumn,
-                         parameters->data,
+                         OR2( parameters->data, parameters->cmaqInput ),
                          IMPLIES( parameters->convertFunction,
                            AND2( parameters->compareFunction == 0,
                                   parameters->data2 ) ) ) ) );
@@ -0,0 +1,686 @@
+/******************************************************************************
+PURPOSE: pgzip.c - Implements a parallel (multi-threaded) gzip -c compressor.
+NOTES:   Reads stdin and writes a single gzip-format (RFC 1952) stream to
+         stdout that is decoded by standard gunzip / zcat / gzip -d.
+         The input is split into fixed-size blocks that are compressed
+         independently and concurrently (using OpenMP threads).
+         Each block is primed with the last 32KB of the preceding input
+         (deflateSetDictionary) so the compression ratio is close to that of
+         serial gzip. Each non-final block is ended with a sync flush so
+         the raw deflate streams of the blocks can simply be concatenated.
+         The stream is terminated by an empty final block and the
+         CRC-32 of the whole input (combined from the per-block CRCs
+         using crc32_combine()) and the input size modulo 2^32.
+         pgzip help.
+To compile:
+if ( `uname` == "Linux"  ) cc -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64 \
+                              -fopenmp -O -o pgzip pgzip.c -lz
+HISTORY: 2025/03, plessel.todd@epa.gov, Created.
+STATUS:  unreviewed, tested.
+******************************************************************************/
+
+/*=============================== INCLUDES ==================================*/
+
+#include <assert.h>    /* For assert(). */
+#include <stdlib.h>    /* For malloc(), free(), strtol(). */
+#include <stdarg.h>    /* For va_list, va_start(), va_end(). */
+#include <errno.h>     /* For errno. */
+#include <stdio.h>     /* For FILE, stdin, stdout, fread(), fwrite(). */
+#include <string.h>    /* For memset(), memcpy(), strcmp(). */
+
+#include <zlib.h>      /* For deflate*(), crc32(), crc32_combine(). */
+
+#ifdef _OPENMP
+#include <omp.h>       /* For omp_get_max_threads(). */
+#else
+#define omp_get_max_threads() 1
+#endif
+
+/*================================== MACROS =================================*/
+
+#ifdef MIN
+#undef MIN
+#endif
+#define MIN( a, b ) ( (a) < (b) ? (a) : (b) )
+
+#define OR2( a, b ) ( (a) || (b) )
+#define AND2( a, b ) ( (a) && (b) )
+#define AND3( a, b, c ) ( (a) && (b) && (c) )
+#define IS_BOOL( x ) ( (x) == 0 || (x) == 1 )
+#define IMPLIES( p, c ) ( !(p) || (c) )
+#define IN_RANGE( x, low, high ) ( (low) <= (x) && (x) <= (high) )
+#define ZERO_OBJECT( x ) memset( (x), 0, sizeof *(x) )
+
+/*================================== TYPES ==================================*/
+
+/* Size of the deflate sliding window used as the dictionary of each block: */
+
+enum { DICTIONARY_SIZE = 32768 };
+
+/* One independently compressed block of input: */
+
+typedef struct {
+  const unsigned char* input; /* Pointer into Parameters inputBuffer. */
+  size_t inputSize;           /* Number of input bytes in block. */
+  size_t dictionarySize;      /* Number of preceding bytes used as dictionary*/
+  unsigned char* output;      /* Raw deflate bytes of this block. */
+  size_t outputSize;          /* Number of compressed bytes in output. */
+  uLong crc;                  /* CRC-32 of input bytes of this block. */
+  int ok;                     /* Did compression succeed? */
+} Block;
+
+/* ADT/"class" for this program, most routines are "member functions": */
+
+typedef struct {
+  int     level;          /* Compression level 1 (fastest) ... 9 (best). */
+  int     threads;        /* Number of threads used to compress blocks. */
+  size_t  blockSize;      /* Bytes per independently compressed block. */
+  size_t  blocks;         /* Number of blocks read/compressed per batch. */
+  size_t  outputBlockSize;/* Bytes allocated per compressed block. */
+  unsigned char* inputBuffer; /* [DICTIONARY_SIZE + blocks * blockSize]. */
+  unsigned char* outputBuffer;/* [blocks * outputBlockSize]. */
+  Block*  block;          /* block[ blocks ]. */
+  size_t  dictionarySize; /* Bytes of previous batch input at inputBuffer. */
+  uLong   crc;            /* CRC-32 of all input so far. */
+  uLong   totalSize;      /* Number of input bytes so far (modulo 2^32). */
+  int     ok;             /* Did last command succeed? */
+} Parameters;
+
+static const size_t minimumBlockSize = 32 * 1024;         /* 32KB. */
+static const size_t defaultBlockSize = 128 * 1024;        /* 128KB. */
+static const size_t maximumBlockSize = 64 * 1024 * 1024;  /* 64MB. */
+enum { BLOCKS_PER_THREAD = 4 }; /* For load-balancing batch across threads. */
+
+static const char* programName = 0;
+static int failures = 0; /* Number of program failures. */
+
+/*=========================== FORWARD DECLARATIONS ==========================*/
+
+/* "Member functions" of "class" Parameters: */
+
+#ifndef NDEBUG
+static int invariant( const Parameters* self );
+#endif
+static void deallocate( Parameters* self );
+static void allocate( Parameters* self );
+static void processArguments( int argc, char* argv[], Parameters* self );
+static void processArgument( const char* argument, Parameters* self );
+static void compressAll( Parameters* self );
+static size_t readBatch( Parameters* self );
+static void compressBatch( Parameters* self, size_t count );
+static void writeBatch( Parameters* self, size_t count );
+static void writeHeader( Parameters* self );
+static void writeTrailer( Parameters* self );
+
+/* Helpers: */
+
+static void usage( const char* programName );
+static void compressBlock( int level, Block* block );
+static void writeUnsigned4( unsigned long value, unsigned char bytes[ 4 ] );
+static long toInteger( const char* string, long lower, long upper, int* ok );
+static void failure( const char* message, ... );
+
+/*============================ PUBLIC FUNCTIONS =============================*/
+
+
+
+/******************************************************************************
+PURPOSE: main - Process command-line arguments and compress stdin to stdout.
+INPUTS:  int argc      Number of command-line argument strings.
+         char* argv[]  Command-line argument strings.
+RETURNS: int 0 if successful, else 1.
+******************************************************************************/
+
+int main( int argc, char* argv[] ) {
+  int ok = 0;
+  Parameters self;
+  assert( argc > 0 ); assert( argv ); assert( argv[ 0 ] );
+  programName = argv[ 0 ];
+  processArguments( argc, argv, &self );
+
+  if ( self.ok ) {
+    compressAll( &self );
+    ok = self.ok;
+  }
+
+  deallocate( &self );
+  return ! ok;
+}
+
+
+
+/*============================ PRIVATE FUNCTIONS ============================*/
+
+
+
+/******************************************************************************
+PURPOSE: usage - Print program documentation.
+INPUTS:  const char* programName  Name of this executable.
+******************************************************************************/
+
+static void usage( const char* programName ) {
+  assert( programName ); assert( *programName );
+  fprintf( stderr, "\a\n\n%s - ", programName );
+  fprintf( stderr, "Parallel gzip compression of stdin to stdout.\n" );
+  fprintf( stderr, "\nusage: %s [option] ...\n\n", programName );
+  fprintf( stderr, "  Option              Description                     " );
+  fprintf( stderr, "[default]\n" );
+  fprintf( stderr, "  ----------------------------------------------------" );
+  fprintf( stderr, "-------------\n" );
+  fprintf( stderr, "  help                Print these instructions.\n" );
+  fprintf( stderr, "  -c                  Write to stdout (always).\n" );
+  fprintf( stderr, "  -1 ... -9           Compression level (fast...best)." );
+  fprintf( stderr, " [6]\n" );
+  fprintf( stderr, "  -p threads          Number of compression threads." );
+  fprintf( stderr, "  [%d]\n", omp_get_max_threads() );
+  fprintf( stderr, "  -b kilobytes        Size of each compressed block." );
+  fprintf( stderr, "  [%lu]\n", defaultBlockSize / 1024 );
+  fprintf( stderr, "\nExamples:\n\n" );
+  fprintf( stderr, "  CMAQSubset ... | XDRConvert -ascii | %s -c -1 > a.gz",
+           programName );
+  fprintf( stderr, "\n\n" );
+  fprintf( stderr, "  Compresses the output of XDRConvert using all cores.\n" );
+  fprintf( stderr, "  The result is a single valid gzip file:\n\n" );
+  fprintf( stderr, "  gunzip a.gz\n" );
+  fprintf( stderr, "\nSupport: plessel.todd@epa.gov\n" );
+  fprintf( stderr, "\n\n" );
+}
+
+
+
+#ifndef NDEBUG
+
+/******************************************************************************
+PURPOSE: invariant - Is object valid?
+INPUTS:  const Parameters* self  Object to validate.
+RETURNS: int 1 if valid, else 0.
+******************************************************************************/
+
+static int invariant( const Parameters* self ) {
+  int result = self != 0;
+  result = AND2( result, IN_RANGE( self->level, 1, 9 ) );
+  result = AND2( result, self->threads > 0 );
+  result = AND2( result, IN_RANGE( self->blockSize,
+                                   minimumBlockSize, maximumBlockSize ) );
+  result = AND2( result, self->blocks > 0 );
+  result = AND2( result, self->outputBlockSize > self->blockSize );
+  result = AND2( result, self->inputBuffer );
+  result = AND2( result, self->outputBuffer );
+  result = AND2( result, self->block );
+  result = AND2( result, self->dictionarySize <= DICTIONARY_SIZE );
+  result = AND2( result, IS_BOOL( self->ok ) );
+  assert( IS_BOOL( result ) );
+  return result;
+}
+
+#endif /* ! defined( NDEBUG ) */
+
+
+
+/******************************************************************************
+PURPOSE: deallocate - Deallocate object resources and zero object.
+INPUTS:  Parameters* self  Object with resources to deallocate.
+OUTPUTS: Parameters* self  Object with deallocated and zeroed resources.
+******************************************************************************/
+
+static void deallocate( Parameters* self ) {
+  assert( self );
+  free( self->inputBuffer );
+  free( self->outputBuffer );
+  free( self->block );
+  ZERO_OBJECT( self );
+  assert( self );
+}
+
+
+
+/******************************************************************************
+PURPOSE: allocate - Allocate object buffers.
+INPUTS:  Parameters* self  Object requiring allocated resources.
+OUTPUTS: Parameters* self  Allocated initialized object or else self->ok is 0.
+******************************************************************************/
+
+static void allocate( Parameters* self ) {
+  assert( self ); assert( self->ok ); assert( self->threads > 0 );
+  assert( self->blockSize ); assert( self->inputBuffer == 0 );
+
+  self->blocks = self->threads * BLOCKS_PER_THREAD;
+
+  /* Worst-case deflate expansion plus room for the sync flush marker: */
+
+  self->outputBlockSize = deflateBound( 0, self->blockSize ) + 64;
+
+  self->inputBuffer =
+    malloc( DICTIONARY_SIZE + self->blocks * self->blockSize );
+  self->outputBuffer = malloc( self->blocks * self->outputBlockSize );
+  self->block = malloc( self->blocks * sizeof (Block) );
+  self->ok = AND3( self->inputBuffer, self->outputBuffer, self->block );
+
+  if ( ! self->ok ) {
+    failure( "Could not allocate memory for %lu %lu-byte buffers.",
+             self->blocks, self->blockSize );
+  } else {
+    memset( self->block, 0, self->blocks * sizeof (Block) );
+    self->crc = crc32( 0L, Z_NULL, 0 );
+  }
+
+  assert( IMPLIES( self->ok, invariant( self ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: processArguments - Process command-line arguments.
+INPUTS:  int argc      Number of command-line argument strings.
+         char* argv[]  Command-line argument strings.
+OUTPUTS: Parameters* self  Initialized object.
+******************************************************************************/
+
+static void processArguments( int argc, char* argv[], Parameters* self ) {
+  int argument = 1;
+  assert( argc > 0 ); assert( argv ); assert( *argv ); assert( *argv[ 0 ] );
+  assert( self );
+
+  ZERO_OBJECT( self );
+  self->level     = Z_DEFAULT_COMPRESSION == -1 ? 6 : Z_DEFAULT_COMPRESSION;
+  self->threads   = omp_get_max_threads();
+  self->blockSize = defaultBlockSize;
+  self->ok = 1;
+
+  for ( argument = 1; AND2( self->ok, argument < argc ); ++argument ) {
+    const char* const arg = argv[ argument ];
+
+    if ( AND2( OR2( ! strcmp( arg, "-p" ), ! strcmp( arg, "-b" ) ),
+               argument + 1 < argc ) ) {
+      const int isThreads = ! strcmp( arg, "-p" );
+      const char* const value = argv[ ++argument ];
+
+      if ( isThreads ) {
+        self->threads = (int) toInteger( value, 1, 1024, &self->ok );
+      } else {
+        self->blockSize =
+          1024 * (size_t) toInteger( value, minimumBlockSize / 1024,
+                                     maximumBlockSize / 1024, &self->ok );
+      }
+    } else {
+      processArgument( arg, self );
+    }
+  }
+
+  if ( self->ok ) {
+    allocate( self );
+  } else {
+    usage( argv[ 0 ] );
+  }
+
+  assert( IMPLIES( self->ok, invariant( self ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: processArgument - Process single-word command-line argument.
+INPUTS:  const char* argument  Command-line argument to process.
+OUTPUTS: Parameters* self      Partially initialized object.
+NOTES:   Accepts gzip's -c and -# options so pgzip is a drop-in replacement.
+******************************************************************************/
+
+static void processArgument( const char* argument, Parameters* self ) {
+  assert( argument ); assert( self ); assert( self->ok );
+
+  if ( ! strcmp( argument, "-c" ) ) {
+    /* Always write to stdout. */
+  } else if ( AND3( argument[ 0 ] == '-',
+                    IN_RANGE( argument[ 1 ], '1', '9' ),
+                    argument[ 2 ] == '\0' ) ) {
+    self->level = argument[ 1 ] - '0';
+  } else {
+    self->ok = 0;
+
+    if ( strcmp( argument, "help" ) ) {
+      failure( "Invalid argument '%s'.", argument );
+    }
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: compressAll - Compress all of stdin to stdout.
+INPUTS:  Parameters* self  Object containing parameters for processing.
+******************************************************************************/
+
+static void compressAll( Parameters* self ) {
+  assert( invariant( self ) ); assert( self->ok );
+
+  writeHeader( self );
+
+  while ( self->ok ) {
+    const size_t count = readBatch( self );
+
+    if ( count == 0 ) {
+      break;
+    }
+
+    compressBatch( self, count );
+    writeBatch( self, count );
+  }
+
+  writeTrailer( self );
+
+  if ( AND2( ! self->ok, failures == 0 ) ) {
+    failure( "Failed to compress all bytes." );
+  }
+
+  assert( invariant( self ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: readBatch - Read up to self->blocks blocks of stdin.
+INPUTS:  Parameters* self  Object containing parameters for processing.
+OUTPUTS: Parameters* self  Object with block[] input initialized.
+RETURNS: size_t number of (non-empty) blocks read.
+NOTES:   The last DICTIONARY_SIZE bytes of the previous batch are kept at the
+         start of inputBuffer so every block has a contiguous dictionary.
+******************************************************************************/
+
+static size_t readBatch( Parameters* self ) {
+  size_t result = 0;
+  unsigned char* const data = self->inputBuffer + DICTIONARY_SIZE;
+  size_t bytes = 0;
+  assert( invariant( self ) ); assert( self->ok );
+
+  if ( ! feof( stdin ) ) {
+    bytes = fread( data, 1, self->blocks * self->blockSize, stdin );
+    self->ok = ! ferror( stdin );
+
+    if ( ! self->ok ) {
+      failure( "Failed to read input." );
+    }
+  }
+
+  if ( AND2( self->ok, bytes ) ) {
+    size_t offset = 0;
+    size_t previous = self->dictionarySize;
+
+    for ( result = 0; offset < bytes; ++result ) {
+      Block* const block = self->block + result;
+      block->input = data + offset;
+      block->inputSize = MIN( self->blockSize, bytes - offset );
+      block->dictionarySize = previous;
+      block->output = self->outputBuffer + result * self->outputBlockSize;
+      block->outputSize = 0;
+      block->crc = 0;
+      block->ok = 0;
+      offset += block->inputSize;
+      previous = MIN( block->inputSize + previous, DICTIONARY_SIZE );
+    }
+
+    assert( result <= self->blocks );
+  }
+
+  assert( invariant( self ) );
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: compressBatch - Compress the given number of blocks in parallel.
+INPUTS:  Parameters* self  Object containing blocks to compress.
+         size_t count      Number of blocks to compress.
+OUTPUTS: Parameters* self  Object with compressed blocks.
+******************************************************************************/
+
+static void compressBatch( Parameters* self, size_t count ) {
+  const int level = self->level;
+  Block* const blocks = self->block;
+  long index = 0;
+  int ok = 1;
+  assert( invariant( self ) ); assert( self->ok );
+  assert( IN_RANGE( count, 1, self->blocks ) );
+
+#pragma omp parallel for num_threads( self->threads ) schedule( dynamic, 1 )
+
+  for ( index = 0; index < (long) count; ++index ) {
+    compressBlock( level, blocks + index );
+  }
+
+  for ( index = 0; index < (long) count; ++index ) {
+    ok = AND2( ok, blocks[ index ].ok );
+  }
+
+  self->ok = ok;
+
+  if ( ! self->ok ) {
+    failure( "Failed to compress block." );
+  }
+
+  assert( invariant( self ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeBatch - Write the compressed blocks, in order, to stdout and
+         update the running CRC-32 and size.
+INPUTS:  Parameters* self  Object containing compressed blocks.
+         size_t count      Number of blocks to write.
+OUTPUTS: Parameters* self  Object with updated crc, totalSize and dictionary.
+******************************************************************************/
+
+static void writeBatch( Parameters* self, size_t count ) {
+  size_t index = 0;
+  size_t bytes = 0;
+  assert( invariant( self ) ); assert( self->ok );
+  assert( IN_RANGE( count, 1, self->blocks ) );
+
+  for ( index = 0; AND2( self->ok, index < count ); ++index ) {
+    const Block* const block = self->block + index;
+    self->ok =
+      fwrite( block->output, 1, block->outputSize, stdout ) ==
+        block->outputSize;
+    self->crc = crc32_combine( self->crc, block->crc, block->inputSize );
+    self->totalSize += block->inputSize;
+    bytes += block->inputSize;
+  }
+
+  if ( ! self->ok ) {
+    failure( "Failed to write compressed output." );
+  } else {
+
+    /* Keep the last DICTIONARY_SIZE input bytes for the next batch: */
+
+    const size_t keep = MIN( bytes + self->dictionarySize, DICTIONARY_SIZE );
+    const unsigned char* const end =
+      self->inputBuffer + DICTIONARY_SIZE + bytes;
+    memmove( self->inputBuffer + DICTIONARY_SIZE - keep, end - keep, keep );
+    self->dictionarySize = keep;
+  }
+
+  assert( invariant( self ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeHeader - Write the 10-byte gzip header to stdout.
+INPUTS:  Parameters* self  Object containing parameters for processing.
+******************************************************************************/
+
+static void writeHeader( Parameters* self ) {
+  const unsigned char header[ 10 ] = {
+    0x1f, 0x8b, /* gzip magic number. */
+    8,          /* Compression method deflate. */
+    0,          /* Flags: no name, comment, extra or header crc. */
+    0, 0, 0, 0, /* Modification time: none (stdin). */
+    0,          /* Extra flags. */
+    3           /* Operating system: UNIX. */
+  };
+  assert( invariant( self ) ); assert( self->ok );
+  self->ok = fwrite( header, sizeof header, 1, stdout ) == 1;
+
+  if ( ! self->ok ) {
+    failure( "Failed to write gzip header." );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeTrailer - Write the final empty deflate block, CRC-32 and size.
+INPUTS:  Parameters* self  Object containing parameters for processing.
+******************************************************************************/
+
+static void writeTrailer( Parameters* self ) {
+  assert( invariant( self ) );
+
+  if ( self->ok ) {
+
+    /* Empty fixed-Huffman block with BFINAL set, then crc and size: */
+
+    unsigned char trailer[ 2 + 4 + 4 ] = { 3, 0 };
+    writeUnsigned4( self->crc, trailer + 2 );
+    writeUnsigned4( self->totalSize, trailer + 6 );
+    self->ok = fwrite( trailer, sizeof trailer, 1, stdout ) == 1;
+    self->ok = AND2( self->ok, fflush( stdout ) == 0 );
+
+    if ( ! self->ok ) {
+      failure( "Failed to write gzip trailer." );
+    }
+  }
+}
+
+
+
+/* Helpers: */
+
+
+
+/******************************************************************************
+PURPOSE: compressBlock - Compute the CRC-32 and raw deflate of a block.
+INPUTS:  int level     Compression level 1 ... 9.
+         Block* block  Block with input and dictionary to compress.
+OUTPUTS: Block* block  Block with output, outputSize, crc and ok set.
+NOTES:   Called concurrently on distinct blocks so uses no shared state.
+         The output ends with a sync flush (empty stored block) so it is
+         byte-aligned and has no final block bit set.
+******************************************************************************/
+
+static void compressBlock( int level, Block* block ) {
+  z_stream stream;
+  assert( IN_RANGE( level, 1, 9 ) ); assert( block ); assert( block->input );
+  assert( block->inputSize ); assert( block->output );
+  ZERO_OBJECT( &stream );
+  block->crc = crc32( crc32( 0L, Z_NULL, 0 ), block->input, block->inputSize );
+  block->ok = deflateInit2( &stream, level, Z_DEFLATED, -15, 8,
+                            Z_DEFAULT_STRATEGY ) == Z_OK;
+
+  if ( block->ok ) {
+
+    if ( block->dictionarySize ) {
+      block->ok =
+        deflateSetDictionary( &stream,
+                              block->input - block->dictionarySize,
+                              block->dictionarySize ) == Z_OK;
+    }
+
+    if ( block->ok ) {
+      const uInt outputSize =
+        deflateBound( &stream, block->inputSize ) + 64;
+      stream.next_in   = (Bytef*) block->input;
+      stream.avail_in  = block->inputSize;
+      stream.next_out  = block->output;
+      stream.avail_out = outputSize;
+      block->ok = AND2( deflate( &stream, Z_SYNC_FLUSH ) == Z_OK,
+                        stream.avail_in == 0 );
+      block->outputSize = outputSize - stream.avail_out;
+    }
+
+    deflateEnd( &stream );
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: writeUnsigned4 - Store the low 32 bits of a value little-endian.
+INPUTS:  unsigned long value  Value to store.
+OUTPUTS: unsigned char bytes[ 4 ]  Little-endian bytes of value.
+******************************************************************************/
+
+static void writeUnsigned4( unsigned long value, unsigned char bytes[ 4 ] ) {
+  assert( bytes );
+  bytes[ 0 ] = value & 0xff;
+  bytes[ 1 ] = ( value >>  8 ) & 0xff;
+  bytes[ 2 ] = ( value >> 16 ) & 0xff;
+  bytes[ 3 ] = ( value >> 24 ) & 0xff;
+}
+
+
+
+/******************************************************************************
+PURPOSE: toInteger - Integer value of string if within range [lower, upper].
+INPUTS:  const char* string  - The string to convert.
+         long lower  - The lower limit of valid range.
+         long upper  - The upper limit of valid range.
+OUTPUTS: int* ok     - Does string represent an integer in [lower, upper]?
+RETURNS: long value of string within range [lower, upper], else 0.
+******************************************************************************/
+
+static long toInteger( const char* string, long lower, long upper, int* ok ) {
+  long result = 0;
+  assert( string ); assert( lower <= upper ); assert( ok );
+  *ok = 0;
+  errno = 0; /* strtol sets errno upon failure but won't clear it on success!*/
+
+  if ( *string ) {
+    char* terminator = 0;
+    const long convertionResult = strtol( string, &terminator, 10 );
+
+    *ok = AND3( terminator != string, *terminator == '\0',
+                AND2( errno != ERANGE,
+                      IN_RANGE( convertionResult, lower, upper ) ) );
+
+    if ( *ok ) {
+      result = convertionResult;
+    }
+  }
+
+  if ( ! *ok ) {
+    failure( "Invalid/out-of-range integer '%s'.", string );
+  }
+
+  return result;
+}
+
+
+
+/******************************************************************************
+PURPOSE: failure - Print an annotated failure message to stderr and update the
+         number of failures and reset errno.
+INPUTS:  const char* message  Printf-like format string.
+         ... Optional arguments implied by format string.
+******************************************************************************/
+
+static void failure( const char* message, ... ) {
+  va_list args; /* For stdarg magic. */
+  assert( message ); assert( *message );
+  assert( programName ); assert( *programName );
+  fprintf( stderr, "\a\n\n%s: ", programName );
+  va_start( args, message );         /* Begin stdarg magic. */
+  vfprintf( stderr, message, args ); /* Forward to vfprintf(). */
+  va_end( args );                    /* End of stdarg magic. */
+
+  if ( errno != 0 ) {
+    perror( " " );
+    errno = 0; /* Clear errno since not all library routines that set it do.*/
+  }
+
+  fprintf( stderr, "\n\n" );
+  ++failures;
+}
+
+
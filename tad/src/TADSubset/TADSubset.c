@@ -71,11 +71,15 @@ STATUS: inchoate
 
 /*================================ INCLUDES =================================*/
 
-#include <stdio.h>     /* For printf(), snprintf(). */
+#include <stdio.h>     /* For printf(), snprintf(), FILE, fopen(), fread(). */
+#include <stdlib.h>    /* For strtod(), malloc(), calloc(). */
 #include <string.h>    /* For strlen(). */
 #include <ctype.h>     /* For isdigit(), isalnum(), isspace(), isprint(). */
+#include <errno.h>     /* For errno. */
+#include <sys/stat.h>  /* For stat(). */
 
 #include <Utilities.h> /* For PRE0*(), NEW_ZERO(), Stream, VoidList, Note. */
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
 
 /*================================== TYPES ==================================*/
 
@@ -162,6 +166,34 @@ static int isValidTrack( const Track* track ) {
 
 
 
+/*
+ * TADFile: A listed TAD file and the result of reading it.
+ * Batches of these are read in parallel then appended in file order.
+ * failureMessage() is not thread-safe so errors found while reading are
+ * recorded as bits and reported, in file order, after each batch is read.
+ */
+
+enum { MAXIMUM_PARALLEL_FILES = 64 };
+
+enum {
+  SIZE_ERROR      = 1,  /* Failed to determine size of file. */
+  READ_ERROR      = 2,  /* Failed to read entire file. */
+  MEMORY_ERROR    = 4,  /* Failed to allocate memory. */
+  LONGITUDE_ERROR = 8,  /* Longitude column not in header line. */
+  VARIABLE_ERROR  = 16, /* Variable column not in header line. */
+  DELIMITER_ERROR = 32  /* Invalid/missing data column delimiters. */
+};
+
+typedef struct {
+  FileName fileName; /* Name of TAD file. */
+  Note     units;    /* Units of variable or "" if not read. */
+  Track*   track;    /* Subset track or 0 if no data in subset. */
+  int      errors;   /* 0 or bitwise-or of *_ERROR found reading file. */
+  int      errnoCopy;/* errno when SIZE_ERROR, READ_ERROR or MEMORY_ERROR. */
+} TADFile;
+
+
+
 /* Data type: */
 
 typedef struct {
@@ -220,7 +252,12 @@ static void initializeArguments( Arguments* arguments );
 
 static void readData( Data* data );
 
-static Track* readTADFile( const char* fileName, Arguments* arguments );
+static void readTADFile( const Arguments* arguments, TADFile* tadFile );
+
+static char* readFileData( TADFile* tadFile, long long* length );
+
+static void reportTADFileErrors( const TADFile* tadFile,
+                                 const char* variable );
 
 static void updateBounds( const double values[ 5 ], int* initialized,
                           Bounds bounds );
@@ -232,7 +269,7 @@ static const char* parseHeaderLines( const char* fileData,
                                      const char* variable,
                                      int* points,
                                      int* longitudeColumn, int* variableColumn,
-                                     Note note, Note units );
+                                     Note note, Note units, int* errors );
 
 static void parseHeaderNote( const char* fileData, Note note );
 
@@ -251,8 +288,14 @@ static int parseDataLine( const char* dataLine,
                           const Note units,
                           double dataValues[ 5 ] );
 
-static double parseColumnValue( const char* dataLine, const char delimiter,
-                                const int column );
+static int parseUTCTimestamp( const char* dataLine,
+                              UTCTimestamp utcTimestamp );
+
+static int findColumns( const char* dataLine, const char delimiter,
+                        const int count, const int columns[],
+                        const char* words[] );
+
+static double parseColumnValue( const char* word );
 
 static int totalSubsetPoints( const VoidList* tracks );
 
@@ -284,6 +327,8 @@ RETURNS: 0 if successful, else 1.
 
 int main( int argc, char* argv[] ) {
   int ok = 0;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
 
   if ( ! isValidArgs( argc, (const char**) argv ) ) {
     failureMessage( "Invalid command-line arguments." );
@@ -295,9 +340,11 @@ int main( int argc, char* argv[] ) {
     data.ok = parseArguments( argc, argv, &data.arguments );
 
     if ( data.ok ) {
+      timingStage( "read" );
       readData( &data ); /* From list file named in arguments. */
 
       if ( data.ok ) {
+        timingStage( "write" );
         writeData( &data ); /* To stdout. */
       }
     }
@@ -306,6 +353,7 @@ int main( int argc, char* argv[] ) {
     deallocateData( &data );
   }
 
+  timingReport();
   POST0( IS_BOOL( ok ) );
   return ! ok;
 }
@@ -466,22 +514,60 @@ static void readData( Data* data ) {
          data->tracks == 0 );
 
   Stream* listFile = newFileStream( data->arguments.listFile, "r" );
-  data->ok = listFile != 0;
+  TADFile* tadFiles = NEW_ZERO( TADFile, MAXIMUM_PARALLEL_FILES );
+  data->ok = AND2( listFile, tadFiles );
 
-  if ( listFile ) {
+  if ( data->ok ) {
 
-    /* For each file, read a subset of it into track and append to list: */
+    /*
+     * For each batch of listed files,
+     *   read a subset of each file into a track in parallel, then in file order
+     *   append each track to list:
+     */
 
     do {
-      FileName fileName = "";
-      listFile->readWord( listFile, fileName,
-                          sizeof fileName / sizeof *fileName );
-      data->ok = listFile->ok( listFile );
+      int listed = 0;
+      int count = 0;
+      int index = 0;
+
+      do { /* List the next batch of files: */
+        TADFile* const tadFile = tadFiles + count;
+        char newline[ 2 ] = "";
+        memset( tadFile, 0, sizeof *tadFile );
+        listFile->readWord( listFile, tadFile->fileName,
+                            sizeof tadFile->fileName /
+                            sizeof *tadFile->fileName );
+        listed = listFile->ok( listFile );
+
+        if ( listed ) {
+          ++count;
+        }
 
-      if ( data->ok ) {
-        Track* track = readTADFile( fileName, &data->arguments );
+        listFile->readString( listFile, newline, 2 ); /* Read '\n'. */
+      } while ( AND3( listed, count < MAXIMUM_PARALLEL_FILES,
+                      ! listFile->isAtEnd( listFile ) ) );
 
-        if ( track ) {
+      /* Read the batch of files in parallel: */
+
+#pragma omp parallel for schedule( dynamic )
+
+      for ( index = 0; index < count; ++index ) {
+        readTADFile( &data->arguments, tadFiles + index );
+      }
+
+      /* Report any errors then append the tracks to list in file order: */
+
+      for ( index = 0; index < count; ++index ) {
+        TADFile* const tadFile = tadFiles + index;
+        Track* track = tadFile->track;
+        tadFile->track = 0;
+        reportTADFileErrors( tadFile, data->arguments.variable );
+
+        if ( *tadFile->units ) {
+          memcpy( data->arguments.units, tadFile->units, sizeof (Note) );
+        }
+
+        if ( AND2( track, data->ok ) ) {
 
           if ( data->tracks == 0 ) { /* Create list if needed: */
             data->tracks = newVoidList( deallocateTrack, 0 );
@@ -491,21 +577,26 @@ static void readData( Data* data ) {
           if ( data->tracks ) { /* Append subsetted track to list: */
             data->tracks->insert( data->tracks, track, LAST_ITEM );
             data->ok = data->tracks->ok( data->tracks );
-          }
 
-          if ( ! data->ok ) {
-            deallocateTrack( track );
-            FREE( track );
+            if ( data->ok ) {
+              track = 0; /* Transfered ownership to list. */
+            }
           }
         }
+
+        if ( track ) {
+          deallocateTrack( track );
+          FREE( track );
+        }
       }
 
-      listFile->readString( listFile, fileName, 2 ); /* Read '\n'. */
+      data->ok = AND2( data->ok, listed );
     } while ( AND2( data->ok, ! listFile->isAtEnd( listFile ) ) );
-
-    FREE_OBJECT( listFile );
   }
 
+  FREE( tadFiles );
+  FREE_OBJECT( listFile );
+
   if ( AND2( data->ok, data->tracks == 0 ) ) {
     failureMessage( "No tracks were in the subset." );
     data->ok = 0;
@@ -519,50 +610,59 @@ static void readData( Data* data ) {
 
 /******************************************************************************
 PURPOSE: readTADFile - Read a subset of track data from TAD file.
-INPUTS:  const char* fileName  Name of compressed TAD file to read.
-         Arguments* arguments  Input arguments.
-OUTPUTS: Arguments* arguments  Updated arguments->units.
-RETURNS: Track* track  Track of subset data or 0 if no data in subset.
-NOTES:   If unsuccessful then failureMessage() is called and 0 is returned.
+INPUTS:  const Arguments* arguments  Input arguments.
+         TADFile* tadFile            tadFile->fileName is the TAD file to read.
+OUTPUTS: TADFile* tadFile            tadFile->track  Track of subset data or 0
+                                                     if no data in subset.
+                                     tadFile->units  Units of variable or "" if
+                                                     not in file.
+                                     tadFile->errors 0 or *_ERROR bits if
+                                                     unsuccessful.
+NOTES:   Called in parallel so it must not modify arguments nor call
+         failureMessage() (directly or via readFile(), NEW(), etc.).
+         See reportTADFileErrors().
 ******************************************************************************/
 
-static Track* readTADFile( const char* fileName, Arguments* arguments ) {
+static void readTADFile( const Arguments* arguments, TADFile* tadFile ) {
 
-  PRE02( fileName, isValidArguments( arguments ) );
+  PRE04( isValidArguments( arguments ), tadFile, tadFile->fileName[ 0 ],
+         tadFile->track == 0 );
 
+  char* const units = tadFile->units;
   Track* result = 0;
   long long length = 0;
-  char* fileData = readFile( fileName, &length );
+  char* fileData = readFileData( tadFile, &length );
 
   if ( fileData ) {
     int points = 0;
     int variableColumn = 0;
     int longitudeColumn = 0;
-    Note units = "";
     Note note = "";
     const char* dataLine = 0;
     memset( note, 0, sizeof note );
-    memset( units, 0, sizeof units );
 
     dataLine =
       parseHeaderLines( fileData, arguments->variable,
                         &points, &longitudeColumn, &variableColumn,
-                        note, units );
+                        note, units, &tadFile->errors );
     DEBUG( fprintf( stderr, "Reading TAD file %s, points = %d, "
                     "longitudeColumn = %d, variableColumn = %d, "
                     "note = '%s', units = '%s'\n",
-                    fileName, points,
+                    tadFile->fileName, points,
                     longitudeColumn, variableColumn, note, units ); )
 
-    if ( *units ) {
-      memcpy( arguments->units, units, sizeof units );
-    }
-
     if ( points > 0 ) {
       const char delimiter = readDelimiter( dataLine );
 
-      if ( delimiter ) {
-        double* data = NEW_ZERO( double, VARIABLES * points );
+      if ( ! delimiter ) {
+        tadFile->errors |= DELIMITER_ERROR;
+      } else {
+        double* data = calloc( VARIABLES * points, sizeof (double) );
+
+        if ( ! data ) {
+          tadFile->errors |= MEMORY_ERROR;
+          tadFile->errnoCopy = errno;
+        }
 
         if ( data ) {
           int initialized = 0;
@@ -593,16 +693,20 @@ static Track* readTADFile( const char* fileName, Arguments* arguments ) {
           }
 
           if ( subsetPoints ) {
-            result = NEW_ZERO( Track, 1 );
+            result = calloc( 1, sizeof (Track) );
 
-            if ( result ) {
+            if ( ! result ) {
+              tadFile->errors |= MEMORY_ERROR;
+              tadFile->errnoCopy = errno;
+            } else {
               strncpy( result->note, note, NOTE_LENGTH );
               result->note[ NOTE_LENGTH ] = '\0';
               memcpy( result->bounds, bounds, sizeof bounds );
               result->points = subsetPoints;
     
               if ( subsetPoints < points / 2 ) { /* Copy data if small subset*/
-                result->data = NEW_ZERO( double, VARIABLES * subsetPoints );
+                result->data =
+                  calloc( VARIABLES * subsetPoints, sizeof (double) );
               }
 
               if ( result->data ) {
@@ -621,14 +725,125 @@ static Track* readTADFile( const char* fileName, Arguments* arguments ) {
     }
 
     FREE( fileData );
+  } else {
+    memset( units, 0, sizeof (Note) );
   }
 
-  POST0( IMPLIES( result, isValidTrack( result ) ) );
+  tadFile->track = result;
+
+  POST0( IMPLIES( tadFile->track,
+                  AND2( isValidTrack( tadFile->track ), *tadFile->units ) ) );
+}
+
+
+
+/******************************************************************************
+PURPOSE: readFileData - Read TAD file into memory and return it as an
+         allocated string.
+INPUTS:  TADFile* tadFile    tadFile->fileName is the TAD file to read.
+OUTPUTS: TADFile* tadFile    tadFile->errors    *_ERROR bits if unsuccessful.
+                             tadFile->errnoCopy errno if unsuccessful.
+         long long* length   Length of string.
+RETURNS: char* string contents of file (with any '\r' characters converted to
+         ' '), else 0 if failed or the file is empty.
+NOTES:   Same as readFile() except failures are recorded in tadFile rather than
+         calling failureMessage() so it can be called in parallel.
+******************************************************************************/
+
+static char* readFileData( TADFile* tadFile, long long* length ) {
+
+  PRE03( tadFile, tadFile->fileName[ 0 ], length );
+
+  char* result = 0;
+  struct stat status;
+  *length = 0;
+
+  if ( stat( tadFile->fileName, &status ) == -1 ) {
+    tadFile->errors |= SIZE_ERROR;
+    tadFile->errnoCopy = errno;
+  } else if ( status.st_size > 0 ) {
+    result = malloc( status.st_size + 1 );
+
+    if ( ! result ) {
+      tadFile->errors |= MEMORY_ERROR;
+      tadFile->errnoCopy = errno;
+    } else {
+      FILE* file = fopen( tadFile->fileName, "rb" );
+      const int ok =
+        AND2( file, fread( result, status.st_size, 1, file ) == 1 );
+
+      if ( file ) {
+        fclose( file );
+        file = 0;
+      }
+
+      if ( ! ok ) {
+        tadFile->errors |= READ_ERROR;
+        tadFile->errnoCopy = errno;
+        FREE( result );
+      } else {
+        *length = status.st_size;
+        result[ *length ] = '\0'; /* Terminate string. */
+        controlMToSpace( result );
+      }
+    }
+  }
+
+  POST0( IMPLIES_ELSE( result, *length > 0, *length == 0 ) );
   return result;
 }
 
 
 
+/******************************************************************************
+PURPOSE: reportTADFileErrors - Call failureMessage() for each error recorded
+         by readTADFile().
+INPUTS:  const TADFile* tadFile  TADFile that was read.
+         const char* variable    Name of variable.
+NOTES:   Must be called serially (outside of parallel regions).
+******************************************************************************/
+
+static void reportTADFileErrors( const TADFile* tadFile,
+                                 const char* variable ) {
+
+  PRE03( tadFile, variable, *variable );
+
+  const int errors = tadFile->errors;
+
+  if ( errors & SIZE_ERROR ) {
+    errno = tadFile->errnoCopy;
+    failureMessage( "Failed to determine size of file '%s'.\n",
+                    tadFile->fileName );
+  }
+
+  if ( errors & READ_ERROR ) {
+    errno = tadFile->errnoCopy;
+    failureMessage( "Failed to read entire file '%s'.\n", tadFile->fileName );
+  }
+
+  if ( errors & MEMORY_ERROR ) {
+    errno = tadFile->errnoCopy;
+    failureMessage( "Can't allocate memory to read file '%s'.",
+                    tadFile->fileName );
+  }
+
+  errno = 0;
+
+  if ( errors & LONGITUDE_ERROR ) {
+    failureMessage( "Variable longitude not available in TAD input file." );
+  }
+
+  if ( errors & VARIABLE_ERROR ) {
+    failureMessage( "Variable %s not available in TAD input file.", variable );
+  }
+
+  if ( errors & DELIMITER_ERROR ) {
+    failureMessage( "Invalid/missing TAD input file data column delimiters." );
+  }
+}
+
+
+
 /******************************************************************************
 PURPOSE: updateBounds - Update longitude latitude bounds.
 INPUTS:  const double values[ 5 ] Current values parsed.
@@ -705,6 +920,8 @@ OUTPUTS: int* points            Number of data lines.
          int* variableColumn    0-based column containing variable.
          Note note              Header note.
          Note units             Units of variable.
+         int* errors            LONGITUDE_ERROR, VARIABLE_ERROR bits set if
+                                those columns are not in the header line.
 RETURNS: char* data lines from TAD file or 0 if invalid fileData.
 ******************************************************************************/
 
@@ -712,10 +929,10 @@ static const char* parseHeaderLines( const char* fileData,
                                      const char* variable,
                                      int* points,
                                      int* longitudeColumn, int* variableColumn,
-                                     Note note, Note units ) {
+                                     Note note, Note units, int* errors ) {
 
-  PRE08( fileData, variable, isalpha( *variable ),
-         points, longitudeColumn, variableColumn, note, units );
+  PRE09( fileData, variable, isalpha( *variable ),
+         points, longitudeColumn, variableColumn, note, units, errors );
 
   const int headerLines = 3;
   const char* result = skipLines( fileData, headerLines );
@@ -732,8 +949,14 @@ static const char* parseHeaderLines( const char* fileData,
     if ( headerLine ) {
       *longitudeColumn = headerColumn( headerLine, "longitude", 0 );
 
-      if ( *longitudeColumn > 0 ) {
+      if ( *longitudeColumn == -1 ) {
+        *errors |= LONGITUDE_ERROR;
+      } else if ( *longitudeColumn > 0 ) {
         *variableColumn = headerColumn( headerLine, variable, units );
+
+        if ( *variableColumn == -1 ) {
+          *errors |= VARIABLE_ERROR;
+        }
       }
     }
   }
@@ -822,7 +1045,7 @@ static void parseHeaderNote( const char* fileData, Note note ) {
 /******************************************************************************
 PURPOSE: readDelimiter - Read delimiter from first data line of TAD file.
 INPUTS:  const char* dataLine   Data line from TAD file.
-RETURNS: char delimiter separating columns or 0 if invalid and failure printed.
+RETURNS: char delimiter separating columns or 0 if invalid.
 ******************************************************************************/
 
 static char readDelimiter( const char* dataLine ) {
@@ -842,7 +1065,6 @@ static char readDelimiter( const char* dataLine ) {
   } while ( result == 0 );
 
   if ( ! IN3( result, '\t', ',' ) ) {
-    failureMessage( "Invalid/missing TAD input file data column delimiters." );
     result = 0;
   }
 
@@ -930,12 +1152,8 @@ static int headerColumn( const char* headerLine, const char* variable,
     }
   }
 
-  if ( result == -1 ) {
-    failureMessage( "Variable %s not available in TAD input file.", variable );
-
-    if ( units ) {
-      memset( units, 0, sizeof (Note) );
-    }
+  if ( AND2( result == -1, units ) ) {
+    memset( units, 0, sizeof (Note) );
   }
 
   POST0( IMPLIES_ELSE( result >= 0,
@@ -958,6 +1176,7 @@ INPUTS:  const char* dataLine            Line of data from TAD file.
          const Note units                Units of variable.
 OUTPUTS: double dataValues[ 5 ]          Data variable values if in subset.
 RETURNS: int 1 if valid and in subset, else 0.
+NOTES:   The line is scanned once to find the needed columns.
 ******************************************************************************/
 
 static int parseDataLine( const char* dataLine,
@@ -982,7 +1201,7 @@ static int parseDataLine( const char* dataLine,
   int result = 0;
   UTCTimestamp utcTimestamp = "";
   memset( utcTimestamp, 0, sizeof utcTimestamp );
-  result = sscanf( dataLine, "%20s", utcTimestamp ) == 1;
+  result = parseUTCTimestamp( dataLine, utcTimestamp );
 
   if ( result ) { /* Convert 'Z' suffix to "-0000" */
     utcTimestamp[ 19 ] = '-';
@@ -1001,16 +1220,21 @@ static int parseDataLine( const char* dataLine,
         const int latitudeColumn =
           longitudeColumn == 1 ? 2 : longitudeColumn - 1;
         const int elevationColumn = 3;
+        const int columns[ 4 ] = {
+          longitudeColumn, latitudeColumn, elevationColumn, variableColumn
+        };
+        const char* words[ 4 ] = { 0, 0, 0, 0 };
         double value = 0.0;
         dataValues[ 0 ] = timestamp;
-        value = parseColumnValue( dataLine, delimiter, longitudeColumn );
+        result = findColumns( dataLine, delimiter, 4, columns, words );
+        value = result ? parseColumnValue( words[ 0 ] ) : MISSING;
         result = IN_RANGE( value,
                            bounds[ LONGITUDE ][ MINIMUM ],
                            bounds[ LONGITUDE ][ MAXIMUM ] );
 
         if ( result ) {
           dataValues[ 1 ] = value;
-          value = parseColumnValue( dataLine, delimiter, latitudeColumn );
+          value = parseColumnValue( words[ 1 ] );
           result = IN_RANGE( value,
                              bounds[ LATITUDE ][ MINIMUM ],
                              bounds[ LATITUDE ][ MAXIMUM ] );
@@ -1020,7 +1244,7 @@ static int parseDataLine( const char* dataLine,
             const double maximumValidElevation = 1e6;    /* Meters. */
             const double km_to_m = 1000.0;
             dataValues[ 2 ] = value;
-            value = parseColumnValue( dataLine, delimiter, elevationColumn );
+            value = parseColumnValue( words[ 2 ] );
             value *= km_to_m;
             result = IN_RANGE( value,
                                minimumValidElevation, maximumValidElevation );
@@ -1042,7 +1266,7 @@ static int parseDataLine( const char* dataLine,
                 maximumValidValue =  100.0;
               }
 
-              value = parseColumnValue( dataLine, delimiter, variableColumn );
+              value = parseColumnValue( words[ 3 ] );
               result = IN_RANGE( value, minimumValidValue, maximumValidValue );
 
               if ( result ) {
@@ -1079,36 +1303,108 @@ static int parseDataLine( const char* dataLine,
 
 
 /******************************************************************************
-PURPOSE: parseColumnValue - Parse data value at given column.
-INPUTS:  const char* dataLine  Data line to parse.
-         const char delimiter  Delimiter between column values. '\t' or ','.
-         const int column      0-based column number to parse.
-RETURNS: double value of data at column or MISSING if invalid.
+PURPOSE: parseUTCTimestamp - Parse UTC timestamp in first column of a line.
+INPUTS:  const char* dataLine      Data line to parse.
+OUTPUTS: UTCTimestamp utcTimestamp First 20 characters of the first word.
+RETURNS: int 1 if a word was parsed, else 0.
+NOTES:   Unlike sscanf() this does not scan to the end of the file data so
+         each line is parsed in time proportional to its length.
+******************************************************************************/
+
+static int parseUTCTimestamp( const char* dataLine,
+                              UTCTimestamp utcTimestamp ) {
+
+  PRE02( dataLine, utcTimestamp );
+
+  const char* c = dataLine;
+  int length = 0;
+
+  while ( AND2( *c, isspace( *c ) ) ) {
+    ++c;
+  }
+
+  for ( ; AND3( length < 20, *c, ! isspace( *c ) ); ++length, ++c ) {
+    utcTimestamp[ length ] = *c;
+  }
+
+  utcTimestamp[ length ] = '\0';
+
+  POST0( IMPLIES( length, utcTimestamp[ 0 ] ) );
+  return length > 0;
+}
+
+
+
+/******************************************************************************
+PURPOSE: findColumns - Find the start of given columns of a data line in one
+         pass.
+INPUTS:  const char* dataLine       Data line to scan.
+         const char delimiter       Delimiter between column values.
+         const int count            Number of columns to find.
+         const int columns[ count ] 0-based column numbers to find.
+OUTPUTS: const char* words[ count ] Start of each column value or 0.
+RETURNS: int 1 if all columns were found on the line, else 0.
+NOTES:   Stops at the end of the line or after the last column needed.
 ******************************************************************************/
 
-static double parseColumnValue( const char* dataLine, const char delimiter,
-                                const int column ) {
+static int findColumns( const char* dataLine, const char delimiter,
+                        const int count, const int columns[],
+                        const char* words[] ) {
 
-  PRE03( dataLine, delimiter, column > 0 );
-  double result = MISSING;
-  const char* word = 0;
-  int skippedColumns = 1;
+  PRE06( dataLine, delimiter, count > 0, columns, columns[ 0 ] >= 0, words );
 
-  for ( word = strchr( dataLine, delimiter );
-        AND3( word, *word, skippedColumns < column );
-        ++skippedColumns ) {
-    word = strchr( word + 1, delimiter );
+  const char* c = dataLine;
+  int lastColumn = 0;
+  int column = 0;
+  int found = 0;
+  int index = 0;
+
+  for ( index = 0; index < count; ++index ) {
+    words[ index ] = 0;
+
+    if ( columns[ index ] > lastColumn ) {
+      lastColumn = columns[ index ];
+    }
   }
 
-  if ( AND3( skippedColumns == column, word, *word == delimiter ) ) {
-    const int ok =
-      AND3( sscanf( word + 1, "%lf", &result ) == 1,
-            ! isNan( result ),
-           result >= MISSING );
+  do {
+
+    for ( index = 0; index < count; ++index ) {
 
-    if ( ! ok ) {
-      result = MISSING;
+      if ( columns[ index ] == column ) {
+        words[ index ] = c;
+        ++found;
+      }
     }
+
+    while ( ! IN4( *c, delimiter, '\n', '\0' ) ) {
+      ++c;
+    }
+
+    ++column;
+  } while ( AND2( column <= lastColumn, *c++ == delimiter ) );
+
+  POST0( IN_RANGE( found, 0, count ) );
+  return found == count;
+}
+
+
+
+/******************************************************************************
+PURPOSE: parseColumnValue - Parse data value of a column.
+INPUTS:  const char* word  Start of column value from findColumns().
+RETURNS: double value of data at column or MISSING if invalid.
+******************************************************************************/
+
+static double parseColumnValue( const char* word ) {
+
+  PRE0( word );
+  char* end = 0;
+  double result = strtod( word, &end );
+  const int ok = AND3( end != word, ! isNan( result ), result >= MISSING );
+
+  if ( ! ok ) {
+    result = MISSING;
   }
 
   POST0( result >= MISSING );
@@ -1160,6 +1456,7 @@ static void writeData( Data* data ) {
 
     if ( data->ok ) {
       writeXDR( data, output );
+      timingPoints( totalSubsetPoints( data->tracks ) );
     }
 
     FREE_OBJECT( output );
@@ -20,6 +20,23 @@ STATUS:  unreviewed untested
 #include "Utilities.h" /* For MISSING_VALUE. */
 #include "ReadData.h"  /* For public interface. */
 
+/*================================= MACROS ==================================*/
+
+/* Number of values expanded at a time. Small enough to stay in L1 cache: */
+
+#define EXPAND_BLOCK_SIZE 2048
+
+/* Copy/expand count values of type_ to block: */
+
+#define EXPAND_BLOCK( type_ ) \
+  { \
+    const type_* const values = (const type_*) data + first; \
+    size_t index = 0; \
+    for ( index = 0; index < count; ++index ) { \
+      block[ index ] = (double) values[ index ]; \
+    } \
+  }
+
 /*========================== FORWARD DECLARATIONS ===========================*/
 
 static int findVariable( const int parentId, const char* const name,
@@ -34,6 +51,18 @@ static size_t readAndExpandData( const int gid,
                                  const double validMaximum,
                                  double data[] );
 
+static void expandValues( const nc_type type,
+                          const void* const data,
+                          const size_t first,
+                          const size_t count,
+                          double block[] );
+
+static size_t filterValues( const size_t count,
+                            const double validMinimum,
+                            const double validMaximum,
+                            const double block[],
+                            double data[] );
+
 static size_t sumDataAndScratch( const int gid,
                                  const int id,
                                  const size_t starts[],
@@ -992,36 +1021,22 @@ static size_t readAndExpandData( const int gid,
     const char* const message = nc_strerror( status );
     fprintf( stderr, "Failed to read data because: %s\n", message );
   } else {
-    size_t points = counts[ 0 ] * counts[ 1 ] * counts[ 2 ];
-
-    /* Loop backwards to expand data values to 64-bit reals: */
-
-    while ( points-- ) {
-      double value = -DBL_MAX;
-
-      switch ( type ) {
-      case NC_DOUBLE: value =           data[   points ]; break;
-      case NC_FLOAT:  value = (double) fdata[   points ]; break;
-      case NC_INT:    value = (double) idata[   points ]; break;
-      case NC_UINT:   value = (double) uidata[  points ]; break;
-      case NC_SHORT:  value = (double) sdata[   points ]; break;
-      case NC_USHORT: value = (double) usdata[  points ]; break;
-      case NC_CHAR:   value = (double) cdata[   points ]; break;
-      case NC_BYTE:   value = (double) cdata[   points ]; break;
-      case NC_UBYTE:  value = (double) ucdata[  points ]; break;
-      case NC_INT64:  value = (double) lldata[  points ]; break;
-      case NC_UINT64: value = (double) ulldata[ points ]; break;
-      default: break;
-      }
+    double block[ EXPAND_BLOCK_SIZE ];
+    size_t end = counts[ 0 ] * counts[ 1 ] * counts[ 2 ];
 
-      const int filtered = ! ( value >= validMinimum && value <= validMaximum );
+    /*
+     * Loop backwards over blocks to expand data values to 64-bit reals.
+     * Each block is expanded to a buffer before it is filtered and stored
+     * so no unexpanded value is overwritten:
+     */
 
-      if ( filtered ) {
-        data[ points ] = MISSING_VALUE;
-      } else {
-        data[ points ] = value;
-        ++result;
-      }
+    while ( end ) {
+      const size_t count = end < EXPAND_BLOCK_SIZE ? end : EXPAND_BLOCK_SIZE;
+      const size_t start = end - count;
+      expandValues( type, data, start, count, block );
+      result +=
+        filterValues( count, validMinimum, validMaximum, block, data + start );
+      end = start;
     }
 
     DEBUG( fprintf( stderr,
@@ -1036,6 +1051,79 @@ static size_t readAndExpandData( const int gid,
 
 
 
+/******************************************************************************
+PURPOSE: expandValues - Copy/expand a block of data values to 64-bit reals.
+INPUTS:  const nc_type type         Type of data values.
+         const void* const data     Data values of type.
+         const size_t first         0-based index of first value to expand.
+         const size_t count         Number of values to expand.
+OUTPUTS: double block[ count ]      Expanded values.
+NOTES:   Switches on type once per block so each loop is type-specialized.
+******************************************************************************/
+
+static void expandValues( const nc_type type,
+                          const void* const data,
+                          const size_t first,
+                          const size_t count,
+                          double block[] ) {
+
+  assert( type > -1 ); assert( data ); assert( count );
+  assert( count <= EXPAND_BLOCK_SIZE ); assert( block );
+
+  switch ( type ) {
+  case NC_DOUBLE: EXPAND_BLOCK( double );             break;
+  case NC_FLOAT:  EXPAND_BLOCK( float );              break;
+  case NC_INT:    EXPAND_BLOCK( int );                break;
+  case NC_UINT:   EXPAND_BLOCK( unsigned int );       break;
+  case NC_SHORT:  EXPAND_BLOCK( short );              break;
+  case NC_USHORT: EXPAND_BLOCK( unsigned short );     break;
+  case NC_CHAR:   EXPAND_BLOCK( signed char );        break;
+  case NC_BYTE:   EXPAND_BLOCK( signed char );        break;
+  case NC_UBYTE:  EXPAND_BLOCK( unsigned char );      break;
+  case NC_INT64:  EXPAND_BLOCK( long long );          break;
+  case NC_UINT64: EXPAND_BLOCK( unsigned long long ); break;
+  default: assert( 0 ); break;
+  }
+}
+
+
+
+/******************************************************************************
+PURPOSE: filterValues - Store block values that are within the valid range
+         and MISSING_VALUE for the others.
+INPUTS:  const size_t count           Number of values in block.
+         const double validMinimum    Valid minimum of values.
+         const double validMaximum    Valid maximum of values.
+         const double block[ count ]  Values to filter.
+OUTPUTS: double data[ count ]         Filtered values.
+RETURNS: size_t number of unfiltered values.
+NOTES:   Uses & rather than && so the loop has no branches.
+******************************************************************************/
+
+static size_t filterValues( const size_t count,
+                            const double validMinimum,
+                            const double validMaximum,
+                            const double block[],
+                            double data[] ) {
+
+  size_t result = 0;
+  size_t index = 0;
+
+  assert( count ); assert( validMinimum <= validMaximum );
+  assert( block ); assert( data ); assert( block != data );
+
+  for ( index = 0; index < count; ++index ) {
+    const double value = block[ index ];
+    const int valid = ( value >= validMinimum ) & ( value <= validMaximum );
+    data[ index ] = valid ? value : MISSING_VALUE;
+    result += valid;
+  }
+
+  return result;
+}
+
+
+
 /******************************************************************************
 PURPOSE: sumDataAndScratch - Sum data with auxiliary variable.
 INPUTS:  const int gid               Group of auxiliary variable.
@@ -104,6 +104,7 @@ STATUS:  unreviewd tested
 
 #include "Utilities.h" /* For LONGITUDE, Bounds. */
 #include "ReadData.h"  /* For openFile(), swathInDomain(), readFileData(). */
+#include <Timing.h>    /* For timingBegin(), timingStage(), timingReport(). */
 
 /*================================= MACROS =================================*/
 
@@ -317,23 +318,28 @@ RETURNS: 0 if successful, else 1.
 int main( int argc, char* argv[] ) {
   int ok = 0;
   Data data;
+  timingBegin( argv[ 0 ] ); /* Report per-stage timing if RSIG_TIMING=1. */
+  timingStage( "parse" );
   memset( &data, 0, sizeof data );
   data.ok = parseArguments( argc, argv, &data.arguments );
 
   if ( ! data.ok ) {
     printUsage( argv[ 0 ] );
   } else {
+    timingStage( "list" );
     readData( &data ); /* Read subset of TEMPO files and write temp files. */
 
     if ( data.isL3 ) {
       ok = data.ok;
     } else if ( data.ok && data.scans ) {
+      timingStage( "stream" );
       streamData( &data ); /* Write header and temp file to stdout & rm temp.*/
       ok = data.ok;
     }
   }
 
   deallocate( &data );
+  timingReport();
   DEBUG( fprintf( stderr, "%s exiting main with value %d\n\n", argv[0], ! ok);)
   return ! ok;
 }
@@ -644,6 +650,7 @@ static void readData( Data* const data ) {
       int file = 0;
       long long yyyymmddhhmm = 0;
       int changedDimensions = 0;
+      timingStage( "open" );
 
       if ( strstr( fileName, "_PM25_L3_V" ) ||
            strstr( fileName, "_ADP_L2_V" ) ) {
@@ -728,6 +735,8 @@ static void readData( Data* const data ) {
           }
         }
 
+        timingStage( "read" );
+
         if ( data->ok ) {
           readCoordinatesAndValues( data, file, rows, columns,
                                     longitudes, latitudes, values, scratch );
@@ -739,6 +748,7 @@ static void readData( Data* const data ) {
         if ( data->ok ) {
 
           if ( data->isL3 ) {
+            timingStage( "write" );
 
             if ( ! wroteGridHeader ) {
               writeGridHeader( data );
@@ -747,12 +757,16 @@ static void readData( Data* const data ) {
 
             writeSubsetGridData( data, yyyymmddhhmm / 100 );
           } else {
-            const size_t subsetPoints =
+            size_t subsetPoints = 0;
+            timingStage( "filter" );
+            subsetPoints =
               pointsInDomain( (const double (*)[2]) data->arguments.domain,
                               size, longitudes, latitudes, values, mask );
+            timingPoints( subsetPoints );
             DEBUG( fprintf( stderr, "subsetPoints = %lu\n", subsetPoints ); )
 
             if ( subsetPoints ) {
+              timingStage( "write" );
 
               if ( longitudesSW ) {
                 computeCorners( rows, columns, longitudes, latitudes,
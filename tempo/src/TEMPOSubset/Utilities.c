@@ -16,6 +16,10 @@ STATUS: unreviewed tested
 #include <sys/types.h> /* For struct stat. */
 #include <sys/stat.h>  /* For stat(). */
 
+#ifdef __SSE2__
+#include <emmintrin.h> /* For _mm_*_pd(). */
+#endif
+
 #include "Utilities.h" /* For public interface. */
 
 /*================================= MACROS ==================================*/
@@ -174,22 +178,47 @@ size_t pointsInDomain( const Bounds domain,
     const double latitudeMaximum  = domain[ LATITUDE  ][ MAXIMUM ];
     size_t point = 0;
 
-    for ( point = 0; point < points; ++point ) {
-      const double value = values[ point ];
-      mask[ point ] = 0;
+#ifdef __SSE2__
+
+    /* Test two points at a time: */
+
+    const __m128d missing = _mm_set1_pd( MISSING_VALUE );
+    const __m128d lonMinimum = _mm_set1_pd( longitudeMinimum );
+    const __m128d lonMaximum = _mm_set1_pd( longitudeMaximum );
+    const __m128d latMinimum = _mm_set1_pd( latitudeMinimum );
+    const __m128d latMaximum = _mm_set1_pd( latitudeMaximum );
+
+    for ( ; point + 1 < points; point += 2 ) {
+      const __m128d value     = _mm_loadu_pd( values     + point );
+      const __m128d longitude = _mm_loadu_pd( longitudes + point );
+      const __m128d latitude  = _mm_loadu_pd( latitudes  + point );
+      const __m128d inside =
+        _mm_and_pd( _mm_and_pd( _mm_cmpgt_pd( value, missing ),
+                                _mm_and_pd( _mm_cmple_pd( lonMinimum,
+                                                          longitude ),
+                                            _mm_cmple_pd( longitude,
+                                                          lonMaximum ) ) ),
+                    _mm_and_pd( _mm_cmple_pd( latMinimum, latitude ),
+                                _mm_cmple_pd( latitude, latMaximum ) ) );
+      const int bits = _mm_movemask_pd( inside );
+      mask[ point     ] = bits & 1;
+      mask[ point + 1 ] = bits >> 1;
+      result += ( bits & 1 ) + ( bits >> 1 );
+    }
 
-      if ( value > MISSING_VALUE ) {
-        const double longitude = longitudes[ point ];
+#endif
 
-        if ( IN_RANGE( longitude, longitudeMinimum, longitudeMaximum ) ) {
-          const double latitude = latitudes[ point ];
+    /* Use & rather than && so the test has no branches: */
 
-          if ( IN_RANGE( latitude, latitudeMinimum, latitudeMaximum ) ) {
-            mask[ point ] = 1;
-            ++result;
-          }
-        }
-      }
+    for ( ; point < points; ++point ) {
+      const double longitude = longitudes[ point ];
+      const double latitude  = latitudes[  point ];
+      const int inside =
+        ( values[ point ] > MISSING_VALUE ) &
+        ( longitude >= longitudeMinimum ) & ( longitude <= longitudeMaximum ) &
+        ( latitude  >= latitudeMinimum  ) & ( latitude  <= latitudeMaximum  );
+      mask[ point ] = inside;
+      result += inside;
     }
   }
 